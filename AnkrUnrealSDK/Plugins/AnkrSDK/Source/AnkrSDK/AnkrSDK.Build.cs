@@ -58,9 +58,21 @@ public class AnkrSDK : ModuleRules
 			}
 			);
 
+        // Windows and Linux load a shared library with the same exported C ABI through the same LibraryManager.
         if(Target.Platform == UnrealTargetPlatform.Win64)
         {
-            PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private/Windows"));
+            PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private/SharedLibrary"));
+		}
+
+		if (Target.Platform == UnrealTargetPlatform.Linux)
+		{
+			PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "Private/SharedLibrary"));
+
+			string LibraryPath = Path.Combine(ModuleDirectory, "Private/Linux/Libraries/libAnkrSDKUnrealLinux.so");
+			if (File.Exists(LibraryPath))
+			{
+				RuntimeDependencies.Add(LibraryPath);
+			}
 		}
 
 		if (Target.Platform == UnrealTargetPlatform.Mac)
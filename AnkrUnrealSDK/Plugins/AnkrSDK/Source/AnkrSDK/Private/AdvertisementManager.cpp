@@ -1,5 +1,6 @@
 #include "AdvertisementManager.h"
 #include "AnkrUtility.h"
+#include "AnkrTransport.h"
 #include <string>
 
 UAdvertisementManager::UAdvertisementManager(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -11,8 +12,6 @@ UAdvertisementManager::UAdvertisementManager(const FObjectInitializer& ObjectIni
     //{
         //libraryManageriOS = [[LibraryManager alloc] init];
     //}
-#elif PLATFORM_ANDROID
-	LibraryManager::GetInstance().Load();
 #endif
 }
 
@@ -33,7 +32,7 @@ void UAdvertisementManager::InitializeAdvertisement(FString _deviceId, FString _
     
     [libraryManageriOS Initialize:_appIdNSString deviceId:_deviceIdNSString publicAddress:_deviceIdNSString language:_languageNSString];*/
 #elif PLATFORM_ANDROID
-
+	LibraryManager::GetInstance().EnsureLoaded();
 
 
 #else
@@ -91,7 +90,7 @@ void UAdvertisementManager::StartSession()
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"app_id\": \"" + appId + "\", \"device_id\": \"" + deviceId + "\", \"public_address\":\"" + activeAccount + "\", \"language\":\"" + language + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 void UAdvertisementManager::GetAdvertisement(FString _unit_id, FAdvertisementReceivedDelegate advertisementData)
@@ -132,7 +131,7 @@ void UAdvertisementManager::GetAdvertisement(FString _unit_id, FAdvertisementRec
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"unit_id\":\"" + _unit_id + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 void UAdvertisementManager::DownloadVideoAdvertisement(FAdvertisementDataStructure advertisementData, FAdvertisementVideoAdDownloadDelegate Result)
@@ -157,7 +156,7 @@ void UAdvertisementManager::DownloadVideoAdvertisement(FAdvertisementDataStructu
 	Request->SetURL(advertisementData.result.texture_url);
 	Request->SetVerb("GET");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 void UAdvertisementManager::ShowAdvertisement(FAdvertisementDataStructure _data)
@@ -183,7 +182,7 @@ void UAdvertisementManager::ShowAdvertisement(FAdvertisementDataStructure _data)
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"started_at\": \"" + started_at + "\", \"finished_at\":\"" + finished_at + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 void UAdvertisementManager::RewardAdvertisement(FAdvertisementDataStructure _data)
@@ -208,7 +207,7 @@ void UAdvertisementManager::RewardAdvertisement(FAdvertisementDataStructure _dat
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"rewarded_at\": \"" + rewarded_at + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 void UAdvertisementManager::EngageAdvertisement(FAdvertisementDataStructure _data)
@@ -233,5 +232,5 @@ void UAdvertisementManager::EngageAdvertisement(FAdvertisementDataStructure _dat
 	Request->SetVerb("GET");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"clicked_at\": \"" + clicked_at + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
@@ -8,85 +8,190 @@ void LibraryManager::Load()
 	JCM_LaunchWalletForLogin		= JCO_AnkrClient->GetClassMethod("LaunchWalletForLogin", "()V");
 	JCM_LaunchWalletForTransaction	= JCO_AnkrClient->GetClassMethod("LaunchWalletForTransaction", "()V");
 	JCM_Initialize					= JCO_AnkrClient->GetClassMethod("Initialize", "(ZLjava/lang/String;)V");
-	JCM_Ping						= JCO_AnkrClient->GetClassMethod("Ping", "()V");
-	JCM_ConnectWallet				= JCO_AnkrClient->GetClassMethod("ConnectWallet", "()V");
-	JCM_GetWallet					= JCO_AnkrClient->GetClassMethod("GetWallet", "()V");
-	JCM_SendABI						= JCO_AnkrClient->GetClassMethod("SendABI", "(Ljava/lang/String;)V");
-	JCM_SendTransaction				= JCO_AnkrClient->GetClassMethod("SendTransaction", "(Ljava/lang/String;)V");
-	JCM_CallMethod					= JCO_AnkrClient->GetClassMethod("CallMethod", "(Ljava/lang/String;)V");
-	JCM_SignMessage					= JCO_AnkrClient->GetClassMethod("SignMessage", "(Ljava/lang/String;)V");
-	JCM_GetResult					= JCO_AnkrClient->GetClassMethod("GetResult", "(Ljava/lang/String;)V");
-	JCM_GetSignature				= JCO_AnkrClient->GetClassMethod("GetSignature", "(Ljava/lang/String;)V");
-	JCM_VerifyMessage				= JCO_AnkrClient->GetClassMethod("VerifyMessage", "(Ljava/lang/String;)V");*/
+	JCM_Ping						= JCO_AnkrClient->GetClassMethod("Ping", "(I)V");
+	JCM_ConnectWallet				= JCO_AnkrClient->GetClassMethod("ConnectWallet", "(ILjava/lang/String;)V");
+	JCM_GetWallet					= JCO_AnkrClient->GetClassMethod("GetWallet", "(ILjava/lang/String;)V");
+	JCM_SendABI						= JCO_AnkrClient->GetClassMethod("SendABI", "(ILjava/lang/String;)V");
+	JCM_SendTransaction				= JCO_AnkrClient->GetClassMethod("SendTransaction", "(ILjava/lang/String;)V");
+	JCM_CallMethod					= JCO_AnkrClient->GetClassMethod("CallMethod", "(ILjava/lang/String;)V");
+	JCM_SignMessage					= JCO_AnkrClient->GetClassMethod("SignMessage", "(ILjava/lang/String;)V");
+	JCM_GetResult					= JCO_AnkrClient->GetClassMethod("GetResult", "(ILjava/lang/String;)V");
+	JCM_GetSignature				= JCO_AnkrClient->GetClassMethod("GetSignature", "(ILjava/lang/String;)V");
+	JCM_VerifyMessage				= JCO_AnkrClient->GetClassMethod("VerifyMessage", "(ILjava/lang/String;)V");*/
 
 	JNIEnv* env = AndroidJavaEnv::GetJavaEnv();
-	//jclass jclass_AnkrAds = FJavaWrapper::FindClass(env, "com/ankr/nativeads/AnkrAds", false);//MakeShareable(new FJavaClassObject("com/ankr/nativeads/AnkrAds", "()V"));
+	if (!CacheJNI(env))
+	{
+		return;
+	}
+
 	UE_LOG(LogTemp, Error, TEXT("LibraryManager.cpp - Load - Initialize"));
-	Native_AnkrClient = MakeShareable(new FJavaClassObject("com/ankr/nativeads/AnkrAds", "()V"));
-	jclass jclass_AnkrAds = env->GetObjectClass(Native_AnkrClient->GetJObject());
-	jmethodID jmethodID_Initialize = env->GetStaticMethodID(jclass_AnkrAds, "Initialize", "(Landroid/app/Activity;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V");
-	env->CallStaticVoidMethod(jclass_AnkrAds, jmethodID_Initialize, FJavaWrapper::GameActivityThis, GetJString("86fc9bc7-3f7a-46cf-9cab-a12935d1e4ad"), GetJString("123456"), GetJString("0x0E9E2a366F0d82502483380093867335a58025bF"), GetJString("EN"));
+	FAnkrJNILocalFrame frame(env);
+	env->CallStaticVoidMethod(JClass_AnkrAds, JMethod_AnkrAds_Initialize, FJavaWrapper::GameActivityThis, GetJString("86fc9bc7-3f7a-46cf-9cab-a12935d1e4ad"), GetJString("123456"), GetJString("0x0E9E2a366F0d82502483380093867335a58025bF"), GetJString("EN"));
+}
+
+// CacheJNI resolves the classes and methods once, the classes are kept as global references so the ids stay valid for the lifetime of the process.
+bool LibraryManager::CacheJNI(JNIEnv* _env)
+{
+	if (JClass_AnkrAds != nullptr)
+	{
+		return true;
+	}
+
+	jclass local = AndroidJavaEnv::FindJavaClass("com/ankr/nativeads/AnkrAds");
+	if (local == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("LibraryManager.cpp - CacheJNI - com/ankr/nativeads/AnkrAds could not be found."));
+		return false;
+	}
+
+	// The method is looked up before the class is cached, a class without it must not be treated as loaded.
+	jmethodID initialize = _env->GetStaticMethodID(local, "Initialize", "(Landroid/app/Activity;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V");
+	if (initialize == nullptr)
+	{
+		_env->ExceptionClear();
+		_env->DeleteLocalRef(local);
+		UE_LOG(LogTemp, Error, TEXT("LibraryManager.cpp - CacheJNI - com/ankr/nativeads/AnkrAds.Initialize could not be found."));
+		return false;
+	}
+
+	JClass_AnkrAds			   = (jclass)_env->NewGlobalRef(local);
+	JMethod_AnkrAds_Initialize = initialize;
+	_env->DeleteLocalRef(local);
+	return true;
 }
 
 
 
 void LibraryManager::Unload()
 {
-	// Nothing to do here for now.
+	std::lock_guard<std::mutex> lock(loadLock);
+	isLoaded	 = false;
+	isLoadFailed = false;
+
+	if (JClass_AnkrAds != nullptr)
+	{
+		AndroidJavaEnv::GetJavaEnv()->DeleteGlobalRef(JClass_AnkrAds);
+		JClass_AnkrAds			   = nullptr;
+		JMethod_AnkrAds_Initialize = nullptr;
+	}
 }
 
 void LibraryManager::Initialize(bool _isDevelopment, FString _device_id)
 {
 	//JCO_AnkrClient->CallMethod<void>(JCM_Initialize, _isDevelopment, GetJString(_device_id));
 }
-void LibraryManager::Ping()
+
+bool LibraryManager::IsClientAvailable()
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_Ping);
+	return JCO_AnkrClient.IsValid();
 }
-void LibraryManager::ConnectWallet(FString _content)
+void LibraryManager::Ping(int _callIndex)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_ConnectWallet, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	JCO_AnkrClient->CallMethod<void>(JCM_Ping, _callIndex);
 }
-void LibraryManager::GetWallet(FString _content)
+void LibraryManager::ConnectWallet(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_GetWallet, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_ConnectWallet, _callIndex, GetJString(_content));
 }
-void LibraryManager::SendABI(FString _content)
+void LibraryManager::GetWallet(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_SendABI, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_GetWallet, _callIndex, GetJString(_content));
 }
-void LibraryManager::SendTransaction(FString _content)
+void LibraryManager::SendABI(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_SendTransaction, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_SendABI, _callIndex, GetJString(_content));
 }
-void LibraryManager::GetResult(FString _content)
+void LibraryManager::SendTransaction(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_GetResult, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_SendTransaction, _callIndex, GetJString(_content));
 }
-void LibraryManager::CallMethod(FString _content)
+void LibraryManager::GetResult(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_CallMethod, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_GetResult, _callIndex, GetJString(_content));
 }
-void LibraryManager::SignMessage(FString _content)
+void LibraryManager::CallMethod(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_SignMessage, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_CallMethod, _callIndex, GetJString(_content));
 }
-void LibraryManager::GetSignature(FString _content)
+void LibraryManager::SignMessage(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_GetSignature, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_SignMessage, _callIndex, GetJString(_content));
 }
-void LibraryManager::VerifyMessage(FString _content)
+void LibraryManager::GetSignature(int _callIndex, const std::string& _content)
 {
-	JCO_AnkrClient->CallMethod<void>(JCM_VerifyMessage, GetJString(_content));
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_GetSignature, _callIndex, GetJString(_content));
+}
+void LibraryManager::VerifyMessage(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+	FAnkrJNILocalFrame frame(AndroidJavaEnv::GetJavaEnv());
+	JCO_AnkrClient->CallMethod<void>(JCM_VerifyMessage, _callIndex, GetJString(_content));
 }
 
+// GetJString returns a local reference, call it inside an FAnkrJNILocalFrame so the reference is released with the frame.
 jobject LibraryManager::GetJString(FString string)
+{
+	return GetJString(std::string(TCHAR_TO_UTF8(*string)));
+}
+
+jobject LibraryManager::GetJString(const std::string& string)
 {
 	JNIEnv* JEnv = AndroidJavaEnv::GetJavaEnv();
-	jstring local = JEnv->NewStringUTF(TCHAR_TO_UTF8(*string));
-	jstring result = (jstring)JEnv->NewGlobalRef(local);
-	JEnv->DeleteLocalRef(local);
-	return result;
+	return JEnv->NewStringUTF(string.c_str());
+}
+
+// SubmitEach sends the requests one by one, the java AnkrClient has no batch entry point.
+void LibraryManager::SubmitEach(const std::vector<AnkrNativeRequest>& _requests)
+{
+	AnkrSubmitEach(*this, _requests);
 }
 
 TArray<FString> LibraryManager::GetFStringArrayFromJava(TSharedPtr<FJavaClassObject> javaObject, FJavaClassMethod javaMethod, const char* seperator)
@@ -108,57 +213,45 @@ TArray<FString> LibraryManager::GetFStringArrayFromJava(TSharedPtr<FJavaClassObj
 
 JNI_METHOD void Java_com_ankr_ankrsdkunreal_AnkrClient_OnCallback(JNIEnv* env, jclass clazz, bool _success, jstring _sender, jstring _data)
 {
-	const char* senderUTF8 = env->GetStringUTFChars(_sender, 0);
-	const char* dataUTF8 = env->GetStringUTFChars(_data, 0);
-	FString sender(UTF8_TO_TCHAR(senderUTF8));
-	FString data(UTF8_TO_TCHAR(dataUTF8));
-	env->ReleaseStringUTFChars(_sender, senderUTF8);
-	env->ReleaseStringUTFChars(_data, dataUTF8);
+	if (_sender == nullptr)
+	{
+		return;
+	}
 
-	UE_LOG(LogAndroid, Log, TEXT("C++ - LibraryManager - Java_com_ankr_ankrsdkunreal_AnkrClient_OnCallback - _success: %d | _sender: %s | _data: %s"), _success, *sender, *data);
-	LibraryManager::GetInstance().FlushCall(TCHAR_TO_UTF8(*sender), _success, TCHAR_TO_UTF8(*data));
-}
+	const char* senderUTF8 = env->GetStringUTFChars(_sender, 0);
+	const char* dataUTF8 = _data != nullptr ? env->GetStringUTFChars(_data, 0) : nullptr;
 
-int LibraryManager::GetGlobalCallIndex()
-{
-	GlobalCallIndex++; if (GlobalCallIndex > INT_MAX) GlobalCallIndex = 0;
-	return GlobalCallIndex;
-}
-bool LibraryManager::AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate _callComplete)
-{
-	std::string caller = std::string(_sender);
+	UE_LOG(LogAndroid, Log, TEXT("C++ - LibraryManager - Java_com_ankr_ankrsdkunreal_AnkrClient_OnCallback - _success: %d | _sender: %s"), _success, UTF8_TO_TCHAR(senderUTF8));
+	LibraryManager::GetInstance().FlushCall(senderUTF8, _success, dataUTF8);
 
-	if (CallList.count(caller) > 0)
+	env->ReleaseStringUTFChars(_sender, senderUTF8);
+	if (dataUTF8 != nullptr)
 	{
-		//UE_LOG(LogTemp, Warning, TEXT("LibraryManager - AddCall - %s call is already in the call list, can not add again."), *FString(caller.c_str()));
-		return false;
+		env->ReleaseStringUTFChars(_data, dataUTF8);
 	}
-
-	FAnkrCallStruct call{};
-	call.callIndex = LibraryManager::GetGlobalCallIndex();
-	call.sender = FString(_sender);
-	call.CallComplete = _callComplete;
-	CallList[caller] = call;
-
-	//UE_LOG(LogTemp, Warning, TEXT("LibraryManager - AddCall - %s call is added to the call list successfully."), *call.sender);
-	return true;
 }
 
-void LibraryManager::FlushCall(const char* _sender, bool _success, const char* _data)
+JNI_METHOD void Java_com_ankr_ankrsdkunreal_AnkrClient_OnIndexedCallback(JNIEnv* env, jclass clazz, jint _callIndex, jboolean _success, jstring _data)
 {
-	std::string caller = std::string(_sender);
-
-	if (CallList.count(caller) <= 0)
+	const char* dataUTF8 = _data != nullptr ? env->GetStringUTFChars(_data, 0) : nullptr;
+	LibraryManager::GetInstance().FlushCall((int)_callIndex, _success == JNI_TRUE, dataUTF8);
+	if (dataUTF8 != nullptr)
 	{
-		//UE_LOG(LogTemp, Warning, TEXT("LibraryManager - FlushCall - %s call doesn't exist in the call list."), *FString(caller.c_str()));
-		return;
+		env->ReleaseStringUTFChars(_data, dataUTF8);
 	}
+}
 
-	FAnkrCallStruct call = CallList[caller];
-	call.success = _success;
-	call.data = FString(_data);
-	CallQueue.push(call);
-	CallList.erase(caller);
+// EnsureLoaded loads the library on first use instead of at startup, it can be called from any thread and only the first call does the work.
+bool LibraryManager::EnsureLoaded()
+{
+	std::lock_guard<std::mutex> lock(loadLock);
+	if (!isLoaded && !isLoadFailed)
+	{
+		Load();
 
-	//UE_LOG(LogTemp, Warning, TEXT("LibraryManager - FlushCall - %s call is pushed to queue successfully."), *call.sender);
-}
\ No newline at end of file
+		// A failed load is recorded instead of being retried by every call, Unload clears it so the library can be loaded again.
+		isLoaded	 = JClass_AnkrAds != nullptr;
+		isLoadFailed = !isLoaded;
+	}
+	return isLoaded;
+}
@@ -5,11 +5,41 @@
 #include "Android/AndroidJava.h"
 
 #include <string>
+#include <vector>
 #include <queue>
 #include <unordered_map>
 #include "RequestBodyStructure.h"
+#include "AnkrCallQueue.h"
 #include "../../Public/AnkrDelegates.h"
 
+/// FAnkrJNILocalFrame releases the local references created inside a scope.
+///
+/// Native threads attached to the JVM never return to java, so their local references would only be freed when the thread detaches.
+class FAnkrJNILocalFrame
+{
+
+public:
+	explicit FAnkrJNILocalFrame(JNIEnv* _env, jint _capacity = 16) : env(_env)
+	{
+		isPushed = env->PushLocalFrame(_capacity) == 0;
+	}
+
+	~FAnkrJNILocalFrame()
+	{
+		if (isPushed)
+		{
+			env->PopLocalFrame(nullptr);
+		}
+	}
+
+	FAnkrJNILocalFrame(FAnkrJNILocalFrame const&) = delete;
+	void operator = (FAnkrJNILocalFrame const&) = delete;
+
+private:
+	JNIEnv* env;
+	bool isPushed;
+};
+
 class ANKRSDK_API LibraryManager
 {
 
@@ -47,32 +77,52 @@ public:
 	FJavaClassMethod JCM_GetSignature;
 	FJavaClassMethod JCM_VerifyMessage;
 
+	jclass    JClass_AnkrAds			 = nullptr;
+	jmethodID JMethod_AnkrAds_Initialize = nullptr;
+	bool CacheJNI(JNIEnv* _env);
+
 	void Initialize(bool, FString);
-	void Ping();
-	void ConnectWallet(FString);
-	void GetWallet(FString);
-	void SendABI(FString);
-	void SendTransaction(FString);
-	void GetResult(FString);
-	void CallMethod(FString);
-	void SignMessage(FString);
-	void GetSignature(FString _content);
-	void VerifyMessage(FString);
+	void Ping(int);
+	void ConnectWallet(int, const std::string&);
+	void GetWallet(int, const std::string&);
+	void SendABI(int, const std::string&);
+	void SendTransaction(int, const std::string&);
+	void GetResult(int, const std::string&);
+	void CallMethod(int, const std::string&);
+	void SignMessage(int, const std::string&);
+	void GetSignature(int, const std::string&);
+	void VerifyMessage(int, const std::string&);
+	void SubmitEach(const std::vector<AnkrNativeRequest>& _requests);
+
+	/// Whether the java AnkrClient answers the calls, every call fails right away otherwise.
+	bool IsClientAvailable();
 
 	jobject GetJString(FString string);
+	jobject GetJString(const std::string& string);
 	TArray<FString> GetFStringArrayFromJava(TSharedPtr<FJavaClassObject> javaObject, FJavaClassMethod javaMethod, const char* seperator);
 
 	void Load();
 	void Unload();
+	bool EnsureLoaded();
+
+	std::mutex loadLock;
+	bool isLoaded = false;
+	bool isLoadFailed = false;
 
-	int GlobalCallIndex;
-	std::unordered_map<std::string, FAnkrCallStruct> CallList;
-	std::queue<FAnkrCallStruct> CallQueue;
+	std::atomic<int> GlobalCallIndex{ 0 };
+	AnkrPendingCallTable<int, FAnkrCallStruct> CallList;
+	AnkrCompletionQueue<FAnkrCallStruct> CallQueue;
+	AnkrSenderCallQueue SenderCalls;
 
 	int GetGlobalCallIndex();
-	bool AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate _callComplete);
+	int AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate& _callComplete, EAnkrCallbackThread _callbackThread = EAnkrCallbackThread::GameThread);
+	int AddCall(const char* _sender, TFunction<void(bool, const FString&)> _callComplete, EAnkrCallbackThread _callbackThread = EAnkrCallbackThread::GameThread);
+	int RegisterCall(const char* _sender, FAnkrCallStruct& _call, EAnkrCallbackThread _callbackThread);
+	bool FailIfUnavailable(int _callIndex);
+	void FlushCall(int _callIndex, bool _success, const char* _data);
+	void SendBySender(const char* _sender, int _callIndex, std::function<void()> _send);
 	void FlushCall(const char* _sender, bool _success, const char* _data);
+	void CompleteCall(FAnkrCallStruct& _call, bool _success, const char* _data);
 
-	TSharedPtr<FJavaClassObject> Native_AnkrClient;
 	FJavaClassMethod Native_Initialize;
 };
\ No newline at end of file
@@ -0,0 +1,1254 @@
+#include "AnkrAbi.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	// GetValueText reads a scalar json value as text, numbers that are whole are written without a fraction.
+	bool GetValueText(const TSharedPtr<FJsonValue>& _value, FString& _text)
+	{
+		if (!_value.IsValid())
+		{
+			return false;
+		}
+
+		switch (_value->Type)
+		{
+			case EJson::String:
+				_text = _value->AsString().TrimStartAndEnd();
+				return true;
+
+			case EJson::Number:
+			{
+				const double number = _value->AsNumber();
+				if (number != FMath::RoundToDouble(number) || FMath::Abs(number) > 9007199254740992.0)
+				{
+					return false;
+				}
+				_text = FString::Printf(TEXT("%lld"), (long long)number);
+				return true;
+			}
+
+			case EJson::Boolean:
+				_text = _value->AsBool() ? TEXT("true") : TEXT("false");
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	bool IsHex(const FString& _text, int32 _start)
+	{
+		for (int32 i = _start; i < _text.Len(); i++)
+		{
+			if (!FChar::IsHexDigit(_text[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool IsZero(const FString& _text, int32 _start)
+	{
+		for (int32 i = _start; i < _text.Len(); i++)
+		{
+			if (_text[i] != '0')
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// GetBitLength parses an unsigned decimal or 0x hex number and returns the number of bits it needs, -1 when it is not a number.
+	// The value is normalized to decimal without leading zeros or to lowercase hex.
+	int32 GetBitLength(const FString& _text, FString& _normalized, bool& _isPowerOfTwo)
+	{
+		if (_text.StartsWith("0x", ESearchCase::IgnoreCase))
+		{
+			if (_text.Len() == 2 || !IsHex(_text, 2))
+			{
+				return -1;
+			}
+
+			FString digits = _text.Mid(2).ToLower();
+			int32 first = 0;
+			while (first < digits.Len() - 1 && digits[first] == '0') first++;
+			digits = digits.Mid(first);
+
+			_normalized = "0x" + digits;
+			const int32 leading = FParse::HexDigit(digits[0]);
+			_isPowerOfTwo		= FMath::IsPowerOfTwo(leading) && IsZero(digits, 1);
+			return (digits.Len() - 1) * 4 + (leading == 0 ? 0 : FMath::FloorLog2(leading) + 1);
+		}
+
+		if (_text.IsEmpty())
+		{
+			return -1;
+		}
+
+		// The value is kept in 32 bit limbs, least significant first, while the decimal digits are folded in.
+		TArray<uint64> limbs;
+		limbs.Add(0);
+		for (TCHAR character : _text)
+		{
+			if (!FChar::IsDigit(character))
+			{
+				return -1;
+			}
+
+			uint64 carry = character - '0';
+			for (uint64& limb : limbs)
+			{
+				const uint64 value = limb * 10 + carry;
+				limb  = value & 0xffffffffULL;
+				carry = value >> 32;
+			}
+			if (carry != 0)
+			{
+				limbs.Add(carry);
+			}
+		}
+
+		int32 first = 0;
+		while (first < _text.Len() - 1 && _text[first] == '0') first++;
+		_normalized = _text.Mid(first);
+
+		const uint64 top = limbs.Last();
+		_isPowerOfTwo	 = FMath::IsPowerOfTwo(top);
+		for (int32 i = 0; i < limbs.Num() - 1; i++)
+		{
+			_isPowerOfTwo &= limbs[i] == 0;
+		}
+		return (limbs.Num() - 1) * 32 + (top == 0 ? 0 : FMath::FloorLog2_64(top) + 1);
+	}
+
+	bool GetTypeSize(const FString& _type, const TCHAR* _prefix, int32 _default, int32& _size)
+	{
+		const FString size = _type.Mid(FCString::Strlen(_prefix));
+		if (size.IsEmpty())
+		{
+			_size = _default;
+			return true;
+		}
+		if (!size.IsNumeric())
+		{
+			return false;
+		}
+
+		_size = FCString::Atoi(*size);
+		return true;
+	}
+
+	bool ValidateInteger(const FString& _type, const FString& _text, FString& _normalized, FString& _error)
+	{
+		const bool isSigned = _type.StartsWith("int");
+
+		int32 bits;
+		if (!GetTypeSize(_type, isSigned ? TEXT("int") : TEXT("uint"), 256, bits) || bits <= 0 || bits > 256 || bits % 8 != 0)
+		{
+			_error = FString::Printf(TEXT("%s is not a valid integer type."), *_type);
+			return false;
+		}
+
+		FString magnitude	  = _text;
+		const bool isNegative = magnitude.StartsWith("-");
+		if (isNegative || magnitude.StartsWith("+"))
+		{
+			magnitude = magnitude.Mid(1);
+		}
+
+		if (isNegative && !isSigned)
+		{
+			_error = FString::Printf(TEXT("%s can not be negative for %s."), *_text, *_type);
+			return false;
+		}
+
+		FString normalized;
+		bool isPowerOfTwo;
+		const int32 length = GetBitLength(magnitude, normalized, isPowerOfTwo);
+		if (length < 0)
+		{
+			_error = FString::Printf(TEXT("%s is not a number for %s."), *_text, *_type);
+			return false;
+		}
+
+		// A signed value fits when its magnitude is below 2^(bits-1), or equal to it when it is negative.
+		const bool isMinimum = isNegative && length == bits && isPowerOfTwo;
+		if ((!isSigned && length > bits) || (isSigned && length > bits - 1 && !isMinimum))
+		{
+			_error = FString::Printf(TEXT("%s does not fit in %s."), *_text, *_type);
+			return false;
+		}
+
+		_normalized = (isNegative && normalized != "0" && normalized != "0x0" ? TEXT("-") : TEXT("")) + normalized;
+		return true;
+	}
+
+	bool ValidateBytes(const FString& _type, const FString& _text, FString& _normalized, FString& _error)
+	{
+		if (!_text.StartsWith("0x", ESearchCase::IgnoreCase) || _text.Len() % 2 != 0 || !IsHex(_text, 2))
+		{
+			_error = FString::Printf(TEXT("%s is not hex with an even number of digits for %s."), *_text, *_type);
+			return false;
+		}
+
+		if (_type != "bytes")
+		{
+			int32 size;
+			if (!GetTypeSize(_type, TEXT("bytes"), 0, size) || size <= 0 || size > 32)
+			{
+				_error = FString::Printf(TEXT("%s is not a valid bytes type."), *_type);
+				return false;
+			}
+			if ((_text.Len() - 2) / 2 != size)
+			{
+				_error = FString::Printf(TEXT("%s is not %d byte(s) long for %s."), *_text, size, *_type);
+				return false;
+			}
+		}
+
+		_normalized = "0x" + _text.Mid(2).ToLower();
+		return true;
+	}
+
+	bool ValidateScalar(const FString& _type, const FString& _text, FString& _normalized, FString& _error)
+	{
+		if (_type.StartsWith("uint") || _type.StartsWith("int"))
+		{
+			return ValidateInteger(_type, _text, _normalized, _error);
+		}
+
+		if (_type == "address")
+		{
+			if (_text.Len() != 42 || !_text.StartsWith("0x", ESearchCase::IgnoreCase) || !IsHex(_text, 2))
+			{
+				_error = FString::Printf(TEXT("%s is not an address."), *_text);
+				return false;
+			}
+			_normalized = _text;
+			return true;
+		}
+
+		if (_type == "bool")
+		{
+			if (!_text.Equals("true", ESearchCase::IgnoreCase) && !_text.Equals("false", ESearchCase::IgnoreCase))
+			{
+				_error = FString::Printf(TEXT("%s is not a bool."), *_text);
+				return false;
+			}
+			_normalized = _text.ToLower();
+			return true;
+		}
+
+		if (_type.StartsWith("bytes"))
+		{
+			return ValidateBytes(_type, _text, _normalized, _error);
+		}
+
+		if (_type == "string")
+		{
+			_normalized = _text;
+			return true;
+		}
+
+		_error = FString::Printf(TEXT("%s is not a supported type."), *_type);
+		return false;
+	}
+
+	// SplitTopLevel splits text at the commas that are not inside brackets, parentheses or quotes.
+	TArray<FString> SplitTopLevel(const FString& _text)
+	{
+		TArray<FString> parts;
+
+		int32 depth	  = 0;
+		bool isQuoted = false;
+		int32 start	  = 0;
+		for (int32 i = 0; i < _text.Len(); i++)
+		{
+			const TCHAR character = _text[i];
+			if (character == '"' && (i == 0 || _text[i - 1] != '\\'))
+			{
+				isQuoted = !isQuoted;
+			}
+			else if (!isQuoted && (character == '[' || character == '('))
+			{
+				depth++;
+			}
+			else if (!isQuoted && (character == ']' || character == ')'))
+			{
+				depth--;
+			}
+			else if (!isQuoted && depth == 0 && character == ',')
+			{
+				parts.Add(_text.Mid(start, i - start).TrimStartAndEnd());
+				start = i + 1;
+			}
+		}
+
+		const FString last = _text.Mid(start).TrimStartAndEnd();
+		if (!last.IsEmpty() || parts.Num() > 0)
+		{
+			parts.Add(last);
+		}
+		return parts;
+	}
+}
+
+bool AnkrAbi::ParseArguments(const FString& _args, TArray<TSharedPtr<FJsonValue>>& _values, bool& _isJsonArray)
+{
+	_values.Reset();
+
+	const FString args = _args.TrimStartAndEnd();
+	_isJsonArray	   = args.StartsWith("[");
+
+	if (_isJsonArray)
+	{
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(args);
+		return FJsonSerializer::Deserialize(Reader, _values);
+	}
+
+	for (FString part : SplitTopLevel(args))
+	{
+		if (part.StartsWith("["))
+		{
+			TArray<TSharedPtr<FJsonValue>> items;
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(part);
+			if (!FJsonSerializer::Deserialize(Reader, items))
+			{
+				return false;
+			}
+			_values.Add(MakeShared<FJsonValueArray>(items));
+			continue;
+		}
+
+		if (part.Len() >= 2 && part.StartsWith("\"") && part.EndsWith("\""))
+		{
+			part = part.Mid(1, part.Len() - 2);
+		}
+		_values.Add(MakeShared<FJsonValueString>(part));
+	}
+
+	return true;
+}
+
+FString AnkrAbi::WriteArguments(const TArray<TSharedPtr<FJsonValue>>& _values)
+{
+	FString args;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&args);
+	FJsonSerializer::Serialize(_values, Writer);
+	return args;
+}
+
+bool AnkrAbi::GetArrayType(const FString& _type, FString& _elementType, int32& _length)
+{
+	if (!_type.EndsWith("]"))
+	{
+		return false;
+	}
+
+	int32 open;
+	if (!_type.FindLastChar('[', open))
+	{
+		return false;
+	}
+
+	const FString length = _type.Mid(open + 1, _type.Len() - open - 2);
+	_elementType		 = _type.Left(open);
+	_length				 = length.IsEmpty() ? -1 : FCString::Atoi(*length);
+	return true;
+}
+
+TArray<FString> AnkrAbi::SplitTupleType(const FString& _type)
+{
+	if (!_type.StartsWith("(") || !_type.EndsWith(")"))
+	{
+		return TArray<FString>();
+	}
+	return SplitTopLevel(_type.Mid(1, _type.Len() - 2));
+}
+
+// ValidateValue walks arrays and tuples down to their scalars, booleans stay json booleans and every other scalar is written as a string.
+bool AnkrAbi::ValidateValue(const FString& _type, const TSharedPtr<FJsonValue>& _value, TSharedPtr<FJsonValue>& _normalized, FString& _error)
+{
+	FString elementType;
+	int32 length;
+	if (GetArrayType(_type, elementType, length) || _type.StartsWith("("))
+	{
+		const TArray<TSharedPtr<FJsonValue>>* items;
+		if (!_value.IsValid() || !_value->TryGetArray(items))
+		{
+			_error = FString::Printf(TEXT("%s needs a json array."), *_type);
+			return false;
+		}
+
+		const bool isTuple			  = _type.StartsWith("(") && _type.EndsWith(")");
+		const TArray<FString> members = isTuple ? SplitTupleType(_type) : TArray<FString>();
+		const int32 expected		  = isTuple ? members.Num() : length;
+		if (expected >= 0 && items->Num() != expected)
+		{
+			_error = FString::Printf(TEXT("%s needs %d value(s) but %d were given."), *_type, expected, items->Num());
+			return false;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> normalized;
+		for (int32 i = 0; i < items->Num(); i++)
+		{
+			TSharedPtr<FJsonValue> item;
+			if (!ValidateValue(isTuple ? members[i] : elementType, (*items)[i], item, _error))
+			{
+				return false;
+			}
+			normalized.Add(item);
+		}
+
+		_normalized = MakeShared<FJsonValueArray>(normalized);
+		return true;
+	}
+
+	FString text;
+	if (!GetValueText(_value, text))
+	{
+		_error = FString::Printf(TEXT("%s needs a single value, numbers larger than 2^53 must be given as strings."), *_type);
+		return false;
+	}
+
+	FString normalized;
+	if (!ValidateScalar(_type, text, normalized, _error))
+	{
+		return false;
+	}
+
+	if (_type == "bool")
+	{
+		_normalized = MakeShared<FJsonValueBoolean>(normalized == "true");
+	}
+	else
+	{
+		_normalized = MakeShared<FJsonValueString>(normalized);
+	}
+	return true;
+}
+
+bool AnkrAbi::ValidateArguments(const FAnkrAbiMethod& _method, const FString& _args, FString& _normalizedArgs, FString& _error)
+{
+	TArray<TSharedPtr<FJsonValue>> values;
+	bool isJsonArray;
+	if (!ParseArguments(_args, values, isJsonArray))
+	{
+		_error = FString::Printf(TEXT("The arguments of %s could not be read: %s"), *_method.name, *_args);
+		return false;
+	}
+
+	if (values.Num() != _method.inputs.Num())
+	{
+		_error = FString::Printf(TEXT("%s needs %d argument(s) but %d were given."), *_method.GetSignature(), _method.inputs.Num(), values.Num());
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> normalized;
+	for (int32 i = 0; i < values.Num(); i++)
+	{
+		TSharedPtr<FJsonValue> value;
+		if (!ValidateValue(_method.inputs[i].canonicalType, values[i], value, _error))
+		{
+			_error = FString::Printf(TEXT("%s argument %d (%s): %s"), *_method.GetSignature(), i, *_method.inputs[i].name, *_error);
+			return false;
+		}
+		normalized.Add(value);
+	}
+
+	_normalizedArgs = WriteArguments(normalized);
+	return true;
+}
+
+namespace
+{
+	void WriteNumber(uint64 _value, uint8* _word)
+	{
+		FMemory::Memzero(_word, 24);
+		for (int32 i = 0; i < 8; i++)
+		{
+			_word[31 - i] = (uint8)(_value >> (8 * i));
+		}
+	}
+
+	// ParseWord writes a decimal or 0x hex number with an optional minus sign as a word, negative numbers in two's complement.
+	// The number must have been validated for its type.
+	void ParseWord(const FString& _text, uint8* _word)
+	{
+		const bool isNegative = _text.StartsWith("-");
+
+		FAnkrUInt256 value;
+		FAnkrUInt256::Parse(isNegative ? _text.Mid(1) : _text, value);
+		if (isNegative)
+		{
+			value = FAnkrUInt256() - value;
+		}
+		value.ToBigEndian(_word);
+	}
+
+	int32 GetSequenceSize(const TArray<FAnkrAbiValue>& _items)
+	{
+		int32 size = 0;
+		for (const FAnkrAbiValue& item : _items)
+		{
+			size += item.IsDynamic() ? 32 + item.GetEncodedSize() : item.GetHeadSize();
+		}
+		return size;
+	}
+
+	// WriteStatic writes a static value in place, a static tuple is the concatenation of its items.
+	void WriteStatic(const FAnkrAbiValue& _value, uint8* _dest)
+	{
+		if (_value.kind == EAnkrAbiKind::Word)
+		{
+			FMemory::Memcpy(_dest, _value.word, 32);
+			return;
+		}
+
+		for (const FAnkrAbiValue& item : _value.items)
+		{
+			WriteStatic(item, _dest);
+			_dest += item.GetHeadSize();
+		}
+	}
+
+	void AppendValue(const FAnkrAbiValue& _value, TArray<uint8>& _out);
+
+	// AppendSequence writes the heads of the items followed by the tails of the dynamic ones, offsets count from the start of the heads.
+	void AppendSequence(const TArray<FAnkrAbiValue>& _items, TArray<uint8>& _out)
+	{
+		const int32 start = _out.Num();
+
+		int32 headSize = 0;
+		for (const FAnkrAbiValue& item : _items)
+		{
+			headSize += item.GetHeadSize();
+		}
+		_out.AddZeroed(headSize);
+
+		int32 head = start;
+		for (const FAnkrAbiValue& item : _items)
+		{
+			if (item.IsDynamic())
+			{
+				WriteNumber(_out.Num() - start, _out.GetData() + head);
+				AppendValue(item, _out);
+			}
+			else
+			{
+				WriteStatic(item, _out.GetData() + head);
+			}
+			head += item.GetHeadSize();
+		}
+	}
+
+	void AppendValue(const FAnkrAbiValue& _value, TArray<uint8>& _out)
+	{
+		if (!_value.IsDynamic())
+		{
+			const int32 index = _out.AddUninitialized(_value.GetHeadSize());
+			WriteStatic(_value, _out.GetData() + index);
+			return;
+		}
+
+		switch (_value.kind)
+		{
+			case EAnkrAbiKind::Bytes:
+			{
+				const int32 index = _out.AddZeroed(32 + Align(_value.data.Num(), 32));
+				WriteNumber(_value.data.Num(), _out.GetData() + index);
+				FMemory::Memcpy(_out.GetData() + index + 32, _value.data.GetData(), _value.data.Num());
+				break;
+			}
+
+			case EAnkrAbiKind::Array:
+			{
+				const int32 index = _out.AddUninitialized(32);
+				WriteNumber(_value.items.Num(), _out.GetData() + index);
+				AppendSequence(_value.items, _out);
+				break;
+			}
+
+			default:
+				AppendSequence(_value.items, _out);
+				break;
+		}
+	}
+}
+
+FAnkrAbiValue FAnkrAbiValue::Uint(uint64 _value)
+{
+	FAnkrAbiValue value;
+	WriteNumber(_value, value.word);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::Int(int64 _value)
+{
+	FAnkrAbiValue value;
+	WriteNumber((uint64)_value, value.word);
+	if (_value < 0)
+	{
+		FMemory::Memset(value.word, 0xff, 24);
+	}
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::Word(const uint8* _bigEndian)
+{
+	FAnkrAbiValue value;
+	FMemory::Memcpy(value.word, _bigEndian, 32);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::UInt256(const FAnkrUInt256& _value)
+{
+	FAnkrAbiValue value;
+	_value.ToBigEndian(value.word);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::Bool(bool _value)
+{
+	return Uint(_value ? 1 : 0);
+}
+
+FAnkrAbiValue FAnkrAbiValue::Address(const uint8* _address)
+{
+	FAnkrAbiValue value;
+	FMemory::Memcpy(value.word + 12, _address, 20);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::FixedBytes(const uint8* _bytes, int32 _length)
+{
+	FAnkrAbiValue value;
+	FMemory::Memcpy(value.word, _bytes, FMath::Clamp(_length, 0, 32));
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::Bytes(const uint8* _bytes, int32 _length)
+{
+	FAnkrAbiValue value;
+	value.kind = EAnkrAbiKind::Bytes;
+	value.data.Append(_bytes, _length);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::Bytes(TArray<uint8> _bytes)
+{
+	FAnkrAbiValue value;
+	value.kind = EAnkrAbiKind::Bytes;
+	value.data = MoveTemp(_bytes);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::String(const FString& _text)
+{
+	FTCHARToUTF8 utf8(*_text);
+	return Bytes((const uint8*)utf8.Get(), utf8.Length());
+}
+
+FAnkrAbiValue FAnkrAbiValue::Array(TArray<FAnkrAbiValue> _items)
+{
+	FAnkrAbiValue value;
+	value.kind	= EAnkrAbiKind::Array;
+	value.items = MoveTemp(_items);
+	return value;
+}
+
+FAnkrAbiValue FAnkrAbiValue::Tuple(TArray<FAnkrAbiValue> _items)
+{
+	FAnkrAbiValue value;
+	value.kind	= EAnkrAbiKind::Tuple;
+	value.items = MoveTemp(_items);
+	return value;
+}
+
+bool FAnkrAbiValue::IsDynamic() const
+{
+	switch (kind)
+	{
+		case EAnkrAbiKind::Word:
+			return false;
+
+		case EAnkrAbiKind::Tuple:
+			for (const FAnkrAbiValue& item : items)
+			{
+				if (item.IsDynamic())
+				{
+					return true;
+				}
+			}
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+int32 FAnkrAbiValue::GetHeadSize() const
+{
+	if (kind == EAnkrAbiKind::Word || IsDynamic())
+	{
+		return 32;
+	}
+
+	int32 size = 0;
+	for (const FAnkrAbiValue& item : items)
+	{
+		size += item.GetHeadSize();
+	}
+	return size;
+}
+
+int32 FAnkrAbiValue::GetEncodedSize() const
+{
+	switch (kind)
+	{
+		case EAnkrAbiKind::Word:
+			return 32;
+
+		case EAnkrAbiKind::Bytes:
+			return 32 + Align(data.Num(), 32);
+
+		case EAnkrAbiKind::Array:
+			return 32 + GetSequenceSize(items);
+
+		default:
+			return GetSequenceSize(items);
+	}
+}
+
+void AnkrAbi::Encode(const TArray<FAnkrAbiValue>& _values, TArray<uint8>& _out)
+{
+	_out.Reserve(_out.Num() + GetSequenceSize(_values));
+	AppendSequence(_values, _out);
+}
+
+void AnkrAbi::EncodeCall(uint32 _selector, const TArray<FAnkrAbiValue>& _values, TArray<uint8>& _calldata)
+{
+	_calldata.Reset(4 + GetSequenceSize(_values));
+	_calldata.Add((uint8)(_selector >> 24));
+	_calldata.Add((uint8)(_selector >> 16));
+	_calldata.Add((uint8)(_selector >> 8));
+	_calldata.Add((uint8)_selector);
+	AppendSequence(_values, _calldata);
+}
+
+// ToAbiValue walks arrays and tuples like ValidateValue, the scalars are validated before they are converted.
+bool AnkrAbi::ToAbiValue(const FString& _type, const TSharedPtr<FJsonValue>& _value, FAnkrAbiValue& _abiValue, FString& _error)
+{
+	FString elementType;
+	int32 length;
+	const bool isArray = GetArrayType(_type, elementType, length);
+	if (isArray || _type.StartsWith("("))
+	{
+		const TArray<TSharedPtr<FJsonValue>>* items;
+		if (!_value.IsValid() || !_value->TryGetArray(items))
+		{
+			_error = FString::Printf(TEXT("%s needs a json array."), *_type);
+			return false;
+		}
+
+		const bool isTuple			  = !isArray;
+		const TArray<FString> members = isTuple ? SplitTupleType(_type) : TArray<FString>();
+		const int32 expected		  = isTuple ? members.Num() : length;
+		if (expected >= 0 && items->Num() != expected)
+		{
+			_error = FString::Printf(TEXT("%s needs %d value(s) but %d were given."), *_type, expected, items->Num());
+			return false;
+		}
+
+		TArray<FAnkrAbiValue> abiItems;
+		abiItems.SetNum(items->Num());
+		for (int32 i = 0; i < items->Num(); i++)
+		{
+			if (!ToAbiValue(isTuple ? members[i] : elementType, (*items)[i], abiItems[i], _error))
+			{
+				return false;
+			}
+		}
+
+		_abiValue = (isArray && length < 0) ? FAnkrAbiValue::Array(MoveTemp(abiItems)) : FAnkrAbiValue::Tuple(MoveTemp(abiItems));
+		return true;
+	}
+
+	FString text;
+	if (!GetValueText(_value, text))
+	{
+		_error = FString::Printf(TEXT("%s needs a single value, numbers larger than 2^53 must be given as strings."), *_type);
+		return false;
+	}
+
+	FString normalized;
+	if (!ValidateScalar(_type, text, normalized, _error))
+	{
+		return false;
+	}
+
+	if (_type.StartsWith("uint") || _type.StartsWith("int"))
+	{
+		_abiValue = FAnkrAbiValue();
+		ParseWord(normalized, _abiValue.word);
+	}
+	else if (_type == "bool")
+	{
+		_abiValue = FAnkrAbiValue::Bool(normalized == "true");
+	}
+	else if (_type == "string")
+	{
+		_abiValue = FAnkrAbiValue::String(normalized);
+	}
+	else
+	{
+		TArray<uint8> bytes;
+		FromHex(normalized, bytes);
+
+		if (_type == "address")
+		{
+			_abiValue = FAnkrAbiValue::Address(bytes.GetData());
+		}
+		else if (_type == "bytes")
+		{
+			_abiValue = FAnkrAbiValue::Bytes(MoveTemp(bytes));
+		}
+		else
+		{
+			_abiValue = FAnkrAbiValue::FixedBytes(bytes.GetData(), bytes.Num());
+		}
+	}
+	return true;
+}
+
+bool AnkrAbi::EncodeArguments(const FAnkrAbiMethod& _method, const FString& _args, TArray<uint8>& _calldata, FString& _error)
+{
+	TArray<TSharedPtr<FJsonValue>> values;
+	bool isJsonArray;
+	if (!ParseArguments(_args, values, isJsonArray))
+	{
+		_error = FString::Printf(TEXT("The arguments of %s could not be read: %s"), *_method.name, *_args);
+		return false;
+	}
+
+	if (values.Num() != _method.inputs.Num())
+	{
+		_error = FString::Printf(TEXT("%s needs %d argument(s) but %d were given."), *_method.GetSignature(), _method.inputs.Num(), values.Num());
+		return false;
+	}
+
+	TArray<FAnkrAbiValue> abiValues;
+	abiValues.SetNum(values.Num());
+	for (int32 i = 0; i < values.Num(); i++)
+	{
+		if (!ToAbiValue(_method.inputs[i].canonicalType, values[i], abiValues[i], _error))
+		{
+			_error = FString::Printf(TEXT("%s argument %d (%s): %s"), *_method.GetSignature(), i, *_method.inputs[i].name, *_error);
+			return false;
+		}
+	}
+
+	EncodeCall(_method.selectorId, abiValues, _calldata);
+	return true;
+}
+
+FString AnkrAbi::ToHex(const uint8* _bytes, int32 _length)
+{
+	static const TCHAR* Digits = TEXT("0123456789abcdef");
+
+	FString hex;
+	hex.Reserve(2 + 2 * _length);
+	hex += TEXT("0x");
+	for (int32 i = 0; i < _length; i++)
+	{
+		hex.AppendChar(Digits[_bytes[i] >> 4]);
+		hex.AppendChar(Digits[_bytes[i] & 0x0f]);
+	}
+	return hex;
+}
+
+FString AnkrAbi::ToHex(const TArray<uint8>& _bytes)
+{
+	return ToHex(_bytes.GetData(), _bytes.Num());
+}
+
+bool AnkrAbi::FromHex(const FString& _hex, TArray<uint8>& _bytes)
+{
+	const int32 start = _hex.StartsWith("0x", ESearchCase::IgnoreCase) ? 2 : 0;
+	if ((_hex.Len() - start) % 2 != 0 || !IsHex(_hex, start))
+	{
+		return false;
+	}
+
+	_bytes.SetNumUninitialized((_hex.Len() - start) / 2);
+	for (int32 i = 0; i < _bytes.Num(); i++)
+	{
+		_bytes[i] = (FParse::HexDigit(_hex[start + 2 * i]) << 4) | FParse::HexDigit(_hex[start + 2 * i + 1]);
+	}
+	return true;
+}
+
+bool FAnkrAbiValue::FitsUint64() const
+{
+	for (int32 i = 0; i < 24; i++)
+	{
+		if (word[i] != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64 FAnkrAbiValue::GetUint64() const
+{
+	uint64 value = 0;
+	for (int32 i = 24; i < 32; i++)
+	{
+		value = (value << 8) | word[i];
+	}
+	return value;
+}
+
+int64 FAnkrAbiValue::GetInt64() const
+{
+	return (int64)GetUint64();
+}
+
+bool FAnkrAbiValue::GetBool() const
+{
+	return word[31] != 0;
+}
+
+FString FAnkrAbiValue::GetAddress() const
+{
+	return AnkrAbi::ToHex(word + 12, 20);
+}
+
+FString FAnkrAbiValue::GetDecimal() const
+{
+	return GetUInt256().ToDecimal();
+}
+
+FAnkrUInt256 FAnkrAbiValue::GetUInt256() const
+{
+	return FAnkrUInt256::FromBigEndian(word);
+}
+
+FString FAnkrAbiValue::GetString() const
+{
+	FUTF8ToTCHAR conversion((const ANSICHAR*)data.GetData(), data.Num());
+	return FString(conversion.Length(), conversion.Get());
+}
+
+namespace
+{
+	bool IsDynamicType(const FString& _type)
+	{
+		if (_type == "bytes" || _type == "string")
+		{
+			return true;
+		}
+
+		FString elementType;
+		int32 length;
+		if (AnkrAbi::GetArrayType(_type, elementType, length))
+		{
+			return length < 0 || IsDynamicType(elementType);
+		}
+
+		if (_type.StartsWith("("))
+		{
+			for (const FString& member : AnkrAbi::SplitTupleType(_type))
+			{
+				if (IsDynamicType(member))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	// GetStaticSize is the size of a type in the head, 32 bytes for dynamic types.
+	int32 GetStaticSize(const FString& _type)
+	{
+		if (IsDynamicType(_type))
+		{
+			return 32;
+		}
+
+		FString elementType;
+		int32 length;
+		if (AnkrAbi::GetArrayType(_type, elementType, length))
+		{
+			return length * GetStaticSize(elementType);
+		}
+
+		if (_type.StartsWith("("))
+		{
+			int32 size = 0;
+			for (const FString& member : AnkrAbi::SplitTupleType(_type))
+			{
+				size += GetStaticSize(member);
+			}
+			return size;
+		}
+		return 32;
+	}
+
+	// ReadLength reads an offset or a length, it must be a word small enough to lie within the data.
+	bool ReadLength(const uint8* _data, int32 _length, int32 _position, int32& _value, FString& _error)
+	{
+		if (_position < 0 || _position > _length - 32)
+		{
+			_error = FString::Printf(TEXT("The data ends at %d before the word at %d."), _length, _position);
+			return false;
+		}
+
+		FAnkrAbiValue word = FAnkrAbiValue::Word(_data + _position);
+		if (!word.FitsUint64() || word.GetUint64() > (uint64)_length)
+		{
+			_error = FString::Printf(TEXT("The offset or length at %d is larger than the data."), _position);
+			return false;
+		}
+
+		_value = (int32)word.GetUint64();
+		return true;
+	}
+
+	bool DecodeAt(const FString& _type, const uint8* _data, int32 _length, int32 _position, FAnkrAbiValue& _value, FString& _error);
+
+	// DecodeItems decodes the heads starting at a position, the offsets of dynamic items count from that position.
+	// The types are read with a stride so the items of an array can share the type of its elements.
+	bool DecodeItems(const FString* _types, int32 _stride, int32 _count, const uint8* _data, int32 _length, int32 _start, TArray<FAnkrAbiValue>& _items, FString& _error)
+	{
+		_items.SetNum(_count);
+
+		int32 head = _start;
+		for (int32 i = 0; i < _count; i++)
+		{
+			const FString& type = _types[i * _stride];
+
+			int32 position = head;
+			if (IsDynamicType(type))
+			{
+				int32 offset;
+				if (!ReadLength(_data, _length, head, offset, _error))
+				{
+					return false;
+				}
+				position = _start + offset;
+			}
+
+			if (!DecodeAt(type, _data, _length, position, _items[i], _error))
+			{
+				return false;
+			}
+			head += GetStaticSize(type);
+		}
+		return true;
+	}
+
+	bool DecodeAt(const FString& _type, const uint8* _data, int32 _length, int32 _position, FAnkrAbiValue& _value, FString& _error)
+	{
+		if (_type == "bytes" || _type == "string")
+		{
+			int32 size;
+			if (!ReadLength(_data, _length, _position, size, _error))
+			{
+				return false;
+			}
+			if (size > _length - _position - 32)
+			{
+				_error = FString::Printf(TEXT("The %s at %d is longer than the data."), *_type, _position);
+				return false;
+			}
+
+			_value = FAnkrAbiValue::Bytes(_data + _position + 32, size);
+			return true;
+		}
+
+		FString elementType;
+		int32 length;
+		if (AnkrAbi::GetArrayType(_type, elementType, length))
+		{
+			int32 start = _position;
+			if (length < 0)
+			{
+				if (!ReadLength(_data, _length, _position, length, _error))
+				{
+					return false;
+				}
+				start += 32;
+			}
+
+			// Every item takes at least a word in the head, a larger count can not be valid data.
+			if ((int64)length * 32 > (int64)_length - start)
+			{
+				_error = FString::Printf(TEXT("The %s at %d has more items than the data can hold."), *_type, _position);
+				return false;
+			}
+
+			_value		= FAnkrAbiValue();
+			_value.kind = _type.EndsWith("[]") ? EAnkrAbiKind::Array : EAnkrAbiKind::Tuple;
+			return DecodeItems(&elementType, 0, length, _data, _length, start, _value.items, _error);
+		}
+
+		if (_type.StartsWith("("))
+		{
+			const TArray<FString> members = AnkrAbi::SplitTupleType(_type);
+
+			_value		= FAnkrAbiValue();
+			_value.kind = EAnkrAbiKind::Tuple;
+			return DecodeItems(members.GetData(), 1, members.Num(), _data, _length, _position, _value.items, _error);
+		}
+
+		if (_position < 0 || _position > _length - 32)
+		{
+			_error = FString::Printf(TEXT("The data ends at %d before the %s at %d."), _length, *_type, _position);
+			return false;
+		}
+
+		_value = FAnkrAbiValue::Word(_data + _position);
+		return true;
+	}
+}
+
+bool AnkrAbi::Decode(const TArray<FString>& _types, const uint8* _data, int32 _length, TArray<FAnkrAbiValue>& _values, FString& _error)
+{
+	return DecodeItems(_types.GetData(), 1, _types.Num(), _data, _length, 0, _values, _error);
+}
+
+bool AnkrAbi::DecodeOutputs(const FAnkrAbiMethod& _method, const FString& _hex, TArray<FAnkrAbiValue>& _values, FString& _error)
+{
+	TArray<uint8> data;
+	if (!FromHex(_hex.TrimStartAndEnd(), data))
+	{
+		_error = FString::Printf(TEXT("The outputs of %s are not hex."), *_method.name);
+		return false;
+	}
+
+	TArray<FString> types;
+	for (const FAnkrAbiParameter& output : _method.outputs)
+	{
+		types.Add(output.canonicalType);
+	}
+	return Decode(types, data.GetData(), data.Num(), _values, _error);
+}
+
+TSharedPtr<FJsonValue> AnkrAbi::ToJsonValue(const FString& _type, const FAnkrAbiValue& _value)
+{
+	if (_value.kind == EAnkrAbiKind::Array || _value.kind == EAnkrAbiKind::Tuple)
+	{
+		FString elementType;
+		int32 length;
+		const bool isArray			  = GetArrayType(_type, elementType, length);
+		const TArray<FString> members = isArray ? TArray<FString>() : SplitTupleType(_type);
+
+		TArray<TSharedPtr<FJsonValue>> items;
+		for (int32 i = 0; i < _value.items.Num(); i++)
+		{
+			items.Add(ToJsonValue(isArray ? elementType : (members.IsValidIndex(i) ? members[i] : FString()), _value.items[i]));
+		}
+		return MakeShared<FJsonValueArray>(items);
+	}
+
+	if (_type == "string")
+	{
+		return MakeShared<FJsonValueString>(_value.GetString());
+	}
+	if (_value.kind == EAnkrAbiKind::Bytes)
+	{
+		return MakeShared<FJsonValueString>(ToHex(_value.data));
+	}
+	if (_type == "bool")
+	{
+		return MakeShared<FJsonValueBoolean>(_value.GetBool());
+	}
+	if (_type == "address")
+	{
+		return MakeShared<FJsonValueString>(_value.GetAddress());
+	}
+	if (_type.StartsWith("bytes"))
+	{
+		int32 size;
+		GetTypeSize(_type, TEXT("bytes"), 32, size);
+		return MakeShared<FJsonValueString>(ToHex(_value.word, FMath::Clamp(size, 0, 32)));
+	}
+
+	// A negative intN is written as the decimal of its two's complement negation.
+	if (_type.StartsWith("int") && (_value.word[0] & 0x80) != 0)
+	{
+		return MakeShared<FJsonValueString>("-" + (FAnkrUInt256() - _value.GetUInt256()).ToDecimal());
+	}
+	return MakeShared<FJsonValueString>(_value.GetDecimal());
+}
+
+namespace
+{
+	// RunBenchmark encodes the same balanceOfBatch call from typed values and from json arguments and logs the throughput of both.
+	void RunBenchmark(const TArray<FString>& _args)
+	{
+		const int32 count  = _args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*_args[0])) : 100000;
+		const int32 length = _args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*_args[1])) : 9;
+
+		const FAnkrContract contract(TEXT("AbiBenchmark"), TEXT("0x0000000000000000000000000000000000000001"),
+			TEXT("[{\"inputs\":[{\"internalType\":\"address[]\",\"name\":\"accounts\",\"type\":\"address[]\"},{\"internalType\":\"uint256[]\",\"name\":\"ids\",\"type\":\"uint256[]\"}],\"name\":\"balanceOfBatch\",\"outputs\":[{\"internalType\":\"uint256[]\",\"name\":\"\",\"type\":\"uint256[]\"}],\"stateMutability\":\"view\",\"type\":\"function\"}]"));
+		const FAnkrAbiMethod& method = (*contract.FindMethods(TEXT("balanceOfBatch")))[0];
+
+		uint8 address[20];
+		for (int32 i = 0; i < 20; i++)
+		{
+			address[i] = (uint8)(0xd0 + i);
+		}
+		const FString addressHex = AnkrAbi::ToHex(address, 20);
+
+		TArray<FAnkrAbiValue> accounts;
+		TArray<FAnkrAbiValue> ids;
+		TArray<FString> accountArgs;
+		TArray<FString> idArgs;
+		for (int32 i = 0; i < length; i++)
+		{
+			accounts.Add(FAnkrAbiValue::Address(address));
+			ids.Add(FAnkrAbiValue::Uint(0x0001000000000001ULL + i));
+			accountArgs.Add("\"" + addressHex + "\"");
+			idArgs.Add("\"" + FString::Printf(TEXT("0x%llx"), 0x0001000000000001ULL + i) + "\"");
+		}
+		const TArray<FAnkrAbiValue> values = { FAnkrAbiValue::Array(accounts), FAnkrAbiValue::Array(ids) };
+		const FString args = "[[" + FString::Join(accountArgs, TEXT(",")) + "], [" + FString::Join(idArgs, TEXT(",")) + "]]";
+
+		TArray<uint8> typed;
+		double start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < count; i++)
+		{
+			AnkrAbi::EncodeCall(method.selectorId, values, typed);
+		}
+		const double typedSeconds = FPlatformTime::Seconds() - start;
+
+		TArray<uint8> json;
+		FString error;
+		start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < count; i++)
+		{
+			AnkrAbi::EncodeArguments(method, args, json, error);
+		}
+		const double jsonSeconds = FPlatformTime::Seconds() - start;
+
+		const double megabytes = (double)count * typed.Num() / (1024.0 * 1024.0);
+		UE_LOG(LogTemp, Warning, TEXT("AnkrAbi - Benchmark - %d call(s) of %s with %d account(s), %d byte(s) of calldata."), count, *method.GetSignature(), length, typed.Num());
+		UE_LOG(LogTemp, Warning, TEXT("AnkrAbi - Benchmark - Typed: %.0f calls/s, %.1f MB/s."), count / typedSeconds, megabytes / typedSeconds);
+		UE_LOG(LogTemp, Warning, TEXT("AnkrAbi - Benchmark - Json: %.0f calls/s, %.1f MB/s, the calldata %s."), count / jsonSeconds, megabytes / jsonSeconds, typed == json ? TEXT("match") : TEXT("DO NOT match"));
+	}
+
+	FAutoConsoleCommand BenchmarkCommand(
+		TEXT("Ankr.AbiBenchmark"),
+		TEXT("Logs the throughput of AnkrAbi::EncodeCall for typed values and for json arguments, e.g. Ankr.AbiBenchmark 100000 9 for 100000 calls of balanceOfBatch with 9 accounts."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark));
+}
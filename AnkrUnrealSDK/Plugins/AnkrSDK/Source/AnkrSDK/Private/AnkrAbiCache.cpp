@@ -0,0 +1,424 @@
+#include "AnkrAbiCache.h"
+#include "AnkrUtility.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+
+namespace
+{
+	FCriticalSection CacheLock;
+	bool IsLoaded = false;
+	TMap<FString, FString> AbiHashes;
+	TSet<FString> ValidatedHashes;
+	TMap<FString, FString> LocalAbis;
+	TMap<FString, FString> Aliases;
+
+	TAutoConsoleVariable<bool> CVarLocalAbiHash(
+		TEXT("Ankr.LocalAbiHash"),
+		false,
+		TEXT("Whether SendABI computes the abi hash locally instead of uploading the abi, the abi is registered only when the Ankr API does not know the hash."),
+		ECVF_Default);
+
+	void WriteCanonicalString(const FString& _value, FString& _out)
+	{
+		_out += TEXT('"');
+		for (TCHAR character : _value)
+		{
+			switch (character)
+			{
+				case TEXT('"'):  _out += TEXT("\\\""); break;
+				case TEXT('\\'): _out += TEXT("\\\\"); break;
+				case TEXT('\n'): _out += TEXT("\\n");  break;
+				case TEXT('\r'): _out += TEXT("\\r");  break;
+				case TEXT('\t'): _out += TEXT("\\t");  break;
+				default:
+					if (character < 0x20)
+					{
+						_out += FString::Printf(TEXT("\\u%04x"), (int32)character);
+					}
+					else
+					{
+						_out += character;
+					}
+					break;
+			}
+		}
+		_out += TEXT('"');
+	}
+
+	void WriteCanonical(const TSharedPtr<FJsonValue>& _value, FString& _out)
+	{
+		if (!_value.IsValid())
+		{
+			_out += TEXT("null");
+			return;
+		}
+
+		switch (_value->Type)
+		{
+			case EJson::Boolean:
+				_out += _value->AsBool() ? TEXT("true") : TEXT("false");
+				break;
+
+			case EJson::Number:
+			{
+				const double number = _value->AsNumber();
+				if (FMath::IsNearlyEqual(number, FMath::RoundToDouble(number)) && FMath::Abs(number) < 1e15)
+				{
+					_out += FString::Printf(TEXT("%lld"), (long long)number);
+				}
+				else
+				{
+					_out += FString::Printf(TEXT("%.17g"), number);
+				}
+				break;
+			}
+
+			case EJson::String:
+				WriteCanonicalString(_value->AsString(), _out);
+				break;
+
+			case EJson::Array:
+			{
+				_out += TEXT('[');
+				const TArray<TSharedPtr<FJsonValue>>& items = _value->AsArray();
+				for (int i = 0; i < items.Num(); i++)
+				{
+					if (i > 0) _out += TEXT(',');
+					WriteCanonical(items[i], _out);
+				}
+				_out += TEXT(']');
+				break;
+			}
+
+			case EJson::Object:
+			{
+				const TSharedPtr<FJsonObject> object = _value->AsObject();
+				TArray<FString> keys;
+				object->Values.GetKeys(keys);
+				keys.Sort([](const FString& a, const FString& b) { return a.Compare(b, ESearchCase::CaseSensitive) < 0; });
+
+				_out += TEXT('{');
+				for (int i = 0; i < keys.Num(); i++)
+				{
+					if (i > 0) _out += TEXT(',');
+					WriteCanonicalString(keys[i], _out);
+					_out += TEXT(':');
+					WriteCanonical(object->Values[keys[i]], _out);
+				}
+				_out += TEXT('}');
+				break;
+			}
+
+			default:
+				_out += TEXT("null");
+				break;
+		}
+	}
+}
+
+// Canonicalize parses the ABI, a contract ABI is an array but a single json object is accepted as well.
+FString AnkrAbiCache::Canonicalize(const FString& _abi)
+{
+	TSharedPtr<FJsonValue> value;
+
+	TArray<TSharedPtr<FJsonValue>> items;
+	TSharedRef<TJsonReader<>> ArrayReader = TJsonReaderFactory<>::Create(_abi);
+	if (FJsonSerializer::Deserialize(ArrayReader, items))
+	{
+		value = MakeShared<FJsonValueArray>(items);
+	}
+	else
+	{
+		TSharedPtr<FJsonObject> object;
+		TSharedRef<TJsonReader<>> ObjectReader = TJsonReaderFactory<>::Create(_abi);
+		if (!FJsonSerializer::Deserialize(ObjectReader, object) || !object.IsValid())
+		{
+			return _abi;
+		}
+		value = MakeShared<FJsonValueObject>(object);
+	}
+
+	FString canonical;
+	canonical.Reserve(_abi.Len());
+	WriteCanonical(value, canonical);
+	return canonical;
+}
+
+FString AnkrAbiCache::ComputeHash(const FString& _abi)
+{
+	FTCHARToUTF8 canonical(*Canonicalize(_abi));
+	return FMD5::HashBytes((const uint8*)canonical.Get(), canonical.Length()).ToLower();
+}
+
+bool AnkrAbiCache::IsLocalHashing()
+{
+	return CVarLocalAbiHash.GetValueOnAnyThread();
+}
+
+void AnkrAbiCache::SetLocalHashing(bool _enabled)
+{
+	CVarLocalAbiHash->Set(_enabled, ECVF_SetByCode);
+}
+
+void AnkrAbiCache::RememberLocalHash(const FString& _abiHash, const FString& _abi)
+{
+	FScopeLock lock(&CacheLock);
+	LocalAbis.Add(_abiHash, _abi);
+}
+
+bool AnkrAbiCache::FindLocalAbi(const FString& _abiHash, FString& _abi)
+{
+	FScopeLock lock(&CacheLock);
+
+	const FString* abi = LocalAbis.Find(_abiHash);
+	if (abi == nullptr || Aliases.Contains(_abiHash))
+	{
+		return false;
+	}
+
+	_abi = *abi;
+	return true;
+}
+
+bool AnkrAbiCache::TakeLocalAbi(const FString& _abiHash, FString& _abi)
+{
+	FScopeLock lock(&CacheLock);
+	return LocalAbis.RemoveAndCopyValue(_abiHash, _abi);
+}
+
+void AnkrAbiCache::SetAlias(const FString& _localHash, const FString& _abiHash)
+{
+	if (_localHash.Equals(_abiHash))
+	{
+		return;
+	}
+
+	FScopeLock lock(&CacheLock);
+	Aliases.Add(_localHash, _abiHash);
+}
+
+FString AnkrAbiCache::Resolve(const FString& _abiHash)
+{
+	FScopeLock lock(&CacheLock);
+
+	const FString* alias = Aliases.Find(_abiHash);
+	return alias != nullptr ? *alias : _abiHash;
+}
+
+FString AnkrAbiCache::GetCachePath()
+{
+	return FPaths::ProjectSavedDir() + FString("AnkrSDK/AbiHashCache.log");
+}
+
+// GetDigest hashes the ABI as UTF-8 together with the API url, the development and production APIs hand out their own hashes.
+FString AnkrAbiCache::GetDigest(const FString& _abi)
+{
+	FTCHARToUTF8 url(*AnkrUtility::GetUrl());
+	FTCHARToUTF8 abi(*_abi);
+
+	FSHA1 sha;
+	sha.Update((const uint8*)url.Get(), url.Length());
+	sha.Update((const uint8*)abi.Get(), abi.Length());
+	sha.Final();
+
+	uint8 hash[FSHA1::DigestSize];
+	sha.GetHash(hash);
+	return BytesToHex(hash, FSHA1::DigestSize);
+}
+
+bool AnkrAbiCache::Find(const FString& _abi, FString& _abiHash)
+{
+	const FString digest = GetDigest(_abi);
+
+	FScopeLock lock(&CacheLock);
+	Load();
+
+	const FString* abiHash = AbiHashes.Find(digest);
+	if (abiHash == nullptr)
+	{
+		return false;
+	}
+
+	_abiHash = *abiHash;
+	return true;
+}
+
+void AnkrAbiCache::Store(const FString& _abi, const FString& _abiHash)
+{
+	if (_abiHash.IsEmpty())
+	{
+		return;
+	}
+
+	FAnkrAbiCacheEntry entry{};
+	entry.digest	= GetDigest(_abi);
+	entry.abi_hash	= _abiHash;
+	entry.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+
+	FScopeLock lock(&CacheLock);
+	Load();
+
+	// The hash was just returned by the Ankr API, it needs no validation.
+	ValidatedHashes.Add(_abiHash);
+
+	const FString* current = AbiHashes.Find(entry.digest);
+	if (current != nullptr && current->Equals(_abiHash))
+	{
+		return;
+	}
+
+	AbiHashes.Add(entry.digest, _abiHash);
+	Append(entry);
+}
+
+// Validate only looks at the first response for a hash in a session, the Ankr API answers with "result" false and a message about the abi when it does not know the hash.
+bool AnkrAbiCache::Validate(const FString& _abiHash, const FString& _content)
+{
+	{
+		FScopeLock lock(&CacheLock);
+		if (ValidatedHashes.Contains(_abiHash))
+		{
+			return false;
+		}
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(_content);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	bool result = true;
+	JsonObject->TryGetBoolField("result", result);
+
+	FString message;
+	if (!JsonObject->TryGetStringField("msg", message))
+	{
+		JsonObject->TryGetStringField("error", message);
+	}
+
+	if (!result && message.Contains("abi", ESearchCase::IgnoreCase))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AnkrAbiCache - Validate - %s was rejected, it is removed from the cache: %s"), *_abiHash, *message);
+		Invalidate(_abiHash);
+		return true;
+	}
+
+	if (result)
+	{
+		// A local hash the Ankr API accepted is as good as an uploaded one.
+		FString abi;
+		if (FindLocalAbi(_abiHash, abi))
+		{
+			Store(abi, _abiHash);
+		}
+
+		FScopeLock lock(&CacheLock);
+		ValidatedHashes.Add(_abiHash);
+	}
+	return false;
+}
+
+void AnkrAbiCache::Invalidate(const FString& _abiHash)
+{
+	FScopeLock lock(&CacheLock);
+	Load();
+
+	ValidatedHashes.Remove(_abiHash);
+
+	TArray<FString> digests;
+	for (const TPair<FString, FString>& pair : AbiHashes)
+	{
+		if (pair.Value.Equals(_abiHash))
+		{
+			digests.Add(pair.Key);
+		}
+	}
+
+	for (const FString& digest : digests)
+	{
+		AbiHashes.Remove(digest);
+
+		FAnkrAbiCacheEntry entry{};
+		entry.digest	= digest;
+		entry.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+		Append(entry);
+	}
+}
+
+// Reload forgets the hashes validated in this session as well, the local hashes and their aliases are kept.
+void AnkrAbiCache::Reload()
+{
+	FScopeLock lock(&CacheLock);
+
+	AbiHashes.Reset();
+	ValidatedHashes.Reset();
+
+	IsLoaded = false;
+	Load();
+}
+
+// Load folds the cache file into the map, it must be called with the cache lock held.
+// The file is rewritten with a single line per digest when it holds removed or replaced entries.
+void AnkrAbiCache::Load()
+{
+	if (IsLoaded)
+	{
+		return;
+	}
+	IsLoaded = true;
+
+	TArray<FString> lines;
+	if (!FFileHelper::LoadFileToStringArray(lines, *GetCachePath()))
+	{
+		return;
+	}
+
+	for (const FString& line : lines)
+	{
+		if (line.IsEmpty())
+		{
+			continue;
+		}
+
+		FAnkrAbiCacheEntry entry = FAnkrAbiCacheEntry::FromJson(line);
+		if (entry.abi_hash.IsEmpty())
+		{
+			AbiHashes.Remove(entry.digest);
+		}
+		else
+		{
+			AbiHashes.Add(entry.digest, entry.abi_hash);
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("AnkrAbiCache - Load - %d abi hash(es) loaded from %s."), AbiHashes.Num(), *GetCachePath());
+
+	if (lines.Num() > AbiHashes.Num())
+	{
+		FString content;
+		for (const TPair<FString, FString>& pair : AbiHashes)
+		{
+			FAnkrAbiCacheEntry entry{};
+			entry.digest	= pair.Key;
+			entry.abi_hash	= pair.Value;
+			entry.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+			content += FAnkrAbiCacheEntry::ToJson(entry) + TEXT("\n");
+		}
+		FFileHelper::SaveStringToFile(content, *GetCachePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+}
+
+void AnkrAbiCache::Append(const FAnkrAbiCacheEntry& _entry)
+{
+	const FString line = FAnkrAbiCacheEntry::ToJson(_entry) + TEXT("\n");
+	if (!FFileHelper::SaveStringToFile(line, *GetCachePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AnkrAbiCache - Append - Couldn't write the cache at %s"), *GetCachePath());
+	}
+}
@@ -0,0 +1,105 @@
+#include "AnkrCallDispatcher.h"
+#include "HAL/IConsoleManager.h"
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+#endif
+
+namespace
+{
+	FAnkrCallDispatcher* Instance = nullptr;
+
+	TAutoConsoleVariable<float> CVarCallDispatchBudget(
+		TEXT("Ankr.CallDispatchBudgetMs"),
+		1.0f,
+		TEXT("The time in milliseconds the completions of native calls can take on the game thread per frame."),
+		ECVF_Default);
+}
+
+FAnkrCallDispatcher::FAnkrCallDispatcher()
+{
+	Instance = this;
+}
+
+FAnkrCallDispatcher::~FAnkrCallDispatcher()
+{
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+}
+
+FAnkrCallDispatcher* FAnkrCallDispatcher::Get()
+{
+	return Instance;
+}
+
+void FAnkrCallDispatcher::SetFrameBudget(float _milliseconds)
+{
+	CVarCallDispatchBudget->Set(FMath::Max(_milliseconds, 0.0f), ECVF_SetByCode);
+}
+
+float FAnkrCallDispatcher::GetFrameBudget() const
+{
+	return CVarCallDispatchBudget.GetValueOnGameThread();
+}
+
+FAnkrCallDispatchStats FAnkrCallDispatcher::GetStats() const
+{
+	FAnkrCallDispatchStats stats = Stats;
+	stats.frameBudgetMs = GetFrameBudget();
+
+#if ANKR_WITH_NATIVE_LIBRARY
+	stats.queueDepth   = LibraryManager::GetInstance().CallQueue.Num();
+	stats.pendingCalls = LibraryManager::GetInstance().CallList.Num();
+#endif
+
+	return stats;
+}
+
+// Tick dispatches the completions until the budget of the frame runs out, the first completion is always dispatched so the queue keeps moving.
+void FAnkrCallDispatcher::Tick(float DeltaTime)
+{
+	Stats.dispatchedLastFrame = 0;
+
+#if ANKR_WITH_NATIVE_LIBRARY
+	AnkrCompletionQueue<FAnkrCallStruct>& queue = LibraryManager::GetInstance().CallQueue;
+	if (queue.IsEmpty())
+	{
+		Stats.lastFrameMs = 0.0f;
+		return;
+	}
+
+	const double start	= FPlatformTime::Seconds();
+	const double budget = GetFrameBudget() / 1000.0;
+
+	FAnkrCallStruct call{};
+	while (queue.Pop(call))
+	{
+		call.Execute();
+		Stats.dispatchedLastFrame++;
+
+		if (FPlatformTime::Seconds() - start >= budget)
+		{
+			break;
+		}
+	}
+
+	const float elapsed = (float)((FPlatformTime::Seconds() - start) * 1000.0);
+
+	Stats.totalDispatched += Stats.dispatchedLastFrame;
+	Stats.lastFrameMs	   = elapsed;
+	Stats.maxFrameMs	   = FMath::Max(Stats.maxFrameMs, elapsed);
+	Stats.averageFrameMs   = Stats.averageFrameMs <= 0.0f ? elapsed : FMath::Lerp(Stats.averageFrameMs, elapsed, 0.1f);
+
+	if (!queue.IsEmpty())
+	{
+		Stats.carriedOverFrames++;
+	}
+#endif
+}
+
+TStatId FAnkrCallDispatcher::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FAnkrCallDispatcher, STATGROUP_Tickables);
+}
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// AnkrCompletionQueue is a bounded lock-free multi-producer single-consumer queue for the completions of native calls.
+///
+/// Native libraries invoke their callbacks on threads of their own, those threads only push here and the game thread is the single consumer.\n
+/// Every cell carries a sequence number that tells producers and the consumer whose turn it is, so a push is one compare-and-swap and a pop is lock free.\n
+/// When the ring is full the completion is kept in an overflow list guarded by a mutex instead of being dropped.
+template<typename T>
+class AnkrCompletionQueue
+{
+
+public:
+
+	explicit AnkrCompletionQueue(size_t _capacity = 1024)
+	{
+		size_t capacity = 2;
+		while (capacity < _capacity) capacity <<= 1;
+
+		mask  = capacity - 1;
+		cells = std::unique_ptr<Cell[]>(new Cell[capacity]);
+		for (size_t i = 0; i < capacity; i++)
+		{
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	AnkrCompletionQueue(AnkrCompletionQueue const&) = delete;
+	void operator = (AnkrCompletionQueue const&) = delete;
+
+	/// Pushes a completion, it can be called from any thread.
+	void Push(T _item)
+	{
+		depth.fetch_add(1, std::memory_order_relaxed);
+		if (!TryPushRing(_item))
+		{
+			std::lock_guard<std::mutex> lock(overflowLock);
+			overflow.push_back(std::move(_item));
+			hasOverflow.store(true, std::memory_order_release);
+		}
+	}
+
+	/// Pops a completion, it must only be called from the consumer thread.
+	bool Pop(T& _item)
+	{
+		if (TryPopRing(_item) || TryPopOverflow(_item))
+		{
+			depth.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	/// The number of completions waiting, it is approximate while producers are pushing.
+	int Num() const
+	{
+		return depth.load(std::memory_order_relaxed);
+	}
+
+	bool IsEmpty() const
+	{
+		return Num() <= 0;
+	}
+
+private:
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T item;
+	};
+
+	bool TryPushRing(T& _item)
+	{
+		size_t position = enqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = cells[position & mask];
+			const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+			if (difference == 0)
+			{
+				if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell.item = std::move(_item);
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	bool TryPopRing(T& _item)
+	{
+		Cell& cell = cells[dequeuePosition & mask];
+		const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		if ((intptr_t)sequence - (intptr_t)(dequeuePosition + 1) < 0)
+		{
+			return false;
+		}
+
+		_item = std::move(cell.item);
+		cell.item = T();
+		cell.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+		dequeuePosition++;
+		return true;
+	}
+
+	bool TryPopOverflow(T& _item)
+	{
+		if (!hasOverflow.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(overflowLock);
+		if (overflow.empty())
+		{
+			hasOverflow.store(false, std::memory_order_release);
+			return false;
+		}
+
+		_item = std::move(overflow.front());
+		overflow.pop_front();
+		hasOverflow.store(!overflow.empty(), std::memory_order_release);
+		return true;
+	}
+
+	std::unique_ptr<Cell[]> cells;
+	size_t mask = 0;
+
+	alignas(64) std::atomic<size_t> enqueuePosition{ 0 };
+	alignas(64) size_t dequeuePosition = 0;
+	alignas(64) std::atomic<int> depth{ 0 };
+
+	std::mutex overflowLock;
+	std::deque<T> overflow;
+	std::atomic<bool> hasOverflow{ false };
+};
+
+/// AnkrPendingCallTable holds the native calls that are waiting for their callback, it can be accessed from any thread.
+///
+/// Calls are keyed by their call index so any number of calls of the same kind can be in flight.\n
+/// Every call also belongs to a group, the name of its sender, and the calls of a group are kept in the order they were added.\n
+/// Native libraries that can not hand the call index back report the sender only, their calls go through AnkrSenderCallQueue so the call index is known.
+template<typename K, typename T>
+class AnkrPendingCallTable
+{
+
+public:
+
+	/// Adds a call, it fails when a call with the same key is already pending.
+	bool Add(const K& _key, const std::string& _group, T _call)
+	{
+		std::lock_guard<std::mutex> lock(tableLock);
+
+		if (!calls.emplace(_key, PendingCall{ _group, std::move(_call) }).second)
+		{
+			return false;
+		}
+
+		groups[_group].push_back(_key);
+		return true;
+	}
+
+	/// Removes a call and hands it over to the caller.
+	bool Take(const K& _key, T& _call)
+	{
+		std::lock_guard<std::mutex> lock(tableLock);
+
+		auto iterator = calls.find(_key);
+		if (iterator == calls.end())
+		{
+			return false;
+		}
+
+		RemoveFromGroup(iterator->second.group, _key);
+		_call = std::move(iterator->second.call);
+		calls.erase(iterator);
+		return true;
+	}
+
+	/// Removes the oldest call of a group and hands it over to the caller.
+	bool TakeOldest(const std::string& _group, T& _call)
+	{
+		std::lock_guard<std::mutex> lock(tableLock);
+
+		auto group = groups.find(_group);
+		if (group == groups.end() || group->second.empty())
+		{
+			return false;
+		}
+
+		const K key = group->second.front();
+		group->second.pop_front();
+		if (group->second.empty())
+		{
+			groups.erase(group);
+		}
+
+		auto iterator = calls.find(key);
+		_call = std::move(iterator->second.call);
+		calls.erase(iterator);
+		return true;
+	}
+
+	bool Contains(const K& _key)
+	{
+		std::lock_guard<std::mutex> lock(tableLock);
+		return calls.count(_key) > 0;
+	}
+
+	int Num()
+	{
+		std::lock_guard<std::mutex> lock(tableLock);
+		return (int)calls.size();
+	}
+
+private:
+
+	struct PendingCall
+	{
+		std::string group;
+		T call;
+	};
+
+	void RemoveFromGroup(const std::string& _group, const K& _key)
+	{
+		auto group = groups.find(_group);
+		if (group == groups.end())
+		{
+			return;
+		}
+
+		for (auto key = group->second.begin(); key != group->second.end(); ++key)
+		{
+			if (*key == _key)
+			{
+				group->second.erase(key);
+				break;
+			}
+		}
+
+		if (group->second.empty())
+		{
+			groups.erase(group);
+		}
+	}
+
+	std::mutex tableLock;
+	std::unordered_map<K, PendingCall> calls;
+	std::unordered_map<std::string, std::deque<K>> groups;
+};
+
+/// AnkrSenderCallQueue keeps a single call per sender in flight for the native exports that report only the sender with their callback.
+///
+/// Such a callback can't tell which call it completes when several calls of the sender are in flight and may complete out of order.\n
+/// The calls of a sender wait here instead and the next one is sent once the call in flight completed, so every callback is matched to its call index.
+class AnkrSenderCallQueue
+{
+
+public:
+
+	/// Queues a call, it returns whether the call must be sent now because no call of the sender is in flight.
+	bool Send(const std::string& _sender, int _callIndex, std::function<void()> _send)
+	{
+		std::lock_guard<std::mutex> lock(queueLock);
+
+		Sender& sender = senders[_sender];
+		if (sender.isInFlight)
+		{
+			sender.waiting.push_back({ _callIndex, std::move(_send) });
+			return false;
+		}
+
+		sender.isInFlight = true;
+		sender.callIndex  = _callIndex;
+		return true;
+	}
+
+	/// Completes the call in flight of a sender, the next call of the sender is handed over to be sent by the caller outside of the lock.
+	///
+	/// @returns Whether the sender had a call in flight.
+	bool Complete(const std::string& _sender, int& _callIndex, std::function<void()>& _next)
+	{
+		std::lock_guard<std::mutex> lock(queueLock);
+
+		auto iterator = senders.find(_sender);
+		if (iterator == senders.end() || !iterator->second.isInFlight)
+		{
+			return false;
+		}
+
+		Sender& sender = iterator->second;
+		_callIndex = sender.callIndex;
+
+		if (sender.waiting.empty())
+		{
+			senders.erase(iterator);
+			return true;
+		}
+
+		sender.callIndex = sender.waiting.front().first;
+		_next			 = std::move(sender.waiting.front().second);
+		sender.waiting.pop_front();
+		return true;
+	}
+
+private:
+
+	struct Sender
+	{
+		bool isInFlight = false;
+		int callIndex	= -1;
+		std::deque<std::pair<int, std::function<void()>>> waiting;
+	};
+
+	std::mutex queueLock;
+	std::unordered_map<std::string, Sender> senders;
+};
+
+/// AnkrNativeRequest is one request of a batch that is submitted to the native library in a single call.
+///
+/// The call must be added with LibraryManager::AddCall first, the method is the name of the export, e.g. "CallMethod", "SendTransaction" or "GetResult".
+struct AnkrNativeRequest
+{
+	int callIndex = -1;
+	std::string method;
+	std::string content;
+};
+
+/// Sends the requests of a batch one by one, it is used when the native library has no batch export.
+template<typename TLibraryManager>
+void AnkrSubmitEach(TLibraryManager& _library, const std::vector<AnkrNativeRequest>& _requests)
+{
+	for (const AnkrNativeRequest& request : _requests)
+	{
+		if		(request.method == "CallMethod")	  _library.CallMethod(request.callIndex, request.content);
+		else if (request.method == "SendTransaction") _library.SendTransaction(request.callIndex, request.content);
+		else if (request.method == "GetResult")		  _library.GetResult(request.callIndex, request.content);
+		else if (request.method == "SendABI")		  _library.SendABI(request.callIndex, request.content);
+		else if (request.method == "SignMessage")	  _library.SignMessage(request.callIndex, request.content);
+		else if (request.method == "VerifyMessage")	  _library.VerifyMessage(request.callIndex, request.content);
+		else if (request.method == "ConnectWallet")	  _library.ConnectWallet(request.callIndex, request.content);
+		else if (request.method == "GetWallet")		  _library.GetWallet(request.callIndex, request.content);
+		else										  _library.FlushCall(request.callIndex, false, "Unknown method.");
+	}
+}
@@ -0,0 +1,153 @@
+#include "AnkrCallbackThread.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+
+namespace
+{
+	// The thread chosen by the innermost FAnkrCallbackThreadScope, -1 when no scope is active.
+	thread_local int ScopedCallbackThread = -1;
+
+	// FAnkrTaskThread runs the functions queued for TaskThread one after the other on its own thread.
+	class FAnkrTaskThread : public FRunnable
+	{
+
+	public:
+
+		FAnkrTaskThread()
+		{
+			WorkEvent = FPlatformProcess::GetSynchEventFromPool();
+			Thread	  = FRunnableThread::Create(this, TEXT("AnkrCallbackThread"));
+		}
+
+		virtual ~FAnkrTaskThread() override
+		{
+			Stop();
+			if (Thread != nullptr)
+			{
+				Thread->WaitForCompletion();
+				delete Thread;
+			}
+			FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		}
+
+		void Enqueue(TFunction<void()> _function)
+		{
+			Functions.Enqueue(MoveTemp(_function));
+			WorkEvent->Trigger();
+		}
+
+		virtual uint32 Run() override
+		{
+			while (!bIsStopping)
+			{
+				TFunction<void()> function;
+				while (!bIsStopping && Functions.Dequeue(function))
+				{
+					function();
+				}
+				WorkEvent->Wait();
+			}
+			return 0;
+		}
+
+		virtual void Stop() override
+		{
+			bIsStopping = true;
+			WorkEvent->Trigger();
+		}
+
+	private:
+
+		TQueue<TFunction<void()>, EQueueMode::Mpsc> Functions;
+		FEvent* WorkEvent		= nullptr;
+		FRunnableThread* Thread	= nullptr;
+		TAtomic<bool> bIsStopping{ false };
+	};
+
+	FCriticalSection TaskThreadLock;
+	TUniquePtr<FAnkrTaskThread> TaskThread;
+
+	// The thread is started by the first function queued for it.
+	void EnqueueOnTaskThread(TFunction<void()> _function)
+	{
+		FScopeLock lock(&TaskThreadLock);
+		if (!TaskThread.IsValid())
+		{
+			TaskThread = MakeUnique<FAnkrTaskThread>();
+		}
+		TaskThread->Enqueue(MoveTemp(_function));
+	}
+}
+
+EAnkrCallbackThread AnkrCallbackThread::Resolve(EAnkrCallbackThread _default)
+{
+	return ScopedCallbackThread < 0 ? _default : (EAnkrCallbackThread)ScopedCallbackThread;
+}
+
+void AnkrCallbackThread::Run(EAnkrCallbackThread _thread, TFunction<void()> _function)
+{
+	switch (_thread)
+	{
+		case EAnkrCallbackThread::CompletionThread:
+			_function();
+			break;
+
+		case EAnkrCallbackThread::BackgroundThread:
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, MoveTemp(_function));
+			break;
+
+		case EAnkrCallbackThread::TaskThread:
+			EnqueueOnTaskThread(MoveTemp(_function));
+			break;
+
+		default:
+			if (IsInGameThread())
+			{
+				_function();
+				break;
+			}
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(_function));
+			break;
+	}
+}
+
+void AnkrCallbackThread::Execute(EAnkrCallbackThread _thread, const FAnkrCallResult& _result, FString _response, FString _data, FString _optionalData, int _optionalCode, bool _optionalBool)
+{
+	if (_result.Native.IsBound())
+	{
+		const FAnkrCallCompleteDelegate native = _result.Native;
+		Run(_thread, [native, _response, _data, _optionalData, _optionalCode, _optionalBool]()
+			{
+				native.ExecuteIfBound(_response, _data, _optionalData, _optionalCode, _optionalBool);
+			});
+	}
+
+	// A dynamic delegate can call Blueprint code, it is never executed off the game thread.
+	if (_result.Dynamic.IsBound())
+	{
+		const FAnkrCallCompleteDynamicDelegate dynamic = _result.Dynamic;
+		Run(EAnkrCallbackThread::GameThread, [dynamic, _response, _data, _optionalData, _optionalCode, _optionalBool]()
+			{
+				dynamic.ExecuteIfBound(_response, _data, _optionalData, _optionalCode, _optionalBool);
+			});
+	}
+}
+
+void AnkrCallbackThread::Shutdown()
+{
+	FScopeLock lock(&TaskThreadLock);
+	TaskThread.Reset();
+}
+
+FAnkrCallbackThreadScope::FAnkrCallbackThreadScope(EAnkrCallbackThread _thread)
+{
+	previous			 = ScopedCallbackThread;
+	ScopedCallbackThread = (int)_thread;
+}
+
+FAnkrCallbackThreadScope::~FAnkrCallbackThreadScope()
+{
+	ScopedCallbackThread = previous;
+}
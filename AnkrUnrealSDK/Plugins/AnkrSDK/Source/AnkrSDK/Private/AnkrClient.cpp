@@ -1,6 +1,17 @@
 #include "AnkrClient.h"
 #include "AnkrSaveGame.h"
 #include "AnkrUtility.h"
+#include "AnkrTransport.h"
+#include "AnkrJournal.h"
+#include "AnkrAbiCache.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrAbi.h"
+#include "AnkrMulticall.h"
+#include "AnkrSignature.h"
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+#endif
 
 // First of all a deviceId is generated and saved for the user. Secondly updateNFTExample and wearableNFTExample objects are instantiated.
 UAnkrClient::UAnkrClient(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -14,20 +25,42 @@ UAnkrClient::UAnkrClient(const FObjectInitializer& ObjectInitializer) : Super(Ob
 	deviceId = load->UniqueId;
 	UE_LOG(LogTemp, Warning, TEXT("AnkrClient - AnkrSDK will use device id: %s."), *deviceId);
 
-	if (updateNFTExample == nullptr)
-	{
-		updateNFTExample = NewObject<UUpdateNFTExample>();
-	}
-	if (wearableNFTExample == nullptr)
+	// The class default object is never connected, only the instances own examples.
+	if (!HasAnyFlags(RF_ClassDefaultObject))
 	{
-		wearableNFTExample = NewObject<UWearableNFTExample>();
+		if (updateNFTExample == nullptr)
+		{
+			updateNFTExample = NewObject<UUpdateNFTExample>();
+		}
+		if (wearableNFTExample == nullptr)
+		{
+			wearableNFTExample = NewObject<UWearableNFTExample>();
+		}
+		if (advertisementManager == nullptr)
+		{
+			advertisementManager = NewObject<UAdvertisementManager>();
+		}
 	}
-	if (advertisementManager == nullptr)
+
+	AnkrUtility::SetDevelopment(true);
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
 	{
-		advertisementManager = NewObject<UAdvertisementManager>();
+		hndl_AppHasEnteredForeground = FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddUObject(this, &UAnkrClient::OnApplicationResume);
 	}
+}
 
-	AnkrUtility::SetDevelopment(true);
+void UAnkrClient::BeginDestroy()
+{
+	FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(hndl_AppHasEnteredForeground);
+
+	Super::BeginDestroy();
+}
+
+// GetCallbackThread resolves the thread for the call that is being made, a FAnkrCallbackThreadScope on the calling thread wins over the client setting.
+EAnkrCallbackThread UAnkrClient::GetCallbackThread() const
+{
+	return AnkrCallbackThread::Resolve(callbackThread);
 }
 
 // Ping is to make sure if we can ping the Ankr API.
@@ -40,19 +73,21 @@ void UAnkrClient::Ping(const FAnkrCallCompleteDynamicDelegate& Result)
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - Ping: %s"), *content);
 
-			Result.ExecuteIfBound(content, "", "", -1, false);
+			AnkrCallbackThread::Execute(callbackThread, Result, content, "", "", -1, false);
 		});
 
 	FString url = AnkrUtility::GetUrl() + ENDPOINT_PING;
 	Request->SetURL(url);
 	Request->SetVerb("GET");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // ConnectWallet is used to connect wallet (Metamask). 
@@ -66,15 +101,23 @@ void UAnkrClient::ConnectWallet(const FAnkrCallCompleteDynamicDelegate& Result)
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread, weakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
+			UAnkrClient* client = weakThis.Get();
+			if (client == nullptr)
+			{
+				return;
+			}
+
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - ConnectWallet - GetContentAsString: %s"), *content);
 
 			TSharedPtr<FJsonObject> JsonObject;
 			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
 
-			needLogin = false;
+			client->needLogin = false;
 			if (FJsonSerializer::Deserialize(Reader, JsonObject))
 			{
 				bool result = JsonObject->GetBoolField("result");
@@ -82,14 +125,14 @@ void UAnkrClient::ConnectWallet(const FAnkrCallCompleteDynamicDelegate& Result)
 				{
 					FString recievedUri = JsonObject->GetStringField("uri");
 					FString sessionId = JsonObject->GetStringField("session");
-					needLogin = JsonObject->GetBoolField("login");
-					session = sessionId;
-					walletConnectDeeplink = recievedUri;
+					client->needLogin = JsonObject->GetBoolField("login");
+					client->session = sessionId;
+					client->walletConnectDeeplink = recievedUri;
 
-					updateNFTExample->Init(deviceId, session);
-					wearableNFTExample->Init(deviceId, session);
+					client->updateNFTExample->Init(client->deviceId, client->session);
+					client->wearableNFTExample->Init(client->deviceId, client->session);
 
-					if (needLogin)
+					if (client->needLogin)
 					{
 #if PLATFORM_ANDROID || PLATFORM_IOS
 						AnkrUtility::SetLastRequest("ConnectWallet");
@@ -97,7 +140,7 @@ void UAnkrClient::ConnectWallet(const FAnkrCallCompleteDynamicDelegate& Result)
 #endif
 					}
 
-					Result.ExecuteIfBound(content, "", "", -1, needLogin);
+					AnkrCallbackThread::Execute(callbackThread, Result, content, "", "", -1, client->needLogin);
 				}
 				else
 				{
@@ -116,7 +159,7 @@ void UAnkrClient::ConnectWallet(const FAnkrCallCompleteDynamicDelegate& Result)
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // GetWalletInfo is used to get the connected wallet account and the chainId.
@@ -130,8 +173,16 @@ void UAnkrClient::GetWalletInfo(const FAnkrCallCompleteDynamicDelegate& Result)
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread, weakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
+			UAnkrClient* client = weakThis.Get();
+			if (client == nullptr)
+			{
+				return;
+			}
+
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - GetWalletInfo - GetContentAsString: %s"), *content);
 
@@ -150,16 +201,16 @@ void UAnkrClient::GetWalletInfo(const FAnkrCallCompleteDynamicDelegate& Result)
 					{
 						for (int32 i = 0; i < accountsObject.Num(); i++)
 						{
-							accounts.Add(accountsObject[i]->AsString());
+							client->accounts.Add(accountsObject[i]->AsString());
 						}
 
-						activeAccount = accounts[0];
-						chainId = JsonObject->GetIntegerField("chainId");
+						client->activeAccount = client->accounts[0];
+						client->chainId = JsonObject->GetIntegerField("chainId");
 
-						updateNFTExample->SetAccount(activeAccount, chainId);
-						wearableNFTExample->SetAccount(activeAccount, chainId);
+						client->updateNFTExample->SetAccount(client->activeAccount, client->chainId);
+						client->wearableNFTExample->SetAccount(client->activeAccount, client->chainId);
 
-						data = FString("Active Account: ").Append(activeAccount).Append(" | Chain Id: ").Append(FString::FromInt(chainId));
+						data = FString("Active Account: ").Append(client->activeAccount).Append(" | Chain Id: ").Append(FString::FromInt(client->chainId));
 					}
 					else
 					{
@@ -172,7 +223,7 @@ void UAnkrClient::GetWalletInfo(const FAnkrCallCompleteDynamicDelegate& Result)
 					data = JsonObject->GetStringField("msg");
 				}
 
-				Result.ExecuteIfBound(content, data, "", -1, false);
+				AnkrCallbackThread::Execute(callbackThread, Result, content, data, "", -1, false);
 }
 			else
 			{
@@ -185,7 +236,7 @@ void UAnkrClient::GetWalletInfo(const FAnkrCallCompleteDynamicDelegate& Result)
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // Returns the currently connected wallet address.
@@ -195,7 +246,43 @@ FString UAnkrClient::GetActiveAccount()
 }
 
 // SendABI is used to get the abi hash.
+// The hash of an abi that was uploaded before is answered from the abi cache without a request, with Ankr.LocalAbiHash set the hash of a new abi is computed locally.
 void UAnkrClient::SendABI(FString abi, const FAnkrCallCompleteDynamicDelegate& Result)
+{
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+
+	GetABIHash(abi, callbackThread, [Result, callbackThread](FString content, FString abiHash)
+		{
+			AnkrCallbackThread::Execute(callbackThread, Result, content, abiHash, "", -1, false);
+		});
+}
+
+// GetABIHash answers the hash of an abi from the abi cache, computes it locally with Ankr.LocalAbiHash set or uploads the abi.
+void UAnkrClient::GetABIHash(FString abi, EAnkrCallbackThread callbackThread, TFunction<void(FString, FString)> Callback)
+{
+	FString cachedHash;
+	if (AnkrAbiCache::Find(abi, cachedHash))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AnkrClient - SendABI - %s is answered from the abi cache."), *cachedHash);
+		Callback("{\"result\": true, \"abi\": \"" + cachedHash + "\"}", cachedHash);
+		return;
+	}
+
+	if (AnkrAbiCache::IsLocalHashing())
+	{
+		const FString localHash = AnkrAbiCache::ComputeHash(abi);
+		AnkrAbiCache::RememberLocalHash(localHash, abi);
+
+		UE_LOG(LogTemp, Warning, TEXT("AnkrClient - SendABI - %s is computed locally, the abi is registered only if the Ankr API does not know it."), *localHash);
+		Callback("{\"result\": true, \"abi\": \"" + localHash + "\"}", localHash);
+		return;
+	}
+
+	UploadABI(abi, callbackThread, Callback);
+}
+
+// UploadABI sends the abi to the Ankr API and stores the hash it returns in the abi cache.
+void UAnkrClient::UploadABI(FString abi, EAnkrCallbackThread callbackThread, TFunction<void(FString, FString)> Callback)
 {
 	http = &FHttpModule::Get();
 
@@ -204,7 +291,8 @@ void UAnkrClient::SendABI(FString abi, const FAnkrCallCompleteDynamicDelegate& R
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Callback, abi](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - SendABI - GetContentAsString: %s"), *content);
@@ -212,10 +300,15 @@ void UAnkrClient::SendABI(FString abi, const FAnkrCallCompleteDynamicDelegate& R
 			TSharedPtr<FJsonObject> JsonObject;
 			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
 
-			FString data = content;
 			if (FJsonSerializer::Deserialize(Reader, JsonObject))
 			{
-				Result.ExecuteIfBound(content, JsonObject->GetStringField("abi"), "", -1, false);
+				FString abiHash = JsonObject->GetStringField("abi");
+				if (bWasSuccessful)
+				{
+					AnkrAbiCache::Store(abi, abiHash);
+				}
+
+				Callback(content, abiHash);
 			}
 			else
 			{
@@ -232,24 +325,114 @@ void UAnkrClient::SendABI(FString abi, const FAnkrCallCompleteDynamicDelegate& R
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString(body);
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
+}
+
+// RegisterRejectedABI registers the abi of a local hash that the Ankr API rejected, Retry is called with the hash the Ankr API returned.
+// A local hash is registered once, if the registration fails Retry is called with the local hash and the rejection reaches the caller.
+// Retry runs on the game thread inside a FAnkrCallbackThreadScope of the callback thread of the rejected call, so the retried call delivers its result where the caller asked for it.
+// It is called from the completion of the rejected request, which can run on the HTTP thread, so the upload is started from the game thread where the client is written.
+bool UAnkrClient::RegisterRejectedABI(FString abi_hash, FString content, EAnkrCallbackThread callbackThread, TFunction<void(FString)> Retry)
+{
+	FString abi;
+	if (!AnkrAbiCache::Validate(abi_hash, content) || !AnkrAbiCache::TakeLocalAbi(abi_hash, abi))
+	{
+		return false;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("AnkrClient - RegisterRejectedABI - %s is not known by the Ankr API, the abi is registered."), *abi_hash);
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	AnkrCallbackThread::Run(EAnkrCallbackThread::GameThread, [weakThis, abi, abi_hash, callbackThread, Retry]()
+		{
+			UAnkrClient* client = weakThis.Get();
+			if (client == nullptr)
+			{
+				return;
+			}
+
+			client->UploadABI(abi, EAnkrCallbackThread::GameThread, [abi_hash, callbackThread, Retry](FString response, FString abiHash)
+				{
+					AnkrAbiCache::SetAlias(abi_hash, abiHash);
+
+					const FString retryHash = abiHash.IsEmpty() ? abi_hash : abiHash;
+					AnkrCallbackThread::Run(EAnkrCallbackThread::GameThread, [callbackThread, Retry, retryHash]()
+						{
+							FAnkrCallbackThreadScope scope(callbackThread);
+							Retry(retryHash);
+						});
+				});
+		});
+	return true;
+}
+
+// ValidateArguments checks the arguments of a method locally when the contract is registered, the request keeps the arguments as the caller wrote them.
+bool UAnkrClient::ValidateArguments(const FString& contract, const FString& method, const FString& args, FString& error)
+{
+	FAnkrContractPtr Contract = AnkrContractRegistry::FindByAddress(contract);
+	if (!Contract.IsValid())
+	{
+		return true;
+	}
+
+	FString normalizedArgs;
+	return Contract->ValidateArguments(method, args, normalizedArgs, error);
 }
 
 // SendTransaction is used to send a trasaction provided that the paramters are entered correctly.
 void UAnkrClient::SendTransaction(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallCompleteDynamicDelegate& Result)
 {
-	http = &FHttpModule::Get();
+	RequestSendTransaction(contract, abi_hash, method, args, Result);
+}
+
+void UAnkrClient::SendTransaction(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallCompleteDelegate& Result)
+{
+	RequestSendTransaction(contract, abi_hash, method, args, Result);
+}
+
+void UAnkrClient::RequestSendTransaction(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallResult& Result)
+{
+	http	 = &FHttpModule::Get();
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+
+	FString error;
+	if (!ValidateArguments(contract, method, args, error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AnkrClient - SendTransaction - %s"), *error);
+		AnkrCallbackThread::Execute(callbackThread, Result, "{\"result\":false,\"msg\":\"" + error.ReplaceCharWithEscapedChar() + "\"}", error, "", -1, false);
+		return;
+	}
+
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::SendTransaction);
+	const FString walletSession = session;
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread, context, contract, abi_hash, method, args, walletSession, weakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - SendTransaction - GetContentAsString: %s"), *content);
 
+			UAnkrClient* client = weakThis.Get();
+			if (client != nullptr && client->RegisterRejectedABI(abi_hash, content, callbackThread, [weakThis, contract, method, args, Result](FString abiHash)
+				{
+					UAnkrClient* retryClient = weakThis.Get();
+					if (retryClient != nullptr)
+					{
+						retryClient->RequestSendTransaction(contract, abiHash, method, args, Result);
+					}
+				}))
+			{
+				AnkrJournal::Discard(context.requestId);
+				return;
+			}
+
 			TSharedPtr<FJsonObject> JsonObject;
 			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
 
@@ -258,10 +441,11 @@ void UAnkrClient::SendTransaction(FString contract, FString abi_hash, FString me
 			{
 				FString ticketId = JsonObject->GetStringField("ticket");
 				data = ticketId;
+				AnkrJournal::RecordResponse(context.requestId, ticketId);
 
 #if PLATFORM_ANDROID || PLATFORM_IOS
 				AnkrUtility::SetLastRequest("SendTransaction");
-				FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
+				FPlatformProcess::LaunchURL(walletSession.GetCharArray().GetData(), NULL, NULL);
 #endif
 			}
 			else
@@ -269,31 +453,69 @@ void UAnkrClient::SendTransaction(FString contract, FString abi_hash, FString me
 				UE_LOG(LogTemp, Error, TEXT("AnkrClient - SendTransaction - Couldn't get a valid response:\n%s"), *content);
 			}
 
-			Result.ExecuteIfBound(content, data, "", -1, false);
+			AnkrCallbackThread::Execute(callbackThread, Result, content, data, "", -1, false);
 		});
 
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, contract, abi_hash, method, args]()
+	const FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + contract + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + method + "\", \"args\": \"" + args + "\"}";
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Request, context, body, Result, callbackThread]()
 		{
+			FAnkrJournalResponse response = [Result, callbackThread](FString content, FString ticket)
+				{
+					AnkrCallbackThread::Execute(callbackThread, Result, content, ticket.IsEmpty() ? content : ticket, "", -1, false);
+				};
+			if (!AnkrJournal::RecordSubmit(context.requestId, "SendTransaction", body, context, response))
+			{
+				return;
+			}
+
 			FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
 			Request->SetURL(url);
 			Request->SetVerb("POST");
 			Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-			Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + contract + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + method + "\", \"args\": \"" + args + "\"}");
-			Request->ProcessRequest();
+			Request->SetContentAsString(body);
+			AnkrTransport::ProcessRequest(Request);
 		});
 }
 
 // GetTicketResult is used to get the status of the ticket having a 'code' and 'status'.
 // The 'status' shows whether the result for the ticket signed has a success or failure.
 // The 'code' shows a code number related to a specific failure or success.
+// The dynamic delegate is executed on the game thread, the native delegate on the callback thread of the client.
 void UAnkrClient::GetTicketResult(FString ticketId, const FAnkrCallCompleteDynamicDelegate& Result)
+{
+	RequestTicketResult(ticketId, EAnkrCallbackThread::GameThread, [Result](FString content, FString status, FAnkrRequestContext context, int code)
+		{
+			Result.ExecuteIfBound(content, status, FAnkrRequestContext::ToJson(context), code, false);
+		});
+}
+
+void UAnkrClient::GetTicketResult(FString ticketId, const FAnkrCallCompleteDelegate& Result)
+{
+	RequestTicketResult(ticketId, GetCallbackThread(), [Result](FString content, FString status, FAnkrRequestContext context, int code)
+		{
+			Result.ExecuteIfBound(content, status, FAnkrRequestContext::ToJson(context), code, false);
+		});
+}
+
+// GetTicketResultWithContext is used to get the result of a ticket together with the context of the operation that produced it.
+void UAnkrClient::GetTicketResultWithContext(FString ticketId, const FAnkrTicketResultDynamicDelegate& Result)
+{
+	RequestTicketResult(ticketId, EAnkrCallbackThread::GameThread, [Result](FString content, FString status, FAnkrRequestContext context, int code)
+		{
+			Result.ExecuteIfBound(content, status, context, code);
+		});
+}
+
+// RequestTicketResult keeps the context of a final ticket until Callback has consumed it.
+void UAnkrClient::RequestTicketResult(FString ticketId, EAnkrCallbackThread callbackThread, TFunction<void(FString, FString, FAnkrRequestContext, int)> Callback)
 {
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, ticketId, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Callback, callbackThread, ticketId](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - GetTicketResult - GetContentAsString: %s"), *content);
@@ -306,7 +528,20 @@ void UAnkrClient::GetTicketResult(FString ticketId, const FAnkrCallCompleteDynam
 				int code = JsonObject->GetIntegerField("code");
 				FString status = JsonObject->GetStringField("status");
 
-				Result.ExecuteIfBound(content, status, "", code, false);
+				FAnkrRequestContext context;
+				AnkrRequestContext::Find(ticketId, context);
+
+				FString ticketStatus;
+				const bool resolved = AnkrJournal::ResolveTicket(ticketId, JsonObject, ticketStatus);
+
+				AnkrCallbackThread::Run(callbackThread, [Callback, content, status, context, code, resolved, ticketId]()
+					{
+						Callback(content, status, context, code);
+						if (resolved)
+						{
+							AnkrRequestContext::Release(ticketId);
+						}
+					});
 			}
 		});
 
@@ -315,28 +550,202 @@ void UAnkrClient::GetTicketResult(FString ticketId, const FAnkrCallCompleteDynam
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"ticket\": \"" + ticketId + "\" }");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
+}
+
+// RecoverPendingTickets polls every ticket that is still pending in the transaction journal.
+// Requests that never received a ticket can not be recovered, they stay in the journal so the game can decide whether to send them again.
+int UAnkrClient::RecoverPendingTickets()
+{
+	http = &FHttpModule::Get();
+
+	int count = 0;
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	TArray<FAnkrJournalEntry> entries = AnkrJournal::GetPendingEntries();
+	for (const FAnkrJournalEntry& entry : entries)
+	{
+		if (entry.ticket.IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - RecoverPendingTickets - %s request %s has no ticket and can not be recovered."), *entry.sender, *entry.requestId);
+			continue;
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
+#else
+		TSharedRef<IHttpRequest> Request = http->CreateRequest();
+#endif
+		const FString ticketId = entry.ticket;
+		Request->OnProcessRequestComplete().BindLambda([ticketId, weakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+			{
+				if (!bWasSuccessful || !Response.IsValid())
+				{
+					UE_LOG(LogTemp, Warning, TEXT("AnkrClient - RecoverPendingTickets - Couldn't reach the Ankr API for ticket %s, it stays pending."), *ticketId);
+					return;
+				}
+
+				const FString content = Response->GetContentAsString();
+				UE_LOG(LogTemp, Warning, TEXT("AnkrClient - RecoverPendingTickets - GetContentAsString: %s"), *content);
+
+				TSharedPtr<FJsonObject> JsonObject;
+				TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
+
+				FAnkrRequestContext context;
+				AnkrRequestContext::Find(ticketId, context);
+
+				FString status;
+				FString ticketStatus;
+				if (FJsonSerializer::Deserialize(Reader, JsonObject))
+				{
+					status = AnkrJournal::GetTicketStatus(JsonObject);
+					AnkrJournal::ResolveTicket(ticketId, JsonObject, ticketStatus);
+				}
+
+				if (weakThis.IsValid())
+				{
+					weakThis->onTicketRecovered.Broadcast(ticketId, content, status, context);
+				}
+
+				if (!ticketStatus.IsEmpty())
+				{
+					AnkrRequestContext::Release(ticketId);
+				}
+			});
+
+		FString url = AnkrUtility::GetUrl() + ENDPOINT_RESULT;
+		Request->SetURL(url);
+		Request->SetVerb("POST");
+		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
+		Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"ticket\": \"" + ticketId + "\" }");
+		AnkrTransport::ProcessRequest(Request);
+
+		count++;
+	}
+
+	return count;
+}
+
+void UAnkrClient::OnApplicationResume()
+{
+	RecoverPendingTickets();
+}
+
+bool UAnkrClient::GetRequestContext(FString ticket, FAnkrRequestContext& context)
+{
+	return AnkrRequestContext::Find(ticket, context);
+}
+
+bool UAnkrClient::SetRequestCallerData(FString ticket, FString callerData)
+{
+	return AnkrRequestContext::SetCallerData(ticket, callerData);
+}
+
+// Warmup loads the native library on a background thread so the first call does not pay for it.
+void UAnkrClient::Warmup(const FAnkrCallCompleteDynamicDelegate& Result)
+{
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Result]()
+		{
+#if ANKR_WITH_NATIVE_LIBRARY
+			const bool isLoaded = LibraryManager::GetInstance().EnsureLoaded();
+#else
+			const bool isLoaded = false;
+#endif
+			AsyncTask(ENamedThreads::GameThread, [Result, isLoaded]()
+				{
+					Result.ExecuteIfBound("", "", "", -1, isLoaded);
+				});
+		});
+}
+
+// GetCallDispatchStats returns the stats of the dispatcher that drains the completions of native calls.
+FAnkrCallDispatchStats UAnkrClient::GetCallDispatchStats()
+{
+	FAnkrCallDispatcher* dispatcher = FAnkrCallDispatcher::Get();
+	return dispatcher != nullptr ? dispatcher->GetStats() : FAnkrCallDispatchStats();
+}
+
+void UAnkrClient::SetCallDispatchBudget(float milliseconds)
+{
+	FAnkrCallDispatcher* dispatcher = FAnkrCallDispatcher::Get();
+	if (dispatcher != nullptr)
+	{
+		dispatcher->SetFrameBudget(milliseconds);
+	}
+}
+
+// SetMockBackend switches the transport of every request between the HTTP module and the in-process mock backend.
+void UAnkrClient::SetMockBackend(bool enabled, FAnkrMockBackendSettings settings)
+{
+	AnkrTransport::UseMockBackend(enabled, settings);
+}
+
+// SetNativeBackend switches the transport of every request between the HTTP module and the native library, the library is initialized with the device id of the client.
+void UAnkrClient::SetNativeBackend(bool enabled)
+{
+#if ANKR_WITH_NATIVE_LIBRARY
+	if (enabled && LibraryManager::GetInstance().EnsureLoaded())
+	{
+		LibraryManager::GetInstance().Initialize(false, deviceId);
+	}
+#endif
+	AnkrTransport::UseNativeBackend(enabled);
 }
 
 // CallMethod is used to get data from readable functions from the contract provided that the parameters are entered correctly.
 void UAnkrClient::CallMethod(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallCompleteDynamicDelegate& Result)
 {
-	http = &FHttpModule::Get();
+	RequestCallMethod(contract, abi_hash, method, args, Result);
+}
+
+void UAnkrClient::CallMethod(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallCompleteDelegate& Result)
+{
+	RequestCallMethod(contract, abi_hash, method, args, Result);
+}
+
+void UAnkrClient::RequestCallMethod(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallResult& Result)
+{
+	http	 = &FHttpModule::Get();
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+
+	FString error;
+	if (!ValidateArguments(contract, method, args, error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AnkrClient - CallMethod - %s"), *error);
+		AnkrCallbackThread::Execute(callbackThread, Result, "{\"result\":false,\"msg\":\"" + error.ReplaceCharWithEscapedChar() + "\"}", error, "", -1, false);
+		return;
+	}
+
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread, contract, abi_hash, method, args, weakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - CallMethod - GetContentAsString: %s"), *content);
 
+			UAnkrClient* client = weakThis.Get();
+			if (client != nullptr && client->RegisterRejectedABI(abi_hash, content, callbackThread, [weakThis, contract, method, args, Result](FString abiHash)
+				{
+					UAnkrClient* retryClient = weakThis.Get();
+					if (retryClient != nullptr)
+					{
+						retryClient->RequestCallMethod(contract, abiHash, method, args, Result);
+					}
+				}))
+			{
+				return;
+			}
+
 			TSharedPtr<FJsonObject> JsonObject;
 			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
 
-			Result.ExecuteIfBound(content, content, "", -1, false);
+			AnkrCallbackThread::Execute(callbackThread, Result, content, content, "", -1, false);
 		});
 
 	FString url = AnkrUtility::GetUrl() + ENDPOINT_CALL_METHOD;
@@ -344,7 +753,121 @@ void UAnkrClient::CallMethod(FString contract, FString abi_hash, FString method,
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + contract + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + method + "\", \"args\": \"" + args + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
+}
+
+// Multicall encodes the calls locally and sends them as one aggregate3 call once the hash of the Multicall3 abi is known.
+void UAnkrClient::Multicall(TArray<FAnkrMulticallRequest> calls, const FAnkrMulticallCompleteDynamicDelegate& Result)
+{
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+
+	FAnkrAbiValue aggregate;
+	FString error;
+	if (!AnkrMulticall::BuildCalls(calls, aggregate, error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AnkrClient - Multicall - %s"), *error);
+		AnkrCallbackThread::Run(EAnkrCallbackThread::GameThread, [Result, error]() { Result.ExecuteIfBound(TArray<FAnkrMulticallResult>(), error); });
+		return;
+	}
+
+	// The abi hash can arrive on the thread of the upload, the client is only read and the multicall only sent from the game thread.
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	GetABIHash(AnkrContractRegistry::Get(CONTRACT_MULTICALL).GetABI(), callbackThread, [weakThis, calls, aggregate, callbackThread, Result](FString content, FString abiHash)
+		{
+			AnkrCallbackThread::Run(EAnkrCallbackThread::GameThread, [weakThis, calls, aggregate, abiHash, callbackThread, Result]()
+				{
+					UAnkrClient* client = weakThis.Get();
+					if (client != nullptr)
+					{
+						client->SendMulticall(calls, aggregate, abiHash, callbackThread, Result);
+					}
+				});
+		});
+}
+
+// SendMulticall sends the packed calls, the body is serialized as json so the calls are written as an array and not as a quoted string.
+void UAnkrClient::SendMulticall(TArray<FAnkrMulticallRequest> calls, const FAnkrAbiValue& aggregate, FString abi_hash, EAnkrCallbackThread callbackThread, const FAnkrMulticallCompleteDynamicDelegate& Result)
+{
+	http	 = &FHttpModule::Get();
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
+#else
+	TSharedRef<IHttpRequest> Request = http->CreateRequest();
+#endif
+	TWeakObjectPtr<UAnkrClient> weakThis(this);
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread, calls, aggregate, abi_hash, weakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+		{
+			const FString content = Response->GetContentAsString();
+			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - Multicall - GetContentAsString: %s"), *content);
+
+			UAnkrClient* client = weakThis.Get();
+			if (client != nullptr && client->RegisterRejectedABI(abi_hash, content, callbackThread, [weakThis, calls, aggregate, callbackThread, Result](FString abiHash)
+				{
+					UAnkrClient* retryClient = weakThis.Get();
+					if (retryClient != nullptr)
+					{
+						retryClient->SendMulticall(calls, aggregate, abiHash, callbackThread, Result);
+					}
+				}))
+			{
+				return;
+			}
+
+			TArray<FAnkrMulticallResult> results;
+			FString error;
+
+			bool result = false;
+			TSharedPtr<FJsonObject> JsonObject;
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
+			if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject->TryGetBoolField("result", result) || !result)
+			{
+				error = "Couldn't get a valid response: " + content;
+			}
+			else
+			{
+				FString data;
+				const TArray<TSharedPtr<FJsonValue>>* pairs;
+				if (!JsonObject->TryGetStringField("data", data) && JsonObject->TryGetArrayField("data", pairs))
+				{
+					TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&data);
+					FJsonSerializer::Serialize(*pairs, Writer);
+				}
+				if (!AnkrMulticall::ParseResults(calls, data, results, error))
+				{
+					results.Reset();
+				}
+			}
+
+			if (!error.IsEmpty())
+			{
+				UE_LOG(LogTemp, Error, TEXT("AnkrClient - Multicall - %s"), *error);
+			}
+			AnkrCallbackThread::Run(EAnkrCallbackThread::GameThread, [Result, results, error]() { Result.ExecuteIfBound(results, error); });
+		});
+
+	TArray<TSharedPtr<FJsonValue>> args;
+	args.Add(AnkrAbi::ToJsonValue(MULTICALL_CALLS, aggregate));
+
+	TSharedRef<FJsonObject> body = MakeShared<FJsonObject>();
+	body->SetStringField("device_id", deviceId);
+	body->SetStringField("contract_address", AnkrContractRegistry::Get(CONTRACT_MULTICALL).GetAddress());
+	body->SetStringField("abi_hash", abi_hash);
+	body->SetStringField("method", MULTICALL_METHOD);
+	body->SetArrayField("args", args);
+
+	FString content;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&content);
+	FJsonSerializer::Serialize(body, Writer);
+
+	FString url = AnkrUtility::GetUrl() + ENDPOINT_CALL_METHOD;
+	Request->SetURL(url);
+	Request->SetVerb("POST");
+	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
+	Request->SetContentAsString(content);
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // SignMessage is used to to sign and message, the ticket will be generated.
@@ -358,7 +881,9 @@ void UAnkrClient::SignMessage(FString message, const FAnkrCallCompleteDynamicDel
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+	const FString walletSession = session;
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread, walletSession](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - SignMessage - GetContentAsString: %s"), *content);
@@ -372,10 +897,10 @@ void UAnkrClient::SignMessage(FString message, const FAnkrCallCompleteDynamicDel
 
 #if PLATFORM_ANDROID || PLATFORM_IOS
 				AnkrUtility::SetLastRequest("SignMessage");
-				FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
+				FPlatformProcess::LaunchURL(walletSession.GetCharArray().GetData(), NULL, NULL);
 #endif
 
-				Result.ExecuteIfBound(content, ticketId, "", -1, false);
+				AnkrCallbackThread::Execute(callbackThread, Result, content, ticketId, "", -1, false);
 			}
 		});
 
@@ -384,7 +909,7 @@ void UAnkrClient::SignMessage(FString message, const FAnkrCallCompleteDynamicDel
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"message\":\"" + message + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // GetSignature is used to get the result of the signed message ticket and a 'data' object with 'signature' string field will be received.
@@ -397,7 +922,9 @@ void UAnkrClient::GetSignature(FString ticket, const FAnkrCallCompleteDynamicDel
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - GetSignature - GetContentAsString: %s"), *content);
@@ -409,7 +936,7 @@ void UAnkrClient::GetSignature(FString ticket, const FAnkrCallCompleteDynamicDel
 			{
 				TSharedPtr<FJsonObject> data = JsonObject->GetObjectField("data");
 
-				Result.ExecuteIfBound(content, data->GetStringField("signature"), "", -1, false);
+				AnkrCallbackThread::Execute(callbackThread, Result, content, data->GetStringField("signature"), "", -1, false);
 			}
 		});
 
@@ -418,13 +945,25 @@ void UAnkrClient::GetSignature(FString ticket, const FAnkrCallCompleteDynamicDel
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"ticket\":\"" + ticket + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // VerifyMessage is used to confirm whether the user signed the message, an account 'address' will be received.
 // The account address will be the connected wallet address.
+// The address is recovered from the signature on the device, the Ankr API is only asked when the signature cannot be recovered locally.
+// The local response only carries the result and the EIP-55 address, the address is the data in both cases.
 void UAnkrClient::VerifyMessage(FString message, FString signature, const FAnkrCallCompleteDynamicDelegate& Result)
 {
+	FString address, error;
+	if (AnkrSignature::RecoverSigner(message, signature, address, error))
+	{
+		const FString content = "{\"result\":true,\"address\":\"" + address + "\"}";
+		UE_LOG(LogTemp, Warning, TEXT("AnkrClient - VerifyMessage - Recovered locally: %s"), *content);
+		AnkrCallbackThread::Execute(GetCallbackThread(), Result, content, address, "", -1, false);
+		return;
+	}
+	UE_LOG(LogTemp, Warning, TEXT("AnkrClient - VerifyMessage - %s The Ankr API is asked instead."), *error);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -432,7 +971,9 @@ void UAnkrClient::VerifyMessage(FString message, FString signature, const FAnkrC
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const EAnkrCallbackThread callbackThread = GetCallbackThread();
+	AnkrCallbackThread::Configure(Request, callbackThread);
+	Request->OnProcessRequestComplete().BindLambda([Result, callbackThread](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("AnkrClient - VerifyMessage - GetContentAsString: %s"), *content);
@@ -442,7 +983,7 @@ void UAnkrClient::VerifyMessage(FString message, FString signature, const FAnkrC
 
 			if (FJsonSerializer::Deserialize(Reader, JsonObject))
 			{
-				Result.ExecuteIfBound(content, JsonObject->GetStringField("address"), "", -1, false);
+				AnkrCallbackThread::Execute(callbackThread, Result, content, JsonObject->GetStringField("address"), "", -1, false);
 			}
 		});
 
@@ -451,7 +992,7 @@ void UAnkrClient::VerifyMessage(FString message, FString signature, const FAnkrC
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"message\":\"" + message + "\", \"signature\":\"" + signature + "\"}");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 FString UAnkrClient::GetLastRequest()
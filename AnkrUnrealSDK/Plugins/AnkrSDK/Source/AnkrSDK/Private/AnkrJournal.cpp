@@ -0,0 +1,476 @@
+#include "AnkrJournal.h"
+#include "AnkrCallbackThread.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+
+namespace
+{
+	FCriticalSection JournalLock;
+	bool IsReplayed = false;
+	FArchive* JournalWriter = nullptr;
+	TMap<FString, FAnkrJournalEntry> PendingEntries;
+
+	// Identical requests waiting for the answer of a request in flight, by the request id of the request in flight.
+	// Only the requests sent by this session are in flight, a request replayed without a ticket will never be answered.
+	TMap<FString, TArray<FAnkrJournalResponse>> Waiting;
+	TSet<FString> InFlight;
+
+	const FString REJECTED_CONTENT = FString(TEXT("{\"result\": false, \"msg\": \"The identical pending request was rejected.\"}"));
+	const FString EXPIRED_CONTENT  = FString(TEXT("{\"result\": false, \"msg\": \"The identical pending request expired.\"}"));
+}
+
+FString AnkrJournal::GetJournalPath()
+{
+	return FPaths::ProjectSavedDir() + FString("AnkrSDK/TransactionJournal.log");
+}
+
+bool AnkrJournal::RecordSubmit(FString _requestId, FString _sender, FString _body, FAnkrRequestContext _context, FAnkrJournalResponse _response)
+{
+	FScopeLock lock(&JournalLock);
+	Replay();
+	RemoveExpired();
+
+	// A request that already has a ticket never suppresses a new one, minting to the same address twice or changing back to an earlier hat are legitimate repeats.
+	const FString requestKey = GetRequestKey(_body);
+	FString replaced;
+	for (const TPair<FString, FAnkrJournalEntry>& pair : PendingEntries)
+	{
+		if (!pair.Value.requestKey.Equals(requestKey) || !pair.Value.ticket.IsEmpty())
+		{
+			continue;
+		}
+
+		if (!InFlight.Contains(pair.Key))
+		{
+			// Sent by a previous session and never answered, it is replaced by this request.
+			replaced = pair.Key;
+			break;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("AnkrJournal - %s - An identical request is still waiting for its ticket, it will not be sent again."), *_sender);
+		Waiting.FindOrAdd(pair.Key).Add(_response);
+		return false;
+	}
+
+	if (!replaced.IsEmpty())
+	{
+		PendingEntries.Remove(replaced);
+
+		FAnkrJournalEntry discard{};
+		discard.event	  = JOURNAL_EVENT_DISCARD;
+		discard.requestId = replaced;
+		discard.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+		Append(discard);
+	}
+
+	FAnkrJournalEntry entry{};
+	entry.event		 = JOURNAL_EVENT_SUBMIT;
+	entry.requestId	 = _requestId;
+	entry.sender	 = _sender;
+	entry.requestKey = requestKey;
+	entry.body		 = _body;
+	entry.timestamp	 = FDateTime::UtcNow().ToUnixTimestamp();
+	entry.context	 = _context;
+
+	PendingEntries.Add(_requestId, entry);
+	InFlight.Add(_requestId);
+	Append(entry);
+	return true;
+}
+
+bool AnkrJournal::RecordSubmit(FString _requestId, FString _sender, FString _body, FAnkrRequestContext _context, FAnkrCallCompleteDynamicDelegate _result)
+{
+	return RecordSubmit(_requestId, _sender, _body, _context, [_result](FString content, FString ticket)
+		{
+			_result.ExecuteIfBound(content, ticket.IsEmpty() ? content : ticket, "", -1, false);
+		});
+}
+
+void AnkrJournal::RecordTicket(FString _requestId, FString _ticket)
+{
+	FScopeLock lock(&JournalLock);
+	Replay();
+
+	FAnkrJournalEntry* pending = PendingEntries.Find(_requestId);
+	if (pending == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AnkrJournal - RecordTicket - %s is not in the journal."), *_requestId);
+		return;
+	}
+
+	pending->event	= JOURNAL_EVENT_TICKET;
+	pending->ticket = _ticket;
+	InFlight.Remove(_requestId);
+	AnkrRequestContext::Attach(_ticket, pending->context);
+
+	FAnkrJournalEntry entry{};
+	entry.event		= JOURNAL_EVENT_TICKET;
+	entry.requestId = _requestId;
+	entry.ticket	= _ticket;
+	entry.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	Append(entry);
+
+	TArray<FAnkrJournalResponse> waiting;
+	if (Waiting.RemoveAndCopyValue(_requestId, waiting))
+	{
+		Respond(waiting, "{\"result\": true, \"ticket\": \"" + _ticket + "\"}", _ticket);
+	}
+}
+
+bool AnkrJournal::RecordResolved(FString _ticket, FString _status)
+{
+	FScopeLock lock(&JournalLock);
+	Replay();
+
+	FString requestId;
+	for (const TPair<FString, FAnkrJournalEntry>& pair : PendingEntries)
+	{
+		if (pair.Value.ticket.Equals(_ticket))
+		{
+			requestId = pair.Key;
+			break;
+		}
+	}
+
+	// Tickets that were never journaled (SignMessage etc.) or that are already resolved have nothing to resolve.
+	if (requestId.IsEmpty())
+	{
+		return false;
+	}
+
+	PendingEntries.Remove(requestId);
+
+	FAnkrJournalEntry entry{};
+	entry.event		= JOURNAL_EVENT_RESOLVED;
+	entry.requestId = requestId;
+	entry.ticket	= _ticket;
+	entry.status	= _status;
+	entry.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	Append(entry);
+
+	if (PendingEntries.Num() == 0)
+	{
+		Compact();
+	}
+
+	return true;
+}
+
+bool AnkrJournal::ResolveTicket(FString _ticket, TSharedPtr<FJsonObject> _jsonObject, FString& _status)
+{
+	if (!IsResolved(_jsonObject, _status))
+	{
+		return false;
+	}
+
+	FAnkrRequestContext context;
+	AnkrRequestContext::Find(_ticket, context);
+
+	if (RecordResolved(_ticket, _status))
+	{
+		const bool success = _status.Equals(TICKET_STATUS_SUCCESS);
+		AnkrCallbackThread::Run(EAnkrCallbackThread::GameThread, [_ticket, context, success]()
+			{
+				OnTicketResolved().Broadcast(_ticket, context, success);
+			});
+	}
+
+	return true;
+}
+
+FAnkrTicketResolvedDelegate& AnkrJournal::OnTicketResolved()
+{
+	static FAnkrTicketResolvedDelegate ticketResolved;
+	return ticketResolved;
+}
+
+void AnkrJournal::Discard(FString _requestId)
+{
+	FScopeLock lock(&JournalLock);
+	Replay();
+
+	TArray<FAnkrJournalResponse> waiting;
+	if (Waiting.RemoveAndCopyValue(_requestId, waiting))
+	{
+		Respond(waiting, REJECTED_CONTENT, "");
+	}
+	InFlight.Remove(_requestId);
+
+	if (PendingEntries.Remove(_requestId) <= 0)
+	{
+		return;
+	}
+
+	FAnkrJournalEntry entry{};
+	entry.event		= JOURNAL_EVENT_DISCARD;
+	entry.requestId = _requestId;
+	entry.timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	Append(entry);
+
+	if (PendingEntries.Num() == 0)
+	{
+		Compact();
+	}
+}
+
+void AnkrJournal::RecordResponse(FString _requestId, FString _ticket)
+{
+	if (_ticket.IsEmpty())
+	{
+		Discard(_requestId);
+	}
+	else
+	{
+		RecordTicket(_requestId, _ticket);
+	}
+}
+
+TArray<FAnkrJournalEntry> AnkrJournal::GetPendingEntries()
+{
+	FScopeLock lock(&JournalLock);
+	Replay();
+	RemoveExpired();
+
+	TArray<FAnkrJournalEntry> entries;
+	PendingEntries.GenerateValueArray(entries);
+	return entries;
+}
+
+FString AnkrJournal::GetTicketStatus(TSharedPtr<FJsonObject> _jsonObject)
+{
+	FString status;
+	if (!_jsonObject.IsValid())
+	{
+		return status;
+	}
+
+	const TSharedPtr<FJsonObject>* data;
+	if (_jsonObject->TryGetObjectField("data", data) && data->IsValid())
+	{
+		(*data)->TryGetStringField("status", status);
+	}
+	if (status.IsEmpty())
+	{
+		_jsonObject->TryGetStringField("status", status);
+	}
+
+	return status;
+}
+
+bool AnkrJournal::IsResolved(TSharedPtr<FJsonObject> _jsonObject, FString& _status)
+{
+	bool result;
+	if (!_jsonObject.IsValid() || !_jsonObject->TryGetBoolField("result", result))
+	{
+		return false;
+	}
+
+	if (!result)
+	{
+		_status = TICKET_STATUS_FAILED;
+		return true;
+	}
+
+	const FString status = GetTicketStatus(_jsonObject);
+	if (status.IsEmpty() || status.Equals(TICKET_STATUS_PENDING, ESearchCase::IgnoreCase))
+	{
+		return false;
+	}
+
+	// Every other status is final, e.g. a transaction that failed or was reverted on chain.
+	_status = status.Equals(TICKET_STATUS_SUCCESS, ESearchCase::IgnoreCase) ? TICKET_STATUS_SUCCESS : TICKET_STATUS_FAILED;
+	return true;
+}
+
+// Reload answers the identical requests that wait for a request in flight without a ticket, nothing is in flight after it.
+void AnkrJournal::Reload()
+{
+	FScopeLock lock(&JournalLock);
+
+	for (const TPair<FString, TArray<FAnkrJournalResponse>>& pair : Waiting)
+	{
+		Respond(pair.Value, REJECTED_CONTENT, "");
+	}
+	Waiting.Reset();
+	InFlight.Reset();
+	PendingEntries.Reset();
+	CloseWriter();
+
+	IsReplayed = false;
+	Replay();
+}
+
+// Replay folds the journal into the pending list, it must be called with the journal lock held.
+// A submit or a group adds a request, a ticket attaches the ticket to it and a resolved or discard record removes it.
+void AnkrJournal::Replay()
+{
+	if (IsReplayed)
+	{
+		return;
+	}
+	IsReplayed = true;
+
+	TArray<FString> lines;
+	if (!FFileHelper::LoadFileToStringArray(lines, *GetJournalPath()))
+	{
+		return;
+	}
+
+	for (const FString& line : lines)
+	{
+		if (line.IsEmpty())
+		{
+			continue;
+		}
+
+		FAnkrJournalEntry entry = FAnkrJournalEntry::FromJson(line);
+		if (entry.event.Equals(JOURNAL_EVENT_SUBMIT))
+		{
+			PendingEntries.Add(entry.requestId, entry);
+		}
+		else if (entry.event.Equals(JOURNAL_EVENT_TICKET))
+		{
+			FAnkrJournalEntry* pending = PendingEntries.Find(entry.requestId);
+			if (pending != nullptr)
+			{
+				pending->event	= JOURNAL_EVENT_TICKET;
+				pending->ticket = entry.ticket;
+			}
+			else if (!entry.requestKey.IsEmpty())
+			{
+				// A compacted record carries the whole request.
+				PendingEntries.Add(entry.requestId, entry);
+			}
+		}
+		else if (entry.event.Equals(JOURNAL_EVENT_RESOLVED) || entry.event.Equals(JOURNAL_EVENT_DISCARD))
+		{
+			PendingEntries.Remove(entry.requestId);
+		}
+	}
+
+	const int64 now = FDateTime::UtcNow().ToUnixTimestamp();
+	for (auto it = PendingEntries.CreateIterator(); it; ++it)
+	{
+		if (it.Value().timestamp + JOURNAL_ENTRY_TTL_SECONDS < now)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AnkrJournal - Replay - %s request %s expired."), *it.Value().sender, *it.Key());
+			it.RemoveCurrent();
+			continue;
+		}
+		AnkrRequestContext::Attach(it.Value().ticket, it.Value().context);
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("AnkrJournal - Replay - %d pending request(s) recovered from %d journal record(s)."), PendingEntries.Num(), lines.Num());
+
+	Compact();
+}
+
+// RemoveExpired drops the requests older than JOURNAL_ENTRY_TTL_SECONDS, it must be called with the journal lock held.
+// The identical requests waiting for one of them are answered without a ticket.
+void AnkrJournal::RemoveExpired()
+{
+	const int64 now = FDateTime::UtcNow().ToUnixTimestamp();
+
+	TArray<FString> expired;
+	for (const TPair<FString, FAnkrJournalEntry>& pair : PendingEntries)
+	{
+		if (pair.Value.timestamp + JOURNAL_ENTRY_TTL_SECONDS < now)
+		{
+			expired.Add(pair.Key);
+		}
+	}
+
+	if (expired.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FString& requestId : expired)
+	{
+		const FAnkrJournalEntry pending = PendingEntries.FindAndRemoveChecked(requestId);
+		InFlight.Remove(requestId);
+		UE_LOG(LogTemp, Warning, TEXT("AnkrJournal - RemoveExpired - %s request %s expired."), *pending.sender, *requestId);
+
+		if (!pending.ticket.IsEmpty())
+		{
+			AnkrRequestContext::Release(pending.ticket);
+		}
+
+		TArray<FAnkrJournalResponse> waiting;
+		if (Waiting.RemoveAndCopyValue(requestId, waiting))
+		{
+			Respond(waiting, EXPIRED_CONTENT, "");
+		}
+	}
+
+	Compact();
+}
+
+// Respond answers the requests that were not sent on the game thread.
+void AnkrJournal::Respond(const TArray<FAnkrJournalResponse>& _responses, const FString& _content, const FString& _ticket)
+{
+	AsyncTask(ENamedThreads::GameThread, [_responses, _content, _ticket]()
+		{
+			for (const FAnkrJournalResponse& response : _responses)
+			{
+				response(_content, _ticket);
+			}
+		});
+}
+
+// Append writes one json line and flushes it, the file stays open between records.
+void AnkrJournal::Append(const FAnkrJournalEntry& _entry)
+{
+	if (JournalWriter == nullptr)
+	{
+		JournalWriter = IFileManager::Get().CreateFileWriter(*GetJournalPath(), FILEWRITE_Append | FILEWRITE_AllowRead);
+		if (JournalWriter == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("AnkrJournal - Append - Couldn't open the journal at %s"), *GetJournalPath());
+			return;
+		}
+	}
+
+	FTCHARToUTF8 line(*(FAnkrJournalEntry::ToJson(_entry) + TEXT("\n")));
+	JournalWriter->Serialize((void*)line.Get(), line.Length());
+	JournalWriter->Flush();
+}
+
+// Compact rewrites the journal with a single record per pending request, or deletes it when nothing is pending.
+void AnkrJournal::Compact()
+{
+	CloseWriter();
+
+	if (PendingEntries.Num() == 0)
+	{
+		IFileManager::Get().Delete(*GetJournalPath(), false, false, true);
+		return;
+	}
+
+	FString content;
+	for (const TPair<FString, FAnkrJournalEntry>& pair : PendingEntries)
+	{
+		content += FAnkrJournalEntry::ToJson(pair.Value) + TEXT("\n");
+	}
+
+	FFileHelper::SaveStringToFile(content, *GetJournalPath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+void AnkrJournal::CloseWriter()
+{
+	if (JournalWriter != nullptr)
+	{
+		JournalWriter->Close();
+		delete JournalWriter;
+		JournalWriter = nullptr;
+	}
+}
+
+FString AnkrJournal::GetRequestKey(const FString& _body)
+{
+	return FMD5::HashAnsiString(*_body);
+}
@@ -0,0 +1,454 @@
+#include "AnkrKeccak.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+// The widest lanes the platform is compiled for, AVX2 only when every target CPU has it since UE does not dispatch at runtime.
+#if defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+#include <immintrin.h>
+#define ANKR_KECCAK_AVX2 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS && defined(PLATFORM_CPU_X86_FAMILY) && PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define ANKR_KECCAK_SSE2 1
+#elif defined(PLATFORM_ENABLE_VECTORINTRINSICS_NEON) && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#define ANKR_KECCAK_NEON 1
+#endif
+
+namespace
+{
+	const int32 Rate = 136;
+
+	const uint64 RoundConstants[24] =
+	{
+		0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+		0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+		0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+		0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+		0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+		0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+	};
+
+	// Every lane type provides Xor, AndNot (~a & b), Rotate and Splat, so the permutation is written once for scalar and SIMD lanes.
+	FORCEINLINE uint64 Xor(uint64 _a, uint64 _b)	{ return _a ^ _b; }
+	FORCEINLINE uint64 AndNot(uint64 _a, uint64 _b) { return ~_a & _b; }
+
+	template<int32 Offset>
+	FORCEINLINE uint64 Rotate(uint64 _value)
+	{
+		return (_value << Offset) | (_value >> ((64 - Offset) & 63));
+	}
+
+	template<typename TLane>
+	FORCEINLINE TLane Splat(uint64 _value);
+
+	template<>
+	FORCEINLINE uint64 Splat<uint64>(uint64 _value) { return _value; }
+
+#if ANKR_KECCAK_AVX2
+	typedef __m256i FLanes;
+	const int32 Width = 4;
+
+	FORCEINLINE __m256i Xor(__m256i _a, __m256i _b)	   { return _mm256_xor_si256(_a, _b); }
+	FORCEINLINE __m256i AndNot(__m256i _a, __m256i _b) { return _mm256_andnot_si256(_a, _b); }
+
+	template<int32 Offset>
+	FORCEINLINE __m256i Rotate(__m256i _value)
+	{
+		return _mm256_or_si256(_mm256_slli_epi64(_value, Offset), _mm256_srli_epi64(_value, 64 - Offset));
+	}
+
+	template<>
+	FORCEINLINE __m256i Splat<__m256i>(uint64 _value) { return _mm256_set1_epi64x((long long)_value); }
+
+	FORCEINLINE __m256i Gather(const uint64* _lanes) { return _mm256_loadu_si256((const __m256i*)_lanes); }
+	FORCEINLINE void Scatter(__m256i _value, uint64* _lanes) { _mm256_storeu_si256((__m256i*)_lanes, _value); }
+#elif ANKR_KECCAK_SSE2
+	typedef __m128i FLanes;
+	const int32 Width = 2;
+
+	FORCEINLINE __m128i Xor(__m128i _a, __m128i _b)	   { return _mm_xor_si128(_a, _b); }
+	FORCEINLINE __m128i AndNot(__m128i _a, __m128i _b) { return _mm_andnot_si128(_a, _b); }
+
+	template<int32 Offset>
+	FORCEINLINE __m128i Rotate(__m128i _value)
+	{
+		return _mm_or_si128(_mm_slli_epi64(_value, Offset), _mm_srli_epi64(_value, 64 - Offset));
+	}
+
+	template<>
+	FORCEINLINE __m128i Splat<__m128i>(uint64 _value) { return _mm_set1_epi64x((long long)_value); }
+
+	FORCEINLINE __m128i Gather(const uint64* _lanes) { return _mm_loadu_si128((const __m128i*)_lanes); }
+	FORCEINLINE void Scatter(__m128i _value, uint64* _lanes) { _mm_storeu_si128((__m128i*)_lanes, _value); }
+#elif ANKR_KECCAK_NEON
+	typedef uint64x2_t FLanes;
+	const int32 Width = 2;
+
+	FORCEINLINE uint64x2_t Xor(uint64x2_t _a, uint64x2_t _b)	{ return veorq_u64(_a, _b); }
+	FORCEINLINE uint64x2_t AndNot(uint64x2_t _a, uint64x2_t _b) { return vbicq_u64(_b, _a); }
+
+	template<int32 Offset>
+	FORCEINLINE uint64x2_t Rotate(uint64x2_t _value)
+	{
+		return vorrq_u64(vshlq_n_u64(_value, Offset), vshrq_n_u64(_value, 64 - Offset));
+	}
+
+	template<>
+	FORCEINLINE uint64x2_t Splat<uint64x2_t>(uint64 _value) { return vdupq_n_u64(_value); }
+
+	FORCEINLINE uint64x2_t Gather(const uint64* _lanes) { return vld1q_u64(_lanes); }
+	FORCEINLINE void Scatter(uint64x2_t _value, uint64* _lanes) { vst1q_u64(_lanes, _value); }
+#else
+	const int32 Width = 1;
+#endif
+
+	// KeccakF applies the 24 rounds of the Keccak-f[1600] permutation, the lanes are indexed x + 5 * y.
+	// Rho and pi are unrolled so every rotation is a constant.
+	template<typename TLane>
+	void KeccakF(TLane* A)
+	{
+		TLane B[25];
+		TLane C[5];
+
+		for (int32 round = 0; round < 24; round++)
+		{
+			for (int32 x = 0; x < 5; x++)
+			{
+				C[x] = Xor(Xor(Xor(Xor(A[x], A[x + 5]), A[x + 10]), A[x + 15]), A[x + 20]);
+			}
+			for (int32 x = 0; x < 5; x++)
+			{
+				const TLane D = Xor(C[(x + 4) % 5], Rotate<1>(C[(x + 1) % 5]));
+				for (int32 y = 0; y < 25; y += 5)
+				{
+					A[x + y] = Xor(A[x + y], D);
+				}
+			}
+
+			B[ 0] = A[ 0];
+			B[10] = Rotate< 1>(A[ 1]);
+			B[20] = Rotate<62>(A[ 2]);
+			B[ 5] = Rotate<28>(A[ 3]);
+			B[15] = Rotate<27>(A[ 4]);
+			B[16] = Rotate<36>(A[ 5]);
+			B[ 1] = Rotate<44>(A[ 6]);
+			B[11] = Rotate< 6>(A[ 7]);
+			B[21] = Rotate<55>(A[ 8]);
+			B[ 6] = Rotate<20>(A[ 9]);
+			B[ 7] = Rotate< 3>(A[10]);
+			B[17] = Rotate<10>(A[11]);
+			B[ 2] = Rotate<43>(A[12]);
+			B[12] = Rotate<25>(A[13]);
+			B[22] = Rotate<39>(A[14]);
+			B[23] = Rotate<41>(A[15]);
+			B[ 8] = Rotate<45>(A[16]);
+			B[18] = Rotate<15>(A[17]);
+			B[ 3] = Rotate<21>(A[18]);
+			B[13] = Rotate< 8>(A[19]);
+			B[14] = Rotate<18>(A[20]);
+			B[24] = Rotate< 2>(A[21]);
+			B[ 9] = Rotate<61>(A[22]);
+			B[19] = Rotate<56>(A[23]);
+			B[ 4] = Rotate<14>(A[24]);
+
+			for (int32 y = 0; y < 25; y += 5)
+			{
+				for (int32 x = 0; x < 5; x++)
+				{
+					A[x + y] = Xor(B[x + y], AndNot(B[(x + 1) % 5 + y], B[(x + 2) % 5 + y]));
+				}
+			}
+
+			A[0] = Xor(A[0], Splat<TLane>(RoundConstants[round]));
+		}
+	}
+
+	FORCEINLINE uint64 LoadLane(const uint8* _bytes)
+	{
+		uint64 lane = 0;
+		for (int32 i = 7; i >= 0; i--)
+		{
+			lane = (lane << 8) | _bytes[i];
+		}
+		return lane;
+	}
+
+	FORCEINLINE void StoreLane(uint64 _lane, uint8* _bytes)
+	{
+		for (int32 i = 0; i < 8; i++)
+		{
+			_bytes[i] = (uint8)(_lane >> (8 * i));
+		}
+	}
+
+	// GetBlockCount is the number of blocks absorbed for an input, the padding always adds at least one byte.
+	FORCEINLINE int64 GetBlockCount(int64 _length)
+	{
+		return _length / Rate + 1;
+	}
+
+	// GetBlock points at a full block of the input or pads the last block into a buffer, 0x01 ... 0x80.
+	FORCEINLINE const uint8* GetBlock(const uint8* _data, int64 _length, int64 _block, uint8* _buffer)
+	{
+		const int64 offset = _block * Rate;
+		if (_length - offset >= Rate)
+		{
+			return _data + offset;
+		}
+
+		FMemory::Memzero(_buffer, Rate);
+		FMemory::Memcpy(_buffer, _data + offset, _length - offset);
+		_buffer[_length - offset] ^= 0x01;
+		_buffer[Rate - 1]		  ^= 0x80;
+		return _buffer;
+	}
+
+#if ANKR_KECCAK_AVX2 || ANKR_KECCAK_SSE2 || ANKR_KECCAK_NEON
+	// HashLanes hashes Width inputs with the same number of blocks, input w is kept in lane w of every register.
+	void HashLanes(const uint8* const* _data, const int64* _lengths, const int32* _indices, uint8* _digests)
+	{
+		const int64 blocks = GetBlockCount(_lengths[_indices[0]]);
+
+		FLanes state[25];
+		for (int32 i = 0; i < 25; i++)
+		{
+			state[i] = Splat<FLanes>(0);
+		}
+
+		uint8 buffers[Width][Rate];
+		const uint8* block[Width];
+		alignas(32) uint64 lanes[Width];
+
+		for (int64 b = 0; b < blocks; b++)
+		{
+			for (int32 w = 0; w < Width; w++)
+			{
+				block[w] = GetBlock(_data[_indices[w]], _lengths[_indices[w]], b, buffers[w]);
+			}
+
+			for (int32 i = 0; i < Rate / 8; i++)
+			{
+				for (int32 w = 0; w < Width; w++)
+				{
+					lanes[w] = LoadLane(block[w] + 8 * i);
+				}
+				state[i] = Xor(state[i], Gather(lanes));
+			}
+			KeccakF(state);
+		}
+
+		for (int32 i = 0; i < AnkrKeccak::DigestSize / 8; i++)
+		{
+			Scatter(state[i], lanes);
+			for (int32 w = 0; w < Width; w++)
+			{
+				StoreLane(lanes[w], _digests + (int64)_indices[w] * AnkrKeccak::DigestSize + 8 * i);
+			}
+		}
+	}
+#endif
+
+	// RunBenchmark hashes random inputs one at a time and in batches and logs the throughput of both.
+	void RunBenchmark(const TArray<FString>& _args)
+	{
+		const int32 count  = _args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*_args[0])) : 4096;
+		const int32 length = _args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*_args[1])) : 64;
+
+		// The sizes are counted in int64, count * length is above the largest int32 for e.g. 65536 inputs of 65536 bytes.
+		const int64 totalBytes = (int64)count * length;
+
+		FRandomStream random(count ^ length);
+		TArray64<uint8> data;
+		data.SetNumUninitialized(totalBytes);
+		for (uint8& byte : data)
+		{
+			byte = (uint8)random.RandRange(0, 255);
+		}
+
+		TArray<const uint8*> inputs;
+		TArray<int64> lengths;
+		for (int32 i = 0; i < count; i++)
+		{
+			inputs.Add(data.GetData() + (int64)i * length);
+			lengths.Add(length);
+		}
+
+		TArray64<uint8> single;
+		TArray64<uint8> batch;
+		single.SetNumUninitialized((int64)count * AnkrKeccak::DigestSize);
+		batch.SetNumUninitialized((int64)count * AnkrKeccak::DigestSize);
+
+		double start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < count; i++)
+		{
+			AnkrKeccak::Hash256(inputs[i], length, single.GetData() + (int64)i * AnkrKeccak::DigestSize);
+		}
+		const double singleSeconds = FPlatformTime::Seconds() - start;
+
+		start = FPlatformTime::Seconds();
+		AnkrKeccak::Hash256Batch(inputs.GetData(), lengths.GetData(), count, batch.GetData());
+		const double batchSeconds = FPlatformTime::Seconds() - start;
+
+		const double megabytes = (double)totalBytes / (1024.0 * 1024.0);
+		UE_LOG(LogTemp, Warning, TEXT("AnkrKeccak - Benchmark - %d input(s) of %d byte(s), %s."), count, length, AnkrKeccak::GetImplementation());
+		UE_LOG(LogTemp, Warning, TEXT("AnkrKeccak - Benchmark - Single: %.0f hashes/s, %.1f MB/s."), count / singleSeconds, megabytes / singleSeconds);
+		UE_LOG(LogTemp, Warning, TEXT("AnkrKeccak - Benchmark - Batch: %.0f hashes/s, %.1f MB/s, the digests %s."), count / batchSeconds, megabytes / batchSeconds, single == batch ? TEXT("match") : TEXT("DO NOT match"));
+	}
+
+	FAutoConsoleCommand BenchmarkCommand(
+		TEXT("Ankr.KeccakBenchmark"),
+		TEXT("Logs the throughput of AnkrKeccak for single and batched inputs, e.g. Ankr.KeccakBenchmark 4096 64 for 4096 inputs of 64 bytes."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark));
+}
+
+// Hash256 absorbs the input a block at a time, the last block is padded with 0x01 ... 0x80.
+void AnkrKeccak::Hash256(const uint8* _data, int64 _length, uint8* _digest)
+{
+	uint64 state[25] = {};
+	uint8 buffer[Rate];
+
+	const int64 blocks = GetBlockCount(_length);
+	for (int64 b = 0; b < blocks; b++)
+	{
+		const uint8* block = GetBlock(_data, _length, b, buffer);
+		for (int32 i = 0; i < Rate / 8; i++)
+		{
+			state[i] ^= LoadLane(block + i * 8);
+		}
+		KeccakF(state);
+	}
+
+	for (int32 i = 0; i < DigestSize / 8; i++)
+	{
+		StoreLane(state[i], _digest + 8 * i);
+	}
+}
+
+TArray<uint8> AnkrKeccak::Hash256(const TArray<uint8>& _data)
+{
+	TArray<uint8> digest;
+	digest.SetNumUninitialized(DigestSize);
+	Hash256(_data.GetData(), _data.Num(), digest.GetData());
+	return digest;
+}
+
+TArray<uint8> AnkrKeccak::Hash256(const FString& _text)
+{
+	FTCHARToUTF8 utf8(*_text);
+
+	TArray<uint8> digest;
+	digest.SetNumUninitialized(DigestSize);
+	Hash256((const uint8*)utf8.Get(), utf8.Length(), digest.GetData());
+	return digest;
+}
+
+// Hash256Batch sorts the inputs by their number of blocks, so inputs of similar length share the lanes of a register.
+// An input left without a partner of the same block count is hashed on its own.
+void AnkrKeccak::Hash256Batch(const uint8* const* _data, const int64* _lengths, int32 _count, uint8* _digests)
+{
+	int32 next = 0;
+
+#if ANKR_KECCAK_AVX2 || ANKR_KECCAK_SSE2 || ANKR_KECCAK_NEON
+	TArray<int32> order;
+	order.SetNumUninitialized(_count);
+	for (int32 i = 0; i < _count; i++)
+	{
+		order[i] = i;
+	}
+	order.StableSort([_lengths](int32 _a, int32 _b) { return GetBlockCount(_lengths[_a]) < GetBlockCount(_lengths[_b]); });
+
+	while (next + Width <= _count)
+	{
+		if (GetBlockCount(_lengths[order[next]]) == GetBlockCount(_lengths[order[next + Width - 1]]))
+		{
+			HashLanes(_data, _lengths, order.GetData() + next, _digests);
+			next += Width;
+		}
+		else
+		{
+			Hash256(_data[order[next]], _lengths[order[next]], _digests + (int64)order[next] * DigestSize);
+			next++;
+		}
+	}
+
+	for (; next < _count; next++)
+	{
+		Hash256(_data[order[next]], _lengths[order[next]], _digests + (int64)order[next] * DigestSize);
+	}
+#else
+	for (; next < _count; next++)
+	{
+		Hash256(_data[next], _lengths[next], _digests + (int64)next * DigestSize);
+	}
+#endif
+}
+
+TArray<TArray<uint8>> AnkrKeccak::Hash256Batch(const TArray<TArray<uint8>>& _inputs)
+{
+	TArray<const uint8*> data;
+	TArray<int64> lengths;
+	for (const TArray<uint8>& input : _inputs)
+	{
+		data.Add(input.GetData());
+		lengths.Add(input.Num());
+	}
+
+	TArray<uint8> digests;
+	digests.SetNumUninitialized(_inputs.Num() * DigestSize);
+	Hash256Batch(data.GetData(), lengths.GetData(), _inputs.Num(), digests.GetData());
+
+	TArray<TArray<uint8>> results;
+	results.SetNum(_inputs.Num());
+	for (int32 i = 0; i < _inputs.Num(); i++)
+	{
+		results[i].Append(digests.GetData() + i * DigestSize, DigestSize);
+	}
+	return results;
+}
+
+uint32 AnkrKeccak::GetSelector(const FString& _signature)
+{
+	const TArray<uint8> digest = Hash256(_signature);
+	return ((uint32)digest[0] << 24) | ((uint32)digest[1] << 16) | ((uint32)digest[2] << 8) | (uint32)digest[3];
+}
+
+TArray<uint32> AnkrKeccak::GetSelectors(const TArray<FString>& _signatures)
+{
+	TArray<FTCHARToUTF8> utf8;
+	TArray<const uint8*> data;
+	TArray<int64> lengths;
+	utf8.Reserve(_signatures.Num());
+	for (const FString& signature : _signatures)
+	{
+		const FTCHARToUTF8& conversion = utf8.Emplace_GetRef(*signature);
+		data.Add((const uint8*)conversion.Get());
+		lengths.Add(conversion.Length());
+	}
+
+	TArray<uint8> digests;
+	digests.SetNumUninitialized(_signatures.Num() * DigestSize);
+	Hash256Batch(data.GetData(), lengths.GetData(), _signatures.Num(), digests.GetData());
+
+	TArray<uint32> selectors;
+	selectors.SetNumUninitialized(_signatures.Num());
+	for (int32 i = 0; i < _signatures.Num(); i++)
+	{
+		const uint8* digest = digests.GetData() + i * DigestSize;
+		selectors[i] = ((uint32)digest[0] << 24) | ((uint32)digest[1] << 16) | ((uint32)digest[2] << 8) | (uint32)digest[3];
+	}
+	return selectors;
+}
+
+const TCHAR* AnkrKeccak::GetImplementation()
+{
+#if ANKR_KECCAK_AVX2
+	return TEXT("AVX2, 4 lanes");
+#elif ANKR_KECCAK_SSE2
+	return TEXT("SSE2, 2 lanes");
+#elif ANKR_KECCAK_NEON
+	return TEXT("NEON, 2 lanes");
+#else
+	return TEXT("scalar");
+#endif
+}
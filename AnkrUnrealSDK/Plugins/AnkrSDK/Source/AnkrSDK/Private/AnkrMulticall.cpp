@@ -0,0 +1,225 @@
+#include "AnkrMulticall.h"
+#include "AnkrAbi.h"
+#include "AnkrContractRegistry.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	// FindMethod finds the overload of a call that accepts its arguments and encodes the call with it.
+	bool FindMethod(const FAnkrMulticallRequest& _call, FAnkrContractPtr& _contract, const FAnkrAbiMethod*& _method, TArray<uint8>& _calldata, FString& _error)
+	{
+		_contract = _call.contract.StartsWith("0x") ? AnkrContractRegistry::FindByAddress(_call.contract) : AnkrContractRegistry::Find(_call.contract);
+		if (!_contract.IsValid())
+		{
+			_error = FString::Printf(TEXT("%s is not a registered contract."), *_call.contract);
+			return false;
+		}
+
+		const TArray<FAnkrAbiMethod>* overloads = _contract->FindMethods(_call.method);
+		if (overloads == nullptr)
+		{
+			_error = FString::Printf(TEXT("%s has no method %s."), *_contract->GetName(), *_call.method);
+			return false;
+		}
+
+		for (const FAnkrAbiMethod& overload : *overloads)
+		{
+			if (AnkrAbi::EncodeArguments(overload, _call.args, _calldata, _error))
+			{
+				_method = &overload;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	FString DecodeOutputs(const FAnkrAbiMethod& _method, const FString& _data)
+	{
+		TArray<FAnkrAbiValue> values;
+		FString error;
+		if (!AnkrAbi::DecodeOutputs(_method, _data, values, error))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("AnkrMulticall - DecodeOutputs - %s: %s"), *_method.name, *error);
+			return FString();
+		}
+
+		TArray<TSharedPtr<FJsonValue>> items;
+		for (int32 i = 0; i < values.Num(); i++)
+		{
+			items.Add(AnkrAbi::ToJsonValue(_method.outputs[i].canonicalType, values[i]));
+		}
+
+		FString outputs;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&outputs);
+		FJsonSerializer::Serialize(items, Writer);
+		return outputs;
+	}
+}
+
+bool AnkrMulticall::BuildCalls(const TArray<FAnkrMulticallRequest>& _calls, FAnkrAbiValue& _aggregate, FString& _error)
+{
+	TArray<FAnkrAbiValue> tuples;
+	for (const FAnkrMulticallRequest& call : _calls)
+	{
+		FAnkrContractPtr contract;
+		const FAnkrAbiMethod* method;
+		TArray<uint8> calldata;
+		if (!FindMethod(call, contract, method, calldata, _error))
+		{
+			return false;
+		}
+
+		TArray<uint8> target;
+		if (!AnkrAbi::FromHex(contract->GetAddress(), target) || target.Num() != 20)
+		{
+			_error = FString::Printf(TEXT("%s has no valid address: %s"), *contract->GetName(), *contract->GetAddress());
+			return false;
+		}
+
+		tuples.Add(FAnkrAbiValue::Tuple({ FAnkrAbiValue::Address(target.GetData()), FAnkrAbiValue::Bool(call.allowFailure), FAnkrAbiValue::Bytes(MoveTemp(calldata)) }));
+	}
+
+	_aggregate = FAnkrAbiValue::Array(MoveTemp(tuples));
+	return true;
+}
+
+bool AnkrMulticall::BuildArguments(const TArray<FAnkrMulticallRequest>& _calls, FString& _args, FString& _error)
+{
+	FAnkrAbiValue aggregate;
+	if (!BuildCalls(_calls, aggregate, _error))
+	{
+		return false;
+	}
+
+	_args = AnkrAbi::WriteArguments({ AnkrAbi::ToJsonValue(MULTICALL_CALLS, aggregate) });
+	return true;
+}
+
+bool AnkrMulticall::ParseResults(const TArray<FAnkrMulticallRequest>& _calls, const FString& _data, TArray<FAnkrMulticallResult>& _results, FString& _error)
+{
+	_results.Reset();
+
+	const FString data = _data.TrimStartAndEnd();
+	if (data.StartsWith("0x", ESearchCase::IgnoreCase))
+	{
+		TArray<uint8> bytes;
+		TArray<FAnkrAbiValue> values;
+		if (!AnkrAbi::FromHex(data, bytes) || !AnkrAbi::Decode({ TEXT("(bool,bytes)[]") }, bytes.GetData(), bytes.Num(), values, _error))
+		{
+			_error = "The results of aggregate3 could not be decoded. " + _error;
+			return false;
+		}
+
+		for (const FAnkrAbiValue& tuple : values[0].items)
+		{
+			FAnkrMulticallResult result;
+			result.success = tuple.items[0].GetBool();
+			result.data	   = AnkrAbi::ToHex(tuple.items[1].data);
+			_results.Add(result);
+		}
+	}
+	else
+	{
+		TArray<TSharedPtr<FJsonValue>> pairs;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(data);
+		if (!FJsonSerializer::Deserialize(Reader, pairs))
+		{
+			_error = "The results of aggregate3 are neither hex nor a json array: " + data;
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& pair : pairs)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* items;
+			if (!pair->TryGetArray(items) || items->Num() != 2)
+			{
+				_error = "A result of aggregate3 is not a [success, returnData] pair.";
+				return false;
+			}
+
+			FAnkrMulticallResult result;
+			result.success = (*items)[0]->AsBool();
+			result.data	   = (*items)[1]->AsString();
+			_results.Add(result);
+		}
+	}
+
+	if (_results.Num() != _calls.Num())
+	{
+		_error = FString::Printf(TEXT("aggregate3 returned %d result(s) for %d call(s)."), _results.Num(), _calls.Num());
+		return false;
+	}
+
+	for (int32 i = 0; i < _calls.Num(); i++)
+	{
+		FAnkrContractPtr contract;
+		const FAnkrAbiMethod* method;
+		TArray<uint8> calldata;
+		FString error;
+		if (_results[i].success && FindMethod(_calls[i], contract, method, calldata, error))
+		{
+			_results[i].outputs = DecodeOutputs(*method, _results[i].data);
+		}
+	}
+	return true;
+}
+
+// Execute decodes the (address,bool,bytes)[] argument, looks up each method by its selector and encodes its response.
+bool AnkrMulticall::Execute(const TArray<TSharedPtr<FJsonValue>>& _args, TFunctionRef<FString(const FAnkrAbiMethod&)> _respond, FString& _data, FString& _error)
+{
+	FAnkrAbiValue calls;
+	if (_args.Num() != 1 || !AnkrAbi::ToAbiValue(TEXT("(address,bool,bytes)[]"), _args[0], calls, _error))
+	{
+		_error = "aggregate3 needs a single (address,bool,bytes)[] argument. " + _error;
+		return false;
+	}
+
+	TArray<FAnkrAbiValue> results;
+	for (const FAnkrAbiValue& call : calls.items)
+	{
+		const FString target	   = call.items[0].GetAddress();
+		const bool allowFailure	   = call.items[1].GetBool();
+		const TArray<uint8>& input = call.items[2].data;
+
+		FAnkrContractPtr contract = AnkrContractRegistry::FindByAddress(target);
+		const FAnkrAbiMethod* method = nullptr;
+		if (contract.IsValid() && input.Num() >= 4)
+		{
+			method = contract->FindMethodBySelector(((uint32)input[0] << 24) | ((uint32)input[1] << 16) | ((uint32)input[2] << 8) | input[3]);
+		}
+
+		TArray<uint8> output;
+		bool success = method != nullptr;
+		if (success)
+		{
+			TArray<TSharedPtr<FJsonValue>> values;
+			bool isJsonArray;
+			TArray<FAnkrAbiValue> outputs;
+			success = AnkrAbi::ParseArguments(_respond(*method), values, isJsonArray) && values.Num() == method->outputs.Num();
+			outputs.SetNum(values.Num());
+			for (int32 i = 0; success && i < values.Num(); i++)
+			{
+				FString error;
+				success = AnkrAbi::ToAbiValue(method->outputs[i].canonicalType, values[i], outputs[i], error);
+			}
+
+			if (success)
+			{
+				AnkrAbi::Encode(outputs, output);
+			}
+		}
+
+		if (!success && !allowFailure)
+		{
+			_error = FString::Printf(TEXT("Multicall3: call to %s failed."), *target);
+			return false;
+		}
+
+		results.Add(FAnkrAbiValue::Tuple({ FAnkrAbiValue::Bool(success), FAnkrAbiValue::Bytes(MoveTemp(output)) }));
+	}
+
+	TArray<uint8> encoded;
+	AnkrAbi::Encode({ FAnkrAbiValue::Array(MoveTemp(results)) }, encoded);
+	_data = AnkrAbi::ToHex(encoded);
+	return true;
+}
@@ -0,0 +1,63 @@
+#include "AnkrRequestContext.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	FCriticalSection ContextLock;
+	TMap<FString, FAnkrRequestContext> TicketContexts;
+}
+
+FAnkrRequestContext AnkrRequestContext::Make(EAnkrOperation _operation, const FAnkrUInt256& _characterId, TArray<FString> _itemIds)
+{
+	FAnkrRequestContext context{};
+	context.operation	= _operation;
+	context.requestId	= FGuid::NewGuid().ToString();
+	context.characterId = _characterId;
+	context.itemIds		= _itemIds;
+	return context;
+}
+
+void AnkrRequestContext::Attach(FString _ticket, FAnkrRequestContext _context)
+{
+	if (_ticket.IsEmpty())
+	{
+		return;
+	}
+
+	FScopeLock lock(&ContextLock);
+	TicketContexts.Add(_ticket, _context);
+}
+
+bool AnkrRequestContext::Find(FString _ticket, FAnkrRequestContext& _context)
+{
+	FScopeLock lock(&ContextLock);
+
+	const FAnkrRequestContext* context = TicketContexts.Find(_ticket);
+	if (context == nullptr)
+	{
+		return false;
+	}
+
+	_context = *context;
+	return true;
+}
+
+bool AnkrRequestContext::SetCallerData(FString _ticket, FString _callerData)
+{
+	FScopeLock lock(&ContextLock);
+
+	FAnkrRequestContext* context = TicketContexts.Find(_ticket);
+	if (context == nullptr)
+	{
+		return false;
+	}
+
+	context->callerData = _callerData;
+	return true;
+}
+
+void AnkrRequestContext::Release(FString _ticket)
+{
+	FScopeLock lock(&ContextLock);
+	TicketContexts.Remove(_ticket);
+}
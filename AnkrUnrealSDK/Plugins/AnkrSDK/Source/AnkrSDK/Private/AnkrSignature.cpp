@@ -0,0 +1,616 @@
+#include "AnkrSignature.h"
+#include "AnkrKeccak.h"
+#include "AnkrAbi.h"
+
+namespace
+{
+	// FElement is a 256 bit number in 64 bit limbs, least significant first.
+	struct FElement
+	{
+		uint64 v[4];
+	};
+
+	// FModulus is a prime close to 2^256, the complement 2^256 - prime is used to fold the high limbs of a product.
+	struct FModulus
+	{
+		FElement prime;
+		uint64 complement[3];
+		int32 complementSize;
+	};
+
+	// The field of secp256k1, p = 2^256 - 2^32 - 977.
+	const FModulus P =
+	{
+		{ { 0xFFFFFFFEFFFFFC2FULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL } },
+		{ 0x00000001000003D1ULL }, 1
+	};
+
+	// The order of the group of secp256k1.
+	const FModulus N =
+	{
+		{ { 0xBFD25E8CD0364141ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL } },
+		{ 0x402DA1732FC9BEBFULL, 0x4551231950B75FC4ULL, 0x0000000000000001ULL }, 3
+	};
+
+	// The exponent of the square root in the field, a^((p + 1) / 4).
+	const FElement SqrtExponent = { { 0xFFFFFFFFBFFFFF0CULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x3FFFFFFFFFFFFFFFULL } };
+
+	const FElement Gx = { { 0x59F2815B16F81798ULL, 0x029BFCDB2DCE28D9ULL, 0x55A06295CE870B07ULL, 0x79BE667EF9DCBBACULL } };
+	const FElement Gy = { { 0x9C47D08FFB10D4B8ULL, 0xFD17B448A6855419ULL, 0x5DA4FBFC0E1108A8ULL, 0x483ADA7726A3C465ULL } };
+
+	const FElement Zero	 = { { 0, 0, 0, 0 } };
+	const FElement One	 = { { 1, 0, 0, 0 } };
+	const FElement Seven = { { 7, 0, 0, 0 } };
+
+	// MultiplyFull returns the low 64 bits of the product and writes the high 64 bits.
+	FORCEINLINE uint64 MultiplyFull(uint64 _a, uint64 _b, uint64& _high)
+	{
+#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 product = (unsigned __int128)_a * _b;
+		_high = (uint64)(product >> 64);
+		return (uint64)product;
+#elif defined(_MSC_VER) && defined(_M_X64)
+		return _umul128(_a, _b, &_high);
+#else
+		const uint64 aLow = (uint32)_a, aHigh = _a >> 32;
+		const uint64 bLow = (uint32)_b, bHigh = _b >> 32;
+		const uint64 low = aLow * bLow;
+		const uint64 middle1 = aHigh * bLow + (low >> 32);
+		const uint64 middle2 = aLow * bHigh + (uint32)middle1;
+		_high = aHigh * bHigh + (middle1 >> 32) + (middle2 >> 32);
+		return (middle2 << 32) | (uint32)low;
+#endif
+	}
+
+	// MultiplyAccumulate adds _a * _b + _carry to _limb and keeps the high 64 bits in _carry, the sum always fits in 128 bits.
+	FORCEINLINE void MultiplyAccumulate(uint64 _a, uint64 _b, uint64& _limb, uint64& _carry)
+	{
+		uint64 high;
+		uint64 low = MultiplyFull(_a, _b, high);
+		low += _limb;
+		high += low < _limb ? 1 : 0;
+		low += _carry;
+		high += low < _carry ? 1 : 0;
+		_limb = low;
+		_carry = high;
+	}
+
+	FElement Load(const uint8* _bytes)
+	{
+		FElement result;
+		for (int32 i = 0; i < 4; i++)
+		{
+			const uint8* limb = _bytes + 8 * (3 - i);
+			result.v[i] = 0;
+			for (int32 j = 0; j < 8; j++)
+			{
+				result.v[i] = (result.v[i] << 8) | limb[j];
+			}
+		}
+		return result;
+	}
+
+	void Store(const FElement& _value, uint8* _bytes)
+	{
+		for (int32 i = 0; i < 4; i++)
+		{
+			uint8* limb = _bytes + 8 * (3 - i);
+			for (int32 j = 0; j < 8; j++)
+			{
+				limb[j] = (uint8)(_value.v[i] >> (56 - 8 * j));
+			}
+		}
+	}
+
+	FORCEINLINE bool IsZero(const FElement& _value)
+	{
+		return (_value.v[0] | _value.v[1] | _value.v[2] | _value.v[3]) == 0;
+	}
+
+	FORCEINLINE bool IsEqual(const FElement& _a, const FElement& _b)
+	{
+		return _a.v[0] == _b.v[0] && _a.v[1] == _b.v[1] && _a.v[2] == _b.v[2] && _a.v[3] == _b.v[3];
+	}
+
+	FORCEINLINE bool IsLess(const FElement& _a, const FElement& _b)
+	{
+		for (int32 i = 3; i >= 0; i--)
+		{
+			if (_a.v[i] != _b.v[i])
+			{
+				return _a.v[i] < _b.v[i];
+			}
+		}
+		return false;
+	}
+
+	FORCEINLINE bool GetBit(const FElement& _value, int32 _bit)
+	{
+		return ((_value.v[_bit / 64] >> (_bit % 64)) & 1) != 0;
+	}
+
+	// SubtractRaw subtracts without a modulus and returns the borrow.
+	FORCEINLINE uint64 SubtractRaw(const FElement& _a, const FElement& _b, FElement& _result)
+	{
+		uint64 borrow = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			const uint64 difference = _a.v[i] - _b.v[i];
+			const uint64 nextBorrow = (_a.v[i] < _b.v[i] ? 1 : 0) | (difference < borrow ? 1 : 0);
+			_result.v[i] = difference - borrow;
+			borrow = nextBorrow;
+		}
+		return borrow;
+	}
+
+	// AddRaw adds without a modulus and returns the carry.
+	FORCEINLINE uint64 AddRaw(const FElement& _a, const FElement& _b, FElement& _result)
+	{
+		uint64 carry = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			const uint64 sum = _a.v[i] + carry;
+			carry = sum < carry ? 1 : 0;
+			_result.v[i] = sum + _b.v[i];
+			carry += _result.v[i] < sum ? 1 : 0;
+		}
+		return carry;
+	}
+
+	FORCEINLINE FElement Add(const FElement& _a, const FElement& _b, const FModulus& _m)
+	{
+		FElement result;
+		if (AddRaw(_a, _b, result) != 0 || !IsLess(result, _m.prime))
+		{
+			SubtractRaw(result, _m.prime, result);
+		}
+		return result;
+	}
+
+	FORCEINLINE FElement Subtract(const FElement& _a, const FElement& _b, const FModulus& _m)
+	{
+		FElement result;
+		if (SubtractRaw(_a, _b, result) != 0)
+		{
+			AddRaw(result, _m.prime, result);
+		}
+		return result;
+	}
+
+	// ReduceField folds the limbs above 2^256 with 2^256 = 2^32 + 977 mod p, the second fold only carries a few bits.
+	FElement ReduceField(const uint64* _wide)
+	{
+		const uint64 C = P.complement[0];
+
+		FElement result = { { _wide[0], _wide[1], _wide[2], _wide[3] } };
+		uint64 carry = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			MultiplyAccumulate(_wide[4 + i], C, result.v[i], carry);
+		}
+
+		while (carry != 0)
+		{
+			uint64 high;
+			const uint64 low = MultiplyFull(carry, C, high);
+			const FElement fold = { { low, high, 0, 0 } };
+			carry = AddRaw(result, fold, result);
+		}
+
+		if (!IsLess(result, P.prime))
+		{
+			SubtractRaw(result, P.prime, result);
+		}
+		return result;
+	}
+
+	// ReduceOrder folds the limbs above 2^256 with the 129 bit complement of the order, lo + hi * (2^256 - n), until the value fits in 256 bits.
+	FElement ReduceOrder(uint64* _wide)
+	{
+		int32 size = 8;
+		while (true)
+		{
+			while (size > 4 && _wide[size - 1] == 0)
+			{
+				size--;
+			}
+			if (size <= 4)
+			{
+				break;
+			}
+
+			uint64 high[4];
+			const int32 highSize = size - 4;
+			for (int32 i = 0; i < highSize; i++)
+			{
+				high[i] = _wide[4 + i];
+				_wide[4 + i] = 0;
+			}
+
+			for (int32 i = 0; i < highSize; i++)
+			{
+				uint64 carry = 0;
+				int32 j = 0;
+				for (; j < N.complementSize; j++)
+				{
+					MultiplyAccumulate(high[i], N.complement[j], _wide[i + j], carry);
+				}
+				for (; carry != 0; j++)
+				{
+					_wide[i + j] += carry;
+					carry = _wide[i + j] < carry ? 1 : 0;
+				}
+			}
+			size = FMath::Min(highSize + N.complementSize + 1, 8);
+		}
+
+		FElement result = { { _wide[0], _wide[1], _wide[2], _wide[3] } };
+		if (!IsLess(result, N.prime))
+		{
+			SubtractRaw(result, N.prime, result);
+		}
+		return result;
+	}
+
+	FElement Multiply(const FElement& _a, const FElement& _b, const FModulus& _m)
+	{
+		uint64 wide[8] = {};
+		for (int32 i = 0; i < 4; i++)
+		{
+			uint64 carry = 0;
+			for (int32 j = 0; j < 4; j++)
+			{
+				MultiplyAccumulate(_a.v[i], _b.v[j], wide[i + j], carry);
+			}
+			wide[i + 4] = carry;
+		}
+		return &_m == &P ? ReduceField(wide) : ReduceOrder(wide);
+	}
+
+	FElement Power(const FElement& _base, const FElement& _exponent, const FModulus& _m)
+	{
+		FElement result = One;
+		for (int32 bit = 255; bit >= 0; bit--)
+		{
+			result = Multiply(result, result, _m);
+			if (GetBit(_exponent, bit))
+			{
+				result = Multiply(result, _base, _m);
+			}
+		}
+		return result;
+	}
+
+	FORCEINLINE void ShiftRight(FElement& _value, uint64 _topBit)
+	{
+		_value.v[0] = (_value.v[0] >> 1) | (_value.v[1] << 63);
+		_value.v[1] = (_value.v[1] >> 1) | (_value.v[2] << 63);
+		_value.v[2] = (_value.v[2] >> 1) | (_value.v[3] << 63);
+		_value.v[3] = (_value.v[3] >> 1) | (_topBit << 63);
+	}
+
+	// Halve divides by 2 modulo an odd modulus, odd values are made even by adding the modulus first.
+	FORCEINLINE void Halve(FElement& _value, const FModulus& _m)
+	{
+		const uint64 carry = (_value.v[0] & 1) != 0 ? AddRaw(_value, _m.prime, _value) : 0;
+		ShiftRight(_value, carry);
+	}
+
+	// Inverse uses the binary extended Euclidean algorithm, it is several times faster than a^(m - 2) and the value must not be zero.
+	FElement Inverse(const FElement& _value, const FModulus& _m)
+	{
+		FElement u = _value;
+		FElement v = _m.prime;
+		FElement x1 = One;
+		FElement x2 = Zero;
+
+		while (!IsEqual(u, One) && !IsEqual(v, One))
+		{
+			while ((u.v[0] & 1) == 0)
+			{
+				ShiftRight(u, 0);
+				Halve(x1, _m);
+			}
+			while ((v.v[0] & 1) == 0)
+			{
+				ShiftRight(v, 0);
+				Halve(x2, _m);
+			}
+
+			if (!IsLess(u, v))
+			{
+				SubtractRaw(u, v, u);
+				x1 = Subtract(x1, x2, _m);
+			}
+			else
+			{
+				SubtractRaw(v, u, v);
+				x2 = Subtract(x2, x1, _m);
+			}
+		}
+		return IsEqual(u, One) ? x1 : x2;
+	}
+
+	// FPoint is a point of the curve y^2 = x^3 + 7 in Jacobian coordinates, x = X / Z^2 and y = Y / Z^3, Z is 0 at infinity.
+	struct FPoint
+	{
+		FElement X;
+		FElement Y;
+		FElement Z;
+	};
+
+	const FPoint Infinity = { Zero, One, Zero };
+
+	FPoint Double(const FPoint& _p)
+	{
+		if (IsZero(_p.Z) || IsZero(_p.Y))
+		{
+			return Infinity;
+		}
+
+		const FElement A = Multiply(_p.X, _p.X, P);
+		const FElement B = Multiply(_p.Y, _p.Y, P);
+		const FElement C = Multiply(B, B, P);
+		const FElement XB = Add(_p.X, B, P);
+		FElement D = Subtract(Subtract(Multiply(XB, XB, P), A, P), C, P);
+		D = Add(D, D, P);
+		const FElement E = Add(Add(A, A, P), A, P);
+		const FElement F = Multiply(E, E, P);
+		const FElement C2 = Add(C, C, P);
+		const FElement C4 = Add(C2, C2, P);
+		const FElement C8 = Add(C4, C4, P);
+
+		FPoint result;
+		result.X = Subtract(F, Add(D, D, P), P);
+		result.Y = Subtract(Multiply(E, Subtract(D, result.X, P), P), C8, P);
+		const FElement YZ = Multiply(_p.Y, _p.Z, P);
+		result.Z = Add(YZ, YZ, P);
+		return result;
+	}
+
+	FPoint AddPoints(const FPoint& _p, const FPoint& _q)
+	{
+		if (IsZero(_p.Z))
+		{
+			return _q;
+		}
+		if (IsZero(_q.Z))
+		{
+			return _p;
+		}
+
+		const FElement Z1Z1 = Multiply(_p.Z, _p.Z, P);
+		const FElement Z2Z2 = Multiply(_q.Z, _q.Z, P);
+		const FElement U1 = Multiply(_p.X, Z2Z2, P);
+		const FElement U2 = Multiply(_q.X, Z1Z1, P);
+		const FElement S1 = Multiply(Multiply(_p.Y, _q.Z, P), Z2Z2, P);
+		const FElement S2 = Multiply(Multiply(_q.Y, _p.Z, P), Z1Z1, P);
+		const FElement H = Subtract(U2, U1, P);
+		const FElement R = Subtract(S2, S1, P);
+
+		if (IsZero(H))
+		{
+			return IsZero(R) ? Double(_p) : Infinity;
+		}
+
+		const FElement HH = Multiply(H, H, P);
+		const FElement HHH = Multiply(H, HH, P);
+		const FElement V = Multiply(U1, HH, P);
+
+		FPoint result;
+		result.X = Subtract(Subtract(Multiply(R, R, P), HHH, P), Add(V, V, P), P);
+		result.Y = Subtract(Multiply(R, Subtract(V, result.X, P), P), Multiply(S1, HHH, P), P);
+		result.Z = Multiply(Multiply(_p.Z, _q.Z, P), H, P);
+		return result;
+	}
+
+	FORCEINLINE FPoint Negate(const FPoint& _p)
+	{
+		return { _p.X, Subtract(Zero, _p.Y, P), _p.Z };
+	}
+
+	// GetNaf writes the width 5 non-adjacent form of a scalar, least significant digit first, the digits are 0 or odd between -15 and 15.
+	// At most one digit of any 5 in a row is not 0, so a multiplication takes about 256 / 6 additions.
+	int32 GetNaf(const FElement& _scalar, int8* _naf)
+	{
+		FElement d = _scalar;
+		int32 length = 0;
+		while (!IsZero(d))
+		{
+			int32 digit = 0;
+			if ((d.v[0] & 1) != 0)
+			{
+				digit = (int32)(d.v[0] & 31);
+				if (digit >= 16)
+				{
+					digit -= 32;
+				}
+
+				const FElement offset = { { (uint64)(digit > 0 ? digit : -digit), 0, 0, 0 } };
+				if (digit > 0)
+				{
+					SubtractRaw(d, offset, d);
+				}
+				else
+				{
+					AddRaw(d, offset, d);
+				}
+			}
+			_naf[length++] = (int8)digit;
+			ShiftRight(d, 0);
+		}
+		return length;
+	}
+
+	// GetOddMultiples fills 1 * A, 3 * A, ... 15 * A for the digits of GetNaf.
+	void GetOddMultiples(const FPoint& _A, FPoint* _multiples)
+	{
+		const FPoint twice = Double(_A);
+		_multiples[0] = _A;
+		for (int32 i = 1; i < 8; i++)
+		{
+			_multiples[i] = AddPoints(_multiples[i - 1], twice);
+		}
+	}
+
+	FORCEINLINE FPoint AddDigit(const FPoint& _sum, const FPoint* _multiples, int8 _digit)
+	{
+		return _digit > 0 ? AddPoints(_sum, _multiples[_digit / 2]) : AddPoints(_sum, Negate(_multiples[-_digit / 2]));
+	}
+
+	// MultiplyAdd computes a * A + b * B with one shared chain of doublings, the scalars are written in the width 5 non-adjacent form.
+	FPoint MultiplyAdd(const FElement& _a, const FPoint& _A, const FElement& _b, const FPoint& _B)
+	{
+		int8 nafA[257] = {};
+		int8 nafB[257] = {};
+		const int32 length = FMath::Max(GetNaf(_a, nafA), GetNaf(_b, nafB));
+
+		FPoint multiplesA[8];
+		FPoint multiplesB[8];
+		GetOddMultiples(_A, multiplesA);
+		GetOddMultiples(_B, multiplesB);
+
+		FPoint result = Infinity;
+		for (int32 i = length - 1; i >= 0; i--)
+		{
+			result = Double(result);
+			if (nafA[i] != 0)
+			{
+				result = AddDigit(result, multiplesA, nafA[i]);
+			}
+			if (nafB[i] != 0)
+			{
+				result = AddDigit(result, multiplesB, nafB[i]);
+			}
+		}
+		return result;
+	}
+}
+
+// HashPersonalMessage signs hex with 0x as the bytes it encodes like personal_sign, e.g. "0x68656c6c6f" is hashed as "hello".
+TArray<uint8> AnkrSignature::HashPersonalMessage(const FString& _message)
+{
+	TArray<uint8> message;
+	if (!_message.StartsWith("0x", ESearchCase::CaseSensitive) || !AnkrAbi::FromHex(_message, message))
+	{
+		FTCHARToUTF8 utf8(*_message);
+		message = TArray<uint8>((const uint8*)utf8.Get(), utf8.Length());
+	}
+	FTCHARToUTF8 prefix(*FString::Printf(TEXT("\x19") TEXT("Ethereum Signed Message:\n%d"), message.Num()));
+
+	TArray<uint8> data;
+	data.Append((const uint8*)prefix.Get(), prefix.Length());
+	data.Append(message);
+	return AnkrKeccak::Hash256(data);
+}
+
+// RecoverPublicKey follows ecrecover, R is the point with x = r and the parity of y given by v, the key is r^-1 * (s * R - e * G).
+bool AnkrSignature::RecoverPublicKey(const uint8* _hash, const uint8* _signature, uint8* _publicKey)
+{
+	const uint8 v = _signature[64];
+	const uint32 parity = v >= 27 ? v - 27 : v;
+	if (parity > 1)
+	{
+		return false;
+	}
+
+	const FElement r = Load(_signature);
+	const FElement s = Load(_signature + 32);
+	if (IsZero(r) || IsZero(s) || !IsLess(r, N.prime) || !IsLess(s, N.prime))
+	{
+		return false;
+	}
+
+	const FElement y2 = Add(Multiply(Multiply(r, r, P), r, P), Seven, P);
+	FElement y = Power(y2, SqrtExponent, P);
+	if (!IsEqual(Multiply(y, y, P), y2))
+	{
+		return false;
+	}
+	if ((y.v[0] & 1) != parity)
+	{
+		y = Subtract(Zero, y, P);
+	}
+
+	FElement e = Load(_hash);
+	if (!IsLess(e, N.prime))
+	{
+		SubtractRaw(e, N.prime, e);
+	}
+
+	const FElement rInverse = Inverse(r, N);
+	const FElement u1 = Subtract(Zero, Multiply(e, rInverse, N), N);
+	const FElement u2 = Multiply(s, rInverse, N);
+
+	const FPoint G = { Gx, Gy, One };
+	const FPoint R = { r, y, One };
+	const FPoint Q = MultiplyAdd(u1, G, u2, R);
+	if (IsZero(Q.Z))
+	{
+		return false;
+	}
+
+	const FElement zInverse = Inverse(Q.Z, P);
+	const FElement zInverse2 = Multiply(zInverse, zInverse, P);
+	Store(Multiply(Q.X, zInverse2, P), _publicKey);
+	Store(Multiply(Multiply(Q.Y, zInverse2, P), zInverse, P), _publicKey + 32);
+	return true;
+}
+
+FString AnkrSignature::GetAddress(const uint8* _publicKey)
+{
+	uint8 digest[AnkrKeccak::DigestSize];
+	AnkrKeccak::Hash256(_publicKey, PublicKeySize, digest);
+	return ToChecksumAddress(AnkrAbi::ToHex(digest + 12, 20));
+}
+
+// ToChecksumAddress uppercases the letters whose nibble in the Keccak-256 hash of the lowercase address is 8 or more.
+FString AnkrSignature::ToChecksumAddress(const FString& _address)
+{
+	FString lower = _address.StartsWith("0x", ESearchCase::IgnoreCase) ? _address.Mid(2).ToLower() : _address.ToLower();
+	const TArray<uint8> digest = AnkrKeccak::Hash256(lower);
+
+	for (int32 i = 0; i < lower.Len() && i < 2 * AnkrKeccak::DigestSize; i++)
+	{
+		const uint8 nibble = (i % 2 == 0) ? (digest[i / 2] >> 4) : (digest[i / 2] & 0x0F);
+		if (nibble >= 8)
+		{
+			lower[i] = FChar::ToUpper(lower[i]);
+		}
+	}
+	return "0x" + lower;
+}
+
+bool AnkrSignature::RecoverSigner(const FString& _message, const FString& _signature, FString& _address, FString& _error)
+{
+	TArray<uint8> signature;
+	if (!AnkrAbi::FromHex(_signature, signature) || signature.Num() != SignatureSize)
+	{
+		_error = FString::Printf(TEXT("The signature is not %d bytes of hex."), SignatureSize);
+		return false;
+	}
+
+	const TArray<uint8> hash = HashPersonalMessage(_message);
+	uint8 publicKey[PublicKeySize];
+	if (!RecoverPublicKey(hash.GetData(), signature.GetData(), publicKey))
+	{
+		_error = "The signature is not a valid secp256k1 signature.";
+		return false;
+	}
+
+	_address = GetAddress(publicKey);
+	return true;
+}
+
+bool UAnkrSignatureLibrary::RecoverMessageSigner(FString message, FString signature, FString& address, FString& error)
+{
+	address.Empty();
+	error.Empty();
+	return AnkrSignature::RecoverSigner(message, signature, address, error);
+}
+
+bool UAnkrSignatureLibrary::IsMessageSignedBy(FString message, FString signature, FString address)
+{
+	FString signer, error;
+	return AnkrSignature::RecoverSigner(message, signature, signer, error) && signer.Equals(address, ESearchCase::IgnoreCase);
+}
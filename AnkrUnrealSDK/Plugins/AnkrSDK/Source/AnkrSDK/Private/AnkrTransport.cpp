@@ -0,0 +1,486 @@
+#include "AnkrTransport.h"
+#include "AnkrAbiCache.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrMulticall.h"
+#include "AnkrUtility.h"
+#include "AnkrCallDispatcher.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+#endif
+
+namespace
+{
+	FCriticalSection TransportLock;
+	TSharedPtr<IAnkrTransport, ESPMode::ThreadSafe> Transport;
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> MockBackend;
+
+	// FAnkrLocalResponse is the response handed to the completion delegate of a request answered in-process, by the mock backend or by the native library.
+	class FAnkrLocalResponse : public IHttpResponse
+	{
+
+	public:
+
+		FAnkrLocalResponse(FString _url, int32 _code, const FString& _content) : url(_url), code(_code)
+		{
+			FTCHARToUTF8 conversion(*_content);
+			content.Append((const uint8*)conversion.Get(), conversion.Length());
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		virtual const FString& GetURL() const override { return url; }
+#else
+		virtual FString GetURL() const override { return url; }
+#endif
+		virtual FString GetURLParameter(const FString& ParameterName) const override { return FString(); }
+		virtual FString GetHeader(const FString& HeaderName) const override { return HeaderName == CONTENT_TYPE_KEY ? CONTENT_TYPE_VALUE : FString(); }
+		virtual TArray<FString> GetAllHeaders() const override { return { CONTENT_TYPE_KEY + TEXT(": ") + CONTENT_TYPE_VALUE }; }
+		virtual FString GetContentType() const override { return CONTENT_TYPE_VALUE; }
+		virtual int32 GetContentLength() const override { return content.Num(); }
+		virtual const TArray<uint8>& GetContent() const override { return content; }
+		virtual int32 GetResponseCode() const override { return code; }
+
+		virtual FString GetContentAsString() const override
+		{
+			FUTF8ToTCHAR conversion((const ANSICHAR*)content.GetData(), content.Num());
+			return FString(conversion.Length(), conversion.Get());
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+		virtual const FString& GetEffectiveURL() const override { return url; }
+		virtual EHttpRequestStatus::Type GetStatus() const override { return code == EHttpResponseCodes::Ok ? EHttpRequestStatus::Succeeded : EHttpRequestStatus::Failed; }
+		virtual EHttpFailureReason GetFailureReason() const override { return code == EHttpResponseCodes::Ok ? EHttpFailureReason::None : EHttpFailureReason::Other; }
+#endif
+
+	private:
+
+		FString url;
+		int32 code;
+		TArray<uint8> content;
+	};
+
+	// GetEndpoint returns the path of a url without the host, e.g. "wallet/info" or "ad/UUID/show".
+	FString GetEndpoint(const FString& _url)
+	{
+		FString path = _url;
+
+		int32 scheme = path.Find(TEXT("://"));
+		if (scheme != INDEX_NONE)
+		{
+			path = path.Mid(scheme + 3);
+		}
+
+		int32 slash;
+		if (!path.FindChar('/', slash))
+		{
+			return FString();
+		}
+		path = path.Mid(slash + 1);
+
+		int32 query;
+		if (path.FindChar('?', query))
+		{
+			path = path.Left(query);
+		}
+
+		path.RemoveFromEnd(SLASH);
+		return path;
+	}
+
+	FString GetStringField(const TSharedPtr<FJsonObject>& _object, const FString& _field)
+	{
+		FString value;
+		if (_object.IsValid())
+		{
+			_object->TryGetStringField(_field, value);
+		}
+		return value;
+	}
+
+	FString MakeHex(int32 _bytes)
+	{
+		FString hex = "0x";
+		while (hex.Len() < 2 + _bytes * 2)
+		{
+			hex += FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		}
+		return hex.Left(2 + _bytes * 2);
+	}
+}
+
+// ProcessRequest sends the request with the HTTP module.
+void FAnkrHttpTransport::ProcessRequest(FAnkrHttpRequestRef _request)
+{
+	_request->ProcessRequest();
+}
+
+FAnkrMockTransport::FAnkrMockTransport(const FAnkrMockBackendSettings& _settings) : settings(_settings)
+{
+}
+
+void FAnkrMockTransport::SetSettings(const FAnkrMockBackendSettings& _settings)
+{
+	FScopeLock scope(&lock);
+	settings = _settings;
+}
+
+FAnkrMockBackendSettings FAnkrMockTransport::GetSettings()
+{
+	FScopeLock scope(&lock);
+	return settings;
+}
+
+void FAnkrMockTransport::SetMethodResponse(FString _method, FString _data)
+{
+	FScopeLock scope(&lock);
+	methodResponses.Add(_method, _data);
+}
+
+// ProcessRequest answers the request and schedules its completion delegate on the core ticker.
+// Failed requests still receive a response carrying the error code and an empty "data" object, the response handlers of the SDK expect a response.
+void FAnkrMockTransport::ProcessRequest(FAnkrHttpRequestRef _request)
+{
+	const FString url	   = _request->GetURL();
+	const FString endpoint = GetEndpoint(url);
+
+	const TArray<uint8>& body = _request->GetContent();
+	FUTF8ToTCHAR conversion((const ANSICHAR*)body.GetData(), body.Num());
+	const FString content(conversion.Length(), conversion.Get());
+
+	FAnkrMockBackendSettings current = GetSettings();
+	numRequests++;
+
+	int code = EHttpResponseCodes::Ok;
+	FString response;
+	if (current.failingEndpoints.Contains(endpoint) || (current.errorRate > 0.0f && FMath::FRand() < current.errorRate))
+	{
+		code	 = current.errorCode;
+		response = FString::Printf(TEXT("{\"result\":false,\"code\":%d,\"msg\":\"Mock backend error.\",\"data\":{}}"), code);
+	}
+	else
+	{
+		response = Respond(endpoint, content, code);
+	}
+
+	const bool success = code == EHttpResponseCodes::Ok;
+	if (!success)
+	{
+		numErrors++;
+	}
+
+	FHttpResponsePtr httpResponse = MakeShareable(new FAnkrLocalResponse(url, code, response));
+	const float delay = FMath::Max(current.latencyMs + FMath::FRand() * current.latencyJitterMs, 0.0f) / 1000.0f;
+
+	auto deliver = [_request, httpResponse, success](float _deltaTime)
+		{
+			_request->OnProcessRequestComplete().ExecuteIfBound(_request, httpResponse, success);
+			return false;
+		};
+
+	auto schedule = [deliver, delay]()
+		{
+#if ENGINE_MAJOR_VERSION == 5
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(deliver), delay);
+#else
+			FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(deliver), delay);
+#endif
+		};
+
+	if (IsInGameThread())
+	{
+		schedule();
+		return;
+	}
+	AsyncTask(ENamedThreads::GameThread, schedule);
+}
+
+// Respond implements the endpoints, the responses have the fields the response handlers of the SDK read.
+FString FAnkrMockTransport::Respond(const FString& _endpoint, const FString& _content, int& _code)
+{
+	TSharedPtr<FJsonObject> request;
+	TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(_content);
+	FJsonSerializer::Deserialize(reader, request);
+
+	FScopeLock scope(&lock);
+
+	if (_endpoint == ENDPOINT_PING)
+	{
+		return "pong";
+	}
+	if (_endpoint == ENDPOINT_CONNECT)
+	{
+		return "{\"result\":true,\"login\":false,\"session\":\"" + FGuid::NewGuid().ToString() + "\",\"uri\":\"\"}";
+	}
+	if (_endpoint == ENDPOINT_WALLET_INFO)
+	{
+		return FString::Printf(TEXT("{\"result\":true,\"accounts\":[\"%s\"],\"chainId\":%d}"), *settings.account, settings.chainId);
+	}
+	if (_endpoint == ENDPOINT_ABI)
+	{
+		const FString abiHash = AnkrAbiCache::ComputeHash(GetStringField(request, "abi"));
+		abiHashes.Add(abiHash);
+		return "{\"result\":true,\"abi\":\"" + abiHash + "\"}";
+	}
+	if ((_endpoint == ENDPOINT_SEND_TRANSACTION || _endpoint == ENDPOINT_CALL_METHOD) && settings.rejectUnknownAbiHashes && !abiHashes.Contains(GetStringField(request, "abi_hash")))
+	{
+		return "{\"result\":false,\"msg\":\"Unknown abi hash.\",\"data\":{}}";
+	}
+	if (_endpoint == ENDPOINT_SEND_TRANSACTION)
+	{
+		return "{\"result\":true,\"ticket\":\"" + MakeTicket("") + "\"}";
+	}
+	if (_endpoint == ENDPOINT_SIGN_MESSAGE)
+	{
+		return "{\"result\":true,\"ticket\":\"" + MakeTicket(MakeHex(65)) + "\"}";
+	}
+	if (_endpoint == ENDPOINT_RESULT)
+	{
+		const FString* signature = tickets.Find(GetStringField(request, "ticket"));
+		if (signature == nullptr)
+		{
+			return "{\"result\":false,\"code\":0,\"status\":\"unknown\",\"data\":{\"status\":\"unknown\"}}";
+		}
+		return "{\"result\":true,\"code\":0,\"status\":\"success\",\"data\":{\"status\":\"success\",\"tx_hash\":\"" + MakeHex(32) + "\",\"signature\":\"" + *signature + "\"}}";
+	}
+	if (_endpoint == ENDPOINT_CALL_METHOD && GetStringField(request, "method") == MULTICALL_METHOD)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* args;
+		FString data, error;
+		if (!request->TryGetArrayField("args", args) || !AnkrMulticall::Execute(*args, [this](const FAnkrAbiMethod& _method) { const FString* response = methodResponses.Find(_method.name); return response != nullptr ? *response : FString("0"); }, data, error))
+		{
+			return "{\"result\":false,\"msg\":\"" + error.ReplaceCharWithEscapedChar() + "\",\"data\":{}}";
+		}
+		return "{\"result\":true,\"data\":\"" + data + "\"}";
+	}
+	if (_endpoint == ENDPOINT_CALL_METHOD)
+	{
+		const FString* data = methodResponses.Find(GetStringField(request, "method"));
+		return "{\"result\":true,\"data\":\"" + (data != nullptr ? *data : FString("0")) + "\"}";
+	}
+	if (_endpoint == ENDPOINT_VERIFY_MESSAGE)
+	{
+		return "{\"result\":true,\"address\":\"" + settings.account + "\"}";
+	}
+	if (_endpoint == ENDPOINT_START_SESSION)
+	{
+		return "{\"code\":0,\"error\":\"\"}";
+	}
+	if (_endpoint == ENDPOINT_AD)
+	{
+		return "{\"code\":0,\"error\":\"\",\"result\":{\"ad_type\":\"banner\",\"uuid\":\"" + FGuid::NewGuid().ToString() + "\",\"expire_at\":0,\"texture_url\":\"\",\"engagement_url\":\"\",\"texture_width\":0,\"texture_height\":0}}";
+	}
+	if (_endpoint.StartsWith(ENDPOINT_AD + SLASH))
+	{
+		return "{\"code\":0,\"error\":\"\"}";
+	}
+
+	_code = EHttpResponseCodes::NotFound;
+	return "{\"result\":false,\"msg\":\"Unknown endpoint.\",\"data\":{}}";
+}
+
+FString FAnkrMockTransport::MakeTicket(FString _signature)
+{
+	FString ticket = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens).ToLower();
+	tickets.Add(ticket, _signature);
+	return ticket;
+}
+
+// GetNativeMethod maps the endpoints of the Ankr API to the exports of the native library.
+FString FAnkrNativeTransport::GetNativeMethod(const FString& _endpoint)
+{
+	if (_endpoint == ENDPOINT_CALL_METHOD)		return TEXT("CallMethod");
+	if (_endpoint == ENDPOINT_SEND_TRANSACTION) return TEXT("SendTransaction");
+	if (_endpoint == ENDPOINT_RESULT)			return TEXT("GetResult");
+	if (_endpoint == ENDPOINT_ABI)				return TEXT("SendABI");
+	if (_endpoint == ENDPOINT_SIGN_MESSAGE)		return TEXT("SignMessage");
+	if (_endpoint == ENDPOINT_VERIFY_MESSAGE)	return TEXT("VerifyMessage");
+	if (_endpoint == ENDPOINT_CONNECT)			return TEXT("ConnectWallet");
+	if (_endpoint == ENDPOINT_WALLET_INFO)		return TEXT("GetWallet");
+	return FString();
+}
+
+// ProcessRequest registers the request as a native call and schedules the flush of the frame, the request is sent over HTTP when the native library can't answer it.
+void FAnkrNativeTransport::ProcessRequest(FAnkrHttpRequestRef _request)
+{
+#if ANKR_WITH_NATIVE_LIBRARY
+	const FString url	 = _request->GetURL();
+	const FString method = GetNativeMethod(GetEndpoint(url));
+
+	LibraryManager& library = LibraryManager::GetInstance();
+	if (!method.IsEmpty() && library.EnsureLoaded() && library.IsClientAvailable())
+	{
+		const int callIndex = library.AddCall(TCHAR_TO_UTF8(*method), [_request, url](bool _success, const FString& _data)
+			{
+				FHttpResponsePtr response = MakeShareable(new FAnkrLocalResponse(url, _success ? EHttpResponseCodes::Ok : EHttpResponseCodes::ServerError, _data));
+				_request->OnProcessRequestComplete().ExecuteIfBound(_request, response, _success);
+			});
+
+		if (callIndex >= 0)
+		{
+			bool isFirst;
+			{
+				FScopeLock scope(&lock);
+				pending.Add({ callIndex, method, _request->GetContent() });
+				isFirst			 = !isFlushScheduled;
+				isFlushScheduled = true;
+			}
+
+			if (isFirst)
+			{
+				TWeakPtr<FAnkrNativeTransport, ESPMode::ThreadSafe> weakThis = AsShared();
+				auto flush = [weakThis](float _deltaTime)
+					{
+						TSharedPtr<FAnkrNativeTransport, ESPMode::ThreadSafe> transport = weakThis.Pin();
+						if (transport.IsValid())
+						{
+							transport->Flush();
+						}
+						return false;
+					};
+
+				auto schedule = [flush]()
+					{
+#if ENGINE_MAJOR_VERSION == 5
+						FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(flush), 0.0f);
+#else
+						FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(flush), 0.0f);
+#endif
+					};
+
+				if (IsInGameThread())
+				{
+					schedule();
+				}
+				else
+				{
+					AsyncTask(ENamedThreads::GameThread, schedule);
+				}
+			}
+			return;
+		}
+	}
+#endif
+
+	_request->ProcessRequest();
+}
+
+// Flush hands the requests of the frame to the native library, in one batch where the platform supports it. The UTF-8 body of every request is passed as it is.
+void FAnkrNativeTransport::Flush()
+{
+	TArray<FPendingRequest> requests;
+	{
+		FScopeLock scope(&lock);
+		requests		 = MoveTemp(pending);
+		isFlushScheduled = false;
+		pending.Reset();
+	}
+
+#if ANKR_WITH_NATIVE_LIBRARY
+	std::vector<AnkrNativeRequest> batch;
+	batch.reserve(requests.Num());
+	for (const FPendingRequest& request : requests)
+	{
+		AnkrNativeRequest nativeRequest;
+		nativeRequest.callIndex = request.callIndex;
+		nativeRequest.method	= std::string(TCHAR_TO_UTF8(*request.method));
+		nativeRequest.content.assign((const char*)request.content.GetData(), request.content.Num());
+		batch.push_back(std::move(nativeRequest));
+	}
+
+#if ANKR_WITH_NATIVE_BATCH
+	LibraryManager::GetInstance().SubmitBatch(batch);
+#else
+	LibraryManager::GetInstance().SubmitEach(batch);
+#endif
+#endif
+}
+
+// Get returns the transport, the mock or the native backend is enabled on the first call when the command line asks for it.
+TSharedRef<IAnkrTransport, ESPMode::ThreadSafe> AnkrTransport::Get()
+{
+	FScopeLock scope(&TransportLock);
+
+	if (!Transport.IsValid())
+	{
+		if (FParse::Param(FCommandLine::Get(), TEXT("AnkrMockBackend")))
+		{
+			FAnkrMockBackendSettings settings;
+			FParse::Value(FCommandLine::Get(), TEXT("AnkrMockLatencyMs="), settings.latencyMs);
+			FParse::Value(FCommandLine::Get(), TEXT("AnkrMockJitterMs="), settings.latencyJitterMs);
+			FParse::Value(FCommandLine::Get(), TEXT("AnkrMockErrorRate="), settings.errorRate);
+
+			MockBackend = MakeShared<FAnkrMockTransport, ESPMode::ThreadSafe>(settings);
+			Transport	= MockBackend;
+			UE_LOG(LogTemp, Warning, TEXT("AnkrTransport - Get - The mock backend answers every request, latency: %f ms, error rate: %f."), settings.latencyMs, settings.errorRate);
+		}
+		else if (FParse::Param(FCommandLine::Get(), TEXT("AnkrNativeBackend")))
+		{
+			Transport = MakeShared<FAnkrNativeTransport, ESPMode::ThreadSafe>();
+			UE_LOG(LogTemp, Warning, TEXT("AnkrTransport - Get - The native library answers the requests it implements."));
+		}
+		else
+		{
+			Transport = MakeShared<FAnkrHttpTransport, ESPMode::ThreadSafe>();
+		}
+	}
+
+	return Transport.ToSharedRef();
+}
+
+void AnkrTransport::Set(TSharedPtr<IAnkrTransport, ESPMode::ThreadSafe> _transport)
+{
+	FScopeLock scope(&TransportLock);
+	Transport = _transport;
+	MockBackend.Reset();
+}
+
+void AnkrTransport::UseMockBackend(bool _enabled, const FAnkrMockBackendSettings& _settings)
+{
+	FScopeLock scope(&TransportLock);
+
+	if (!_enabled)
+	{
+		Transport = MakeShared<FAnkrHttpTransport, ESPMode::ThreadSafe>();
+		MockBackend.Reset();
+		return;
+	}
+
+	if (MockBackend.IsValid())
+	{
+		MockBackend->SetSettings(_settings);
+		return;
+	}
+
+	MockBackend = MakeShared<FAnkrMockTransport, ESPMode::ThreadSafe>(_settings);
+	Transport	= MockBackend;
+}
+
+void AnkrTransport::UseNativeBackend(bool _enabled)
+{
+	FScopeLock scope(&TransportLock);
+
+	MockBackend.Reset();
+	if (_enabled)
+	{
+		Transport = MakeShared<FAnkrNativeTransport, ESPMode::ThreadSafe>();
+		return;
+	}
+
+	Transport = MakeShared<FAnkrHttpTransport, ESPMode::ThreadSafe>();
+}
+
+TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> AnkrTransport::GetMockBackend()
+{
+	FScopeLock scope(&TransportLock);
+	return MockBackend;
+}
+
+void AnkrTransport::ProcessRequest(FAnkrHttpRequestRef _request)
+{
+	Get()->ProcessRequest(_request);
+}
@@ -0,0 +1,280 @@
+#include "AnkrUInt256.h"
+
+bool FAnkrUInt256::Parse(const FString& _text, FAnkrUInt256& _value)
+{
+	const FString text = _text.TrimStartAndEnd();
+	if (text.StartsWith("0x", ESearchCase::IgnoreCase))
+	{
+		return ParseHex(*text + 2, text.Len() - 2, _value);
+	}
+	return ParseDecimal(*text, text.Len(), _value);
+}
+
+// ParseHex fills the limbs from the last digit, digits beyond the 64th must be leading zeros.
+bool FAnkrUInt256::ParseHex(const TCHAR* _digits, int32 _length, FAnkrUInt256& _value)
+{
+	_value = FAnkrUInt256();
+	if (_length <= 0)
+	{
+		return false;
+	}
+
+	for (int32 k = 0; k < _length; k++)
+	{
+		const TCHAR character = _digits[_length - 1 - k];
+		if (!FChar::IsHexDigit(character))
+		{
+			_value = FAnkrUInt256();
+			return false;
+		}
+
+		const uint64 nibble = FParse::HexDigit(character);
+		if (k >= 64)
+		{
+			if (nibble != 0)
+			{
+				_value = FAnkrUInt256();
+				return false;
+			}
+			continue;
+		}
+		_value.limbs[k / 16] |= nibble << (4 * (k % 16));
+	}
+	return true;
+}
+
+// ParseDecimal folds the digits in chunks of up to 9, one multiplication of the limbs per chunk.
+bool FAnkrUInt256::ParseDecimal(const TCHAR* _digits, int32 _length, FAnkrUInt256& _value)
+{
+	static const uint32 Powers[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+	_value = FAnkrUInt256();
+	if (_length <= 0)
+	{
+		return false;
+	}
+
+	for (int32 start = 0; start < _length; start += 9)
+	{
+		const int32 count = FMath::Min(9, _length - start);
+
+		uint32 chunk = 0;
+		for (int32 i = start; i < start + count; i++)
+		{
+			if (!FChar::IsDigit(_digits[i]))
+			{
+				_value = FAnkrUInt256();
+				return false;
+			}
+			chunk = chunk * 10 + (_digits[i] - '0');
+		}
+
+		if (_value.MultiplyAdd(Powers[count], chunk) != 0)
+		{
+			_value = FAnkrUInt256();
+			return false;
+		}
+	}
+	return true;
+}
+
+FAnkrUInt256 FAnkrUInt256::FromBigEndian(const uint8* _bytes)
+{
+	FAnkrUInt256 value;
+	for (int32 i = 0; i < 32; i++)
+	{
+		value.limbs[3 - i / 8] = (value.limbs[3 - i / 8] << 8) | _bytes[i];
+	}
+	return value;
+}
+
+void FAnkrUInt256::ToBigEndian(uint8* _bytes) const
+{
+	for (int32 i = 0; i < 32; i++)
+	{
+		_bytes[i] = (uint8)(limbs[3 - i / 8] >> (8 * (7 - i % 8)));
+	}
+}
+
+FString FAnkrUInt256::ToHex(int32 _minDigits) const
+{
+	static const TCHAR* Digits = TEXT("0123456789abcdef");
+
+	TCHAR buffer[66];
+	int32 position = 66;
+
+	int32 count = 0;
+	for (int32 k = 0; k < 64; k++)
+	{
+		const uint32 nibble = (uint32)(limbs[k / 16] >> (4 * (k % 16))) & 0x0f;
+		buffer[--position] = Digits[nibble];
+		if (nibble != 0)
+		{
+			count = k + 1;
+		}
+	}
+
+	count = FMath::Clamp(FMath::Max(count, _minDigits), 1, 64);
+	return FString(TEXT("0x")) + FString(count, buffer + 66 - count);
+}
+
+// ToDecimal divides by 10^9 until the value is zero, every remainder gives 9 digits written from the end.
+FString FAnkrUInt256::ToDecimal() const
+{
+	TCHAR buffer[80];
+	int32 position = 80;
+
+	FAnkrUInt256 value = *this;
+	do
+	{
+		uint32 remainder = value.Divide(1000000000);
+		const bool isLast = value.IsZero();
+		for (int32 i = 0; i < 9 && (!isLast || remainder != 0 || i == 0); i++)
+		{
+			buffer[--position] = TEXT('0') + remainder % 10;
+			remainder /= 10;
+		}
+	}
+	while (!value.IsZero());
+
+	return FString(80 - position, buffer + position);
+}
+
+bool FAnkrUInt256::ExportTextItem(FString& ValueStr, const FAnkrUInt256& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
+{
+	ValueStr += ToDecimal();
+	return true;
+}
+
+// ImportTextItem reads a hex or decimal number, any other text is left to the default import of the limbs.
+bool FAnkrUInt256::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+	int32 length = 0;
+	while (FChar::IsHexDigit(Buffer[length]) || ((Buffer[length] == 'x' || Buffer[length] == 'X') && length == 1))
+	{
+		length++;
+	}
+
+	FAnkrUInt256 value;
+	if (length <= 0 || !Parse(FString(length, Buffer), value))
+	{
+		return false;
+	}
+
+	*this	= value;
+	Buffer += length;
+	return true;
+}
+
+FAnkrUInt256 FAnkrUInt256::operator+(const FAnkrUInt256& _other) const
+{
+	FAnkrUInt256 sum;
+	uint64 carry = 0;
+	for (int32 i = 0; i < 4; i++)
+	{
+		const uint64 partial = limbs[i] + carry;
+		carry		  = partial < carry ? 1 : 0;
+		sum.limbs[i]  = partial + _other.limbs[i];
+		carry		 += sum.limbs[i] < partial ? 1 : 0;
+	}
+	return sum;
+}
+
+FAnkrUInt256 FAnkrUInt256::operator-(const FAnkrUInt256& _other) const
+{
+	FAnkrUInt256 difference;
+	uint64 borrow = 0;
+	for (int32 i = 0; i < 4; i++)
+	{
+		const uint64 partial = limbs[i] - borrow;
+		borrow				 = limbs[i] < borrow ? 1 : 0;
+		difference.limbs[i]	 = partial - _other.limbs[i];
+		borrow				+= partial < _other.limbs[i] ? 1 : 0;
+	}
+	return difference;
+}
+
+// MultiplyAdd works on 32 bit halves, so the products fit in 64 bits without a 128 bit type.
+uint32 FAnkrUInt256::MultiplyAdd(uint32 _factor, uint32 _addend)
+{
+	uint64 carry = _addend;
+	for (uint64& limb : limbs)
+	{
+		const uint64 low  = (limb & 0xffffffffULL) * _factor + carry;
+		const uint64 high = (limb >> 32) * _factor + (low >> 32);
+		limb  = (high << 32) | (low & 0xffffffffULL);
+		carry = high >> 32;
+	}
+	return (uint32)carry;
+}
+
+uint32 FAnkrUInt256::Divide(uint32 _divisor)
+{
+	uint64 remainder = 0;
+	for (int32 i = 3; i >= 0; i--)
+	{
+		const uint64 high = (remainder << 32) | (limbs[i] >> 32);
+		remainder		  = high % _divisor;
+		const uint64 low  = (remainder << 32) | (limbs[i] & 0xffffffffULL);
+		remainder		  = low % _divisor;
+		limbs[i]		  = ((high / _divisor) << 32) | (low / _divisor);
+	}
+	return (uint32)remainder;
+}
+
+FAnkrUInt256 UAnkrUInt256Library::MakeUInt256(FString text, bool& success)
+{
+	FAnkrUInt256 value;
+	success = FAnkrUInt256::Parse(text, value);
+	return value;
+}
+
+FAnkrUInt256 UAnkrUInt256Library::Conv_Int64ToUInt256(int64 value)
+{
+	return FAnkrUInt256((uint64)FMath::Max<int64>(value, 0));
+}
+
+int64 UAnkrUInt256Library::Conv_UInt256ToInt64(const FAnkrUInt256& value)
+{
+	return value.FitsUint64() && value.limbs[0] <= (uint64)MAX_int64 ? (int64)value.limbs[0] : MAX_int64;
+}
+
+FString UAnkrUInt256Library::Conv_UInt256ToString(const FAnkrUInt256& value)
+{
+	return value.ToDecimal();
+}
+
+FString UAnkrUInt256Library::ToHexString(const FAnkrUInt256& value, int minDigits)
+{
+	return value.ToHex(minDigits);
+}
+
+bool UAnkrUInt256Library::EqualEqual_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b)
+{
+	return a == b;
+}
+
+bool UAnkrUInt256Library::NotEqual_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b)
+{
+	return a != b;
+}
+
+bool UAnkrUInt256Library::Less_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b)
+{
+	return a < b;
+}
+
+bool UAnkrUInt256Library::Greater_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b)
+{
+	return a > b;
+}
+
+FAnkrUInt256 UAnkrUInt256Library::Add_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b)
+{
+	return a + b;
+}
+
+FAnkrUInt256 UAnkrUInt256Library::Subtract_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b)
+{
+	return a - b;
+}
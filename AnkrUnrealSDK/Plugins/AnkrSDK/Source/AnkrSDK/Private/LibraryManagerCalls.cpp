@@ -0,0 +1,123 @@
+#include "AnkrCallDispatcher.h"
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+
+// The call bookkeeping of LibraryManager is the same on every platform, the platform files only implement the crossing into their native library.
+
+int LibraryManager::GetGlobalCallIndex()
+{
+	return (GlobalCallIndex.fetch_add(1, std::memory_order_relaxed) + 1) & INT_MAX;
+}
+
+// AddCall registers a pending call and returns its call index, the index is passed to the native library and handed back with the callback.
+int LibraryManager::AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate& _callComplete, EAnkrCallbackThread _callbackThread)
+{
+	FAnkrCallStruct call{};
+	call.CallComplete = _callComplete;
+	return RegisterCall(_sender, call, _callbackThread);
+}
+
+// AddCall for the calls made from C++, the function receives the success and the data of the call.
+int LibraryManager::AddCall(const char* _sender, TFunction<void(bool, const FString&)> _callComplete, EAnkrCallbackThread _callbackThread)
+{
+	FAnkrCallStruct call{};
+	call.NativeComplete = MoveTemp(_callComplete);
+	return RegisterCall(_sender, call, _callbackThread);
+}
+
+int LibraryManager::RegisterCall(const char* _sender, FAnkrCallStruct& _call, EAnkrCallbackThread _callbackThread)
+{
+	// Every native call is registered here first, so the library is loaded on first use.
+	EnsureLoaded();
+
+	// A dynamic delegate is always completed on the game thread, only the calls made from C++ can choose another thread.
+	_call.callIndex		 = GetGlobalCallIndex();
+	_call.sender		 = FString(_sender);
+	_call.callbackThread = _call.NativeComplete ? AnkrCallbackThread::Resolve(_callbackThread) : EAnkrCallbackThread::GameThread;
+
+	const int callIndex = _call.callIndex;
+	if (!CallList.Add(callIndex, std::string(_sender), MoveTemp(_call)))
+	{
+		//UE_LOG(LogTemp, Warning, TEXT("LibraryManager - AddCall - %d call is already in the call list, can not add again."), callIndex);
+		return -1;
+	}
+
+	return callIndex;
+}
+
+// FailIfUnavailable fails a call right away when the native library can't answer it, the call would never complete otherwise.
+bool LibraryManager::FailIfUnavailable(int _callIndex)
+{
+	if (IsClientAvailable())
+	{
+		return false;
+	}
+
+	FlushCall(_callIndex, false, "The native library is not available.");
+	return true;
+}
+
+// FlushCall runs on the thread of the native callback, the call is moved from the call list to the completion queue that the game thread drains.
+void LibraryManager::FlushCall(int _callIndex, bool _success, const char* _data)
+{
+	FAnkrCallStruct call{};
+	if (!CallList.Take(_callIndex, call))
+	{
+		//UE_LOG(LogTemp, Warning, TEXT("LibraryManager - FlushCall - %d call doesn't exist in the call list."), _callIndex);
+		return;
+	}
+
+	CompleteCall(call, _success, _data);
+}
+
+// SendBySender sends a call through an export that reports only the sender, the call waits while another call of the sender is in flight.
+void LibraryManager::SendBySender(const char* _sender, int _callIndex, std::function<void()> _send)
+{
+	if (SenderCalls.Send(std::string(_sender), _callIndex, _send))
+	{
+		_send();
+	}
+}
+
+// FlushCall for native callbacks that only report their sender, the call of the sender in flight is completed and the next one is sent.
+void LibraryManager::FlushCall(const char* _sender, bool _success, const char* _data)
+{
+	int callIndex = -1;
+	std::function<void()> next;
+	if (!SenderCalls.Complete(std::string(_sender), callIndex, next))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LibraryManager - FlushCall - %s has no call in flight, the callback is ignored."), UTF8_TO_TCHAR(_sender));
+		return;
+	}
+
+	FlushCall(callIndex, _success, _data);
+
+	if (next)
+	{
+		next();
+	}
+}
+
+// CompleteCall hands the completion to the game thread through the completion queue, unless the caller chose another thread for it.
+void LibraryManager::CompleteCall(FAnkrCallStruct& _call, bool _success, const char* _data)
+{
+	_call.success = _success;
+
+	// Native libraries hand a null pointer for a call without data, e.g. a nil NSString or a null jstring.
+	_call.utf8Data.assign(_data != nullptr ? _data : "");
+
+	if (_call.callbackThread == EAnkrCallbackThread::GameThread)
+	{
+		CallQueue.Push(std::move(_call));
+		return;
+	}
+
+	FAnkrCallStruct call = std::move(_call);
+	AnkrCallbackThread::Run(call.callbackThread, [call]() mutable
+		{
+			call.Execute();
+		});
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include <queue>
 #include "../../Public/AnkrDelegates.h"
 #include "RequestBodyStructure.h"
+#include "AnkrCallQueue.h"
 
 #import <Foundation/Foundation.h>
 #import "AnkrSDKUnrealMac-Swift.h"
@@ -33,30 +34,47 @@ public:
     AnkrClient* ankrClient = nullptr;
     void Load();
     void Unload();
+    bool EnsureLoaded();
+
+    std::mutex loadLock;
+    bool isLoaded = false;
+    bool isLoadFailed = false;
     
     void Initialize(bool, FString);
-    void Ping();
-    void ConnectWallet(FString);
-    void GetWallet(FString);
-    void SendABI(FString);
-    void SendTransaction(FString);
-    void CallMethod(FString);
-    void SignMessage(FString);
-    void GetResult(FString);
-    void VerifyMessage(FString);
+    void Ping(int);
+    void ConnectWallet(int, const std::string&);
+    void GetWallet(int, const std::string&);
+    void SendABI(int, const std::string&);
+    void SendTransaction(int, const std::string&);
+    void CallMethod(int, const std::string&);
+    void SignMessage(int, const std::string&);
+    void GetResult(int, const std::string&);
+    void VerifyMessage(int, const std::string&);
+    void SubmitEach(const std::vector<AnkrNativeRequest>& _requests);
+
+    /// Whether the native library answers the calls.
+    bool IsClientAvailable() { return ankrClient != nullptr; }
 
     static std::wstring GetWString(FString input);
     static std::string GetString(std::wstring _wstring);
     static FString GetFString(std::wstring _wstring);
     NSString* FStringToNSString(FString _input);
+    NSString* UTF8ToNSString(const std::string& _input);
     FString NSStringToFString(NSString* _input);
     
     void Log(FString _message);
-    int GlobalCallIndex;
-    std::unordered_map<std::string, FAnkrCallStruct> CallList;
-    std::queue<FAnkrCallStruct> CallQueue;
+    std::atomic<int> GlobalCallIndex{ 0 };
+    AnkrPendingCallTable<int, FAnkrCallStruct> CallList;
+    AnkrCompletionQueue<FAnkrCallStruct> CallQueue;
+    AnkrSenderCallQueue SenderCalls;
 
     int GetGlobalCallIndex();
-    bool AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate& _callComplete);
+    int AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate& _callComplete, EAnkrCallbackThread _callbackThread = EAnkrCallbackThread::GameThread);
+    int AddCall(const char* _sender, TFunction<void(bool, const FString&)> _callComplete, EAnkrCallbackThread _callbackThread = EAnkrCallbackThread::GameThread);
+    int RegisterCall(const char* _sender, FAnkrCallStruct& _call, EAnkrCallbackThread _callbackThread);
+    bool FailIfUnavailable(int _callIndex);
+    void FlushCall(int _callIndex, bool _success, const char* _data);
+    void SendBySender(const char* _sender, int _callIndex, std::function<void()> _send);
     void FlushCall(const char* _sender, bool _success, const char* _data);
+    void CompleteCall(FAnkrCallStruct& _call, bool _success, const char* _data);
 };
@@ -0,0 +1,402 @@
+#include "CoreMinimal.h"
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX
+#include "LibraryManager.h"
+
+// The Windows dll and the Linux so export the same C ABI, only the file and where it comes from differ.
+namespace
+{
+#if PLATFORM_WINDOWS
+	const FString LibraryPath	 = FString("AnkrSDK/Source/AnkrSDK/Private/Windows/Libraries/AnkrSDKUnrealWindows.dll");
+	const FString MissingLibrary = FString("AnkrSDKUnrealWindows.dll is missing, please download the SDK for Windows platform and copy the dll to the following path 'Plugins/AnkrSDK/Source/AnkrSDK/Private/Windows/Libraries'");
+#else
+	const FString LibraryPath	 = FString("AnkrSDK/Source/AnkrSDK/Private/Linux/Libraries/libAnkrSDKUnrealLinux.so");
+	const FString MissingLibrary = FString("libAnkrSDKUnrealLinux.so is missing, please download the SDK for Linux platform and copy the so to the following path 'Plugins/AnkrSDK/Source/AnkrSDK/Private/Linux/Libraries', or build the loopback library in 'Plugins/AnkrSDK/Tools/LinuxLoopback'");
+#endif
+}
+
+void LibraryManager::Load()
+{
+	isInitialized = false;
+
+	FString libraryPath = *FPaths::ProjectPluginsDir() + LibraryPath;
+	bool exists = FPaths::FileExists(libraryPath);
+
+	if (exists)
+	{
+		HNDL = FPlatformProcess::GetDllHandle(*libraryPath);
+		if (!HNDL)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HNDL could not be loaded."));
+			return;
+		}
+
+		InitializeFunction = (InitializeImport)FPlatformProcess::GetDllExport(HNDL, *FString("Initialize"));
+		GetDeviceIdFunction = (GetDeviceIdImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetDeviceId"));
+		GetQRCodeTextFunction = (GetQRCodeTextImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetQRCodeText"));
+		GetSessionFunction = (GetSessionImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetSession"));
+		GetAccountFunction = (GetAccountImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetAccount"));
+		GetChainIdFunction = (GetChainIdImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetChainId"));
+		PingFunction = (PingImport)FPlatformProcess::GetDllExport(HNDL, *FString("Ping"));
+		ConnectWalletFunction = (ConnectWalletImport)FPlatformProcess::GetDllExport(HNDL, *FString("ConnectWallet"));
+		GetWalletFunction = (GetWalletImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetWallet"));
+		SendABIFunction = (SendABIImport)FPlatformProcess::GetDllExport(HNDL, *FString("SendABI"));
+		SendTransactionFunction = (SendTransactionImport)FPlatformProcess::GetDllExport(HNDL, *FString("SendTransaction"));
+		CallMethodFunction = (CallMethodImport)FPlatformProcess::GetDllExport(HNDL, *FString("CallMethod"));
+		SignMessageFunction = (SignMessageImport)FPlatformProcess::GetDllExport(HNDL, *FString("SignMessage"));
+		GetResultFunction = (GetResultImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetResult"));
+		VerifyMessageFunction = (VerifyMessageImport)FPlatformProcess::GetDllExport(HNDL, *FString("VerifyMessage"));
+
+		PingIndexedFunction = (PingIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("PingIndexed"));
+		ConnectWalletIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("ConnectWalletIndexed"));
+		GetWalletIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetWalletIndexed"));
+		SendABIIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("SendABIIndexed"));
+		SendTransactionIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("SendTransactionIndexed"));
+		CallMethodIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("CallMethodIndexed"));
+		SignMessageIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("SignMessageIndexed"));
+		GetResultIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("GetResultIndexed"));
+		VerifyMessageIndexedFunction = (ContentIndexedImport)FPlatformProcess::GetDllExport(HNDL, *FString("VerifyMessageIndexed"));
+		SubmitBatchFunction = (SubmitBatchImport)FPlatformProcess::GetDllExport(HNDL, *FString("SubmitBatch"));
+
+		if (InitializeFunction != NULL)
+		{
+			isInitialized = true;
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s"), *MissingLibrary);
+		isInitialized = false;
+	}
+}
+
+void LibraryManager::Unload()
+{
+	std::lock_guard<std::mutex> lock(loadLock);
+	isLoaded	 = false;
+	isLoadFailed = false;
+
+	if (HNDL)
+	{
+		InitializeFunction = NULL;
+		GetDeviceIdFunction = NULL;
+		GetQRCodeTextFunction = NULL;
+		GetSessionFunction = NULL;
+		GetAccountFunction = NULL;
+		GetChainIdFunction = NULL;
+		PingFunction = NULL;
+		ConnectWalletFunction = NULL;
+		GetWalletFunction = NULL;
+		SendABIFunction = NULL;
+		SendTransactionFunction = NULL;
+		CallMethodFunction = NULL;
+		SignMessageFunction = NULL;
+		GetResultFunction = NULL;
+		VerifyMessageFunction = NULL;
+
+		PingIndexedFunction = NULL;
+		ConnectWalletIndexedFunction = NULL;
+		GetWalletIndexedFunction = NULL;
+		SendABIIndexedFunction = NULL;
+		SendTransactionIndexedFunction = NULL;
+		CallMethodIndexedFunction = NULL;
+		SignMessageIndexedFunction = NULL;
+		GetResultIndexedFunction = NULL;
+		VerifyMessageIndexedFunction = NULL;
+		SubmitBatchFunction = NULL;
+
+		FPlatformProcess::FreeDllHandle(HNDL);
+		HNDL = NULL;
+
+		isInitialized = false;
+	}
+}
+
+void LibraryManager::Log(FString _message)
+{
+	UE_LOG(LogTemp, Warning, TEXT("%s"), *_message);
+}
+
+void LibraryManager::Initialize(bool _isDevelopment, FString _device_id)
+{
+	if (isInitialized)
+	{
+		InitializeFunction(false, TCHAR_TO_UTF8(*_device_id), [](const char* _message) { UE_LOG(LogTemp, Warning, TEXT("%s"), *FString(_message)); });
+	}
+}
+// OnIndexedCallback is handed to the indexed exports, the call index comes back with the result.
+static void OnIndexedCallback(int _callIndex, bool _success, const char* _data)
+{
+	LibraryManager::GetInstance().FlushCall(_callIndex, _success, _data);
+}
+
+void LibraryManager::Ping(int _callIndex)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (PingIndexedFunction != NULL)
+	{
+		PingIndexedFunction(_callIndex, OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("Ping", _callIndex, [this]()
+		{
+			PingFunction([](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("Ping", _success, _data);
+				});
+		});
+}
+void LibraryManager::ConnectWallet(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (ConnectWalletIndexedFunction != NULL)
+	{
+		ConnectWalletIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("ConnectWallet", _callIndex, [this, _content]()
+		{
+			ConnectWalletFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("ConnectWallet", _success, _data);
+				});
+		});
+}
+void LibraryManager::GetWallet(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (GetWalletIndexedFunction != NULL)
+	{
+		GetWalletIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("GetWallet", _callIndex, [this, _content]()
+		{
+			GetWalletFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("GetWallet", _success, _data);
+				});
+		});
+}
+void LibraryManager::SendABI(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (SendABIIndexedFunction != NULL)
+	{
+		SendABIIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("SendABI", _callIndex, [this, _content]()
+		{
+			SendABIFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("SendABI", _success, _data);
+				});
+		});
+}
+void LibraryManager::SendTransaction(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (SendTransactionIndexedFunction != NULL)
+	{
+		SendTransactionIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("SendTransaction", _callIndex, [this, _content]()
+		{
+			SendTransactionFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("SendTransaction", _success, _data);
+				});
+		});
+}
+void LibraryManager::GetResult(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (GetResultIndexedFunction != NULL)
+	{
+		GetResultIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("GetResult", _callIndex, [this, _content]()
+		{
+			GetResultFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("GetResult", _success, _data);
+				});
+		});
+}
+void LibraryManager::CallMethod(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (CallMethodIndexedFunction != NULL)
+	{
+		CallMethodIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("CallMethod", _callIndex, [this, _content]()
+		{
+			CallMethodFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("CallMethod", _success, _data);
+				});
+		});
+}
+void LibraryManager::SignMessage(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (SignMessageIndexedFunction != NULL)
+	{
+		SignMessageIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("SignMessage", _callIndex, [this, _content]()
+		{
+			SignMessageFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("SignMessage", _success, _data);
+				});
+		});
+}
+void LibraryManager::GetSignature(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (GetResultIndexedFunction != NULL)
+	{
+		GetResultIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("GetSignature", _callIndex, [this, _content]()
+		{
+			GetResultFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("GetSignature", _success, _data);
+				});
+		});
+}
+void LibraryManager::VerifyMessage(int _callIndex, const std::string& _content)
+{
+	if (FailIfUnavailable(_callIndex))
+	{
+		return;
+	}
+
+	if (VerifyMessageIndexedFunction != NULL)
+	{
+		VerifyMessageIndexedFunction(_callIndex, _content.c_str(), OnIndexedCallback);
+		return;
+	}
+
+	SendBySender("VerifyMessage", _callIndex, [this, _content]()
+		{
+			VerifyMessageFunction(_content.c_str(), [](bool _success, const char* _data)
+				{
+					LibraryManager::GetInstance().FlushCall("VerifyMessage", _success, _data);
+				});
+		});
+}
+
+// OnBatchCallback is handed to the batch export, every completion of the batch carries its call index.
+static void OnBatchCallback(const AnkrBatchCompletion* _completions, int _count)
+{
+	LibraryManager& library = LibraryManager::GetInstance();
+	for (int i = 0; i < _count; i++)
+	{
+		library.FlushCall(_completions[i].callIndex, _completions[i].success, _completions[i].data);
+	}
+}
+
+// SubmitBatch crosses into the native library once for all the requests, the requests are sent one by one when the library has no batch export.
+void LibraryManager::SubmitBatch(const std::vector<AnkrNativeRequest>& _requests)
+{
+	if (!IsClientAvailable())
+	{
+		for (const AnkrNativeRequest& request : _requests)
+		{
+			FailIfUnavailable(request.callIndex);
+		}
+		return;
+	}
+
+	if (_requests.empty())
+	{
+		return;
+	}
+
+	if (SubmitBatchFunction == NULL)
+	{
+		AnkrSubmitEach(*this, _requests);
+		return;
+	}
+
+	std::vector<AnkrBatchRequest> batch;
+	batch.reserve(_requests.size());
+	for (const AnkrNativeRequest& request : _requests)
+	{
+		batch.push_back({ request.callIndex, request.method.c_str(), request.content.c_str() });
+	}
+
+	SubmitBatchFunction(batch.data(), (int)batch.size(), OnBatchCallback);
+}
+
+// EnsureLoaded loads the library on first use instead of at startup, it can be called from any thread and only the first call does the work.
+bool LibraryManager::EnsureLoaded()
+{
+	std::lock_guard<std::mutex> lock(loadLock);
+	if (!isLoaded && !isLoadFailed)
+	{
+		Load();
+
+		// A failed load is recorded instead of being retried by every call, Unload clears it so the library can be loaded again.
+		isLoaded	 = isInitialized;
+		isLoadFailed = !isLoaded;
+	}
+	return isLoaded;
+}
+
+#endif
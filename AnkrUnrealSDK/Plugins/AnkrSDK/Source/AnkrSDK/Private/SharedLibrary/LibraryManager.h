@@ -0,0 +1,148 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <functional>
+#include <queue>
+#include "RequestBodyStructure.h"
+#include "AnkrCallQueue.h"
+#include "../../Public/AnkrDelegates.h"
+
+// The exports of the Windows dll use the stdcall convention, the Linux so uses the default one.
+#if PLATFORM_WINDOWS
+#define ANKR_NATIVE_CALL __stdcall
+#else
+#define ANKR_NATIVE_CALL
+#endif
+
+typedef void(*LogCallbackDelegate)(const char* _message);
+typedef void(*Callback)(bool success, const char* data);
+typedef void(*IndexedCallback)(int callIndex, bool success, const char* data);
+
+struct AnkrBatchRequest
+{
+	int callIndex;
+	const char* method;
+	const char* content;
+};
+
+struct AnkrBatchCompletion
+{
+	int callIndex;
+	bool success;
+	const char* data;
+};
+
+typedef void(*BatchCallback)(const AnkrBatchCompletion* completions, int count);
+
+using InitializeImport      = void(ANKR_NATIVE_CALL*) (bool, const char*, LogCallbackDelegate);
+using GetDeviceIdImport     = const char*(ANKR_NATIVE_CALL*) ();
+using GetQRCodeTextImport   = const char* (ANKR_NATIVE_CALL*) ();
+using GetSessionImport	    = const char* (ANKR_NATIVE_CALL*) ();
+using GetAccountImport	    = const char* (ANKR_NATIVE_CALL*) ();
+using GetChainIdImport      = int(ANKR_NATIVE_CALL*) ();
+using PingImport			= void(ANKR_NATIVE_CALL*)(Callback);
+using ConnectWalletImport   = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using GetWalletImport       = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using SendABIImport         = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using SendTransactionImport = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using CallMethodImport      = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using SignMessageImport     = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using GetResultImport       = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+using VerifyMessageImport   = void(ANKR_NATIVE_CALL*)(const char*, Callback);
+
+// The indexed exports take the call index and hand it back with the callback, they are optional and the exports above are used when they are missing.
+using PingIndexedImport     = void(ANKR_NATIVE_CALL*)(int, IndexedCallback);
+using ContentIndexedImport  = void(ANKR_NATIVE_CALL*)(int, const char*, IndexedCallback);
+
+// The batch export takes several requests in one call and hands their completions back in one callback, the strings of the requests are only valid during the call.
+using SubmitBatchImport     = void(ANKR_NATIVE_CALL*)(const AnkrBatchRequest*, int, BatchCallback);
+
+class ANKRSDK_API LibraryManager
+{
+	public:
+		static LibraryManager& GetInstance()
+		{
+			static LibraryManager INSTANCE;
+			return INSTANCE;
+		}
+
+	private:
+		LibraryManager() {}
+
+	public:
+		LibraryManager(LibraryManager const&) = delete;
+		void operator = (LibraryManager const&) = delete;
+
+	public:
+
+		bool isInitialized;
+		void Load();
+		void Unload();
+		bool EnsureLoaded();
+
+		std::mutex loadLock;
+		bool isLoaded = false;
+		bool isLoadFailed = false;
+
+		void Log(FString _message);
+
+		void* HNDL = NULL;
+		InitializeImport      InitializeFunction      = NULL;
+		GetDeviceIdImport     GetDeviceIdFunction     = NULL;
+		GetQRCodeTextImport   GetQRCodeTextFunction   = NULL;
+		GetSessionImport      GetSessionFunction      = NULL;
+		GetAccountImport      GetAccountFunction      = NULL;
+		GetChainIdImport      GetChainIdFunction      = NULL;
+		PingImport            PingFunction            = NULL;
+		ConnectWalletImport   ConnectWalletFunction   = NULL;
+		GetWalletImport		  GetWalletFunction       = NULL;
+		SendABIImport		  SendABIFunction		  = NULL;
+		SendTransactionImport SendTransactionFunction = NULL;
+		CallMethodImport	  CallMethodFunction      = NULL;
+		SignMessageImport	  SignMessageFunction     = NULL;
+		GetResultImport		  GetResultFunction       = NULL;
+		VerifyMessageImport	  VerifyMessageFunction   = NULL;
+
+		PingIndexedImport     PingIndexedFunction            = NULL;
+		ContentIndexedImport  ConnectWalletIndexedFunction   = NULL;
+		ContentIndexedImport  GetWalletIndexedFunction       = NULL;
+		ContentIndexedImport  SendABIIndexedFunction         = NULL;
+		ContentIndexedImport  SendTransactionIndexedFunction = NULL;
+		ContentIndexedImport  CallMethodIndexedFunction      = NULL;
+		ContentIndexedImport  SignMessageIndexedFunction     = NULL;
+		ContentIndexedImport  GetResultIndexedFunction       = NULL;
+		ContentIndexedImport  VerifyMessageIndexedFunction   = NULL;
+		SubmitBatchImport     SubmitBatchFunction            = NULL;
+
+		void Initialize(bool, FString);
+		void Ping(int);
+		void ConnectWallet(int, const std::string&);
+		void GetWallet(int, const std::string&);
+		void SendABI(int, const std::string&);
+		void SendTransaction(int, const std::string&);
+		void GetResult(int, const std::string&);
+		void CallMethod(int, const std::string&);
+		void SignMessage(int, const std::string&);
+		void GetSignature(int, const std::string&);
+		void VerifyMessage(int, const std::string&);
+		void SubmitBatch(const std::vector<AnkrNativeRequest>& _requests);
+
+		/// Whether the native library answers the calls.
+		bool IsClientAvailable() { return isInitialized; }
+
+		std::atomic<int> GlobalCallIndex{ 0 };
+		AnkrPendingCallTable<int, FAnkrCallStruct> CallList;
+		AnkrCompletionQueue<FAnkrCallStruct> CallQueue;
+		AnkrSenderCallQueue SenderCalls;
+
+		int GetGlobalCallIndex();
+		int AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate& _callComplete, EAnkrCallbackThread _callbackThread = EAnkrCallbackThread::GameThread);
+		int AddCall(const char* _sender, TFunction<void(bool, const FString&)> _callComplete, EAnkrCallbackThread _callbackThread = EAnkrCallbackThread::GameThread);
+		int RegisterCall(const char* _sender, FAnkrCallStruct& _call, EAnkrCallbackThread _callbackThread);
+		bool FailIfUnavailable(int _callIndex);
+		void FlushCall(int _callIndex, bool _success, const char* _data);
+		void SendBySender(const char* _sender, int _callIndex, std::function<void()> _send);
+		void FlushCall(const char* _sender, bool _success, const char* _data);
+		void CompleteCall(FAnkrCallStruct& _call, bool _success, const char* _data);
+};
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "AnkrAbiCache.h"
+#include "AnkrClient.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The abi hash cache of the project is moved aside while a test runs and put back afterwards.
+	struct FAbiCacheBackup
+	{
+		bool exists = false;
+		FString content;
+
+		FAbiCacheBackup()
+		{
+			exists = FFileHelper::LoadFileToString(content, *AnkrAbiCache::GetCachePath());
+			IFileManager::Get().Delete(*AnkrAbiCache::GetCachePath(), false, false, true);
+			AnkrAbiCache::Reload();
+		}
+
+		~FAbiCacheBackup()
+		{
+			IFileManager::Get().Delete(*AnkrAbiCache::GetCachePath(), false, false, true);
+			if (exists)
+			{
+				FFileHelper::SaveStringToFile(content, *AnkrAbiCache::GetCachePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+			}
+			AnkrAbiCache::Reload();
+		}
+	};
+
+	FString MakeAbi(const FString& _method)
+	{
+		return "[{\"inputs\":[],\"name\":\"" + _method + "\",\"outputs\":[],\"stateMutability\":\"view\",\"type\":\"function\"}]";
+	}
+
+	int32 CountLines()
+	{
+		TArray<FString> lines;
+		FFileHelper::LoadFileToStringArray(lines, *AnkrAbiCache::GetCachePath());
+		lines.RemoveAll([](const FString& line) { return line.IsEmpty(); });
+		return lines.Num();
+	}
+
+	const FString RejectedContent = TEXT("{\"result\":false,\"msg\":\"Unknown abi hash.\",\"data\":{}}");
+
+	// changeHat of the GameCharacter contract, its canonical form and MD5 were computed outside of the SDK.
+	const FString ChangeHatAbi = TEXT("[{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"internalType\":\"address\",\"name\":\"hat\",\"type\":\"address\"}],\"name\":\"changeHat\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"}]");
+	const FString ChangeHatHash = TEXT("15798a87201e63a5e67815bd893830ce");
+
+	const FString ChangeHatAbiFormatted = TEXT("[\n  {\n    \"type\": \"function\",\n    \"name\": \"changeHat\",\n    \"stateMutability\": \"nonpayable\",\n    \"outputs\": [],\n")
+		TEXT("    \"inputs\": [\n      { \"type\": \"uint256\", \"name\": \"characterId\", \"internalType\": \"uint256\" },\n      { \"name\": \"hat\", \"internalType\": \"address\", \"type\": \"address\" }\n    ]\n  }\n]");
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiCachePersistenceTest, "AnkrSDK.AbiCache.Persistence", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A stored hash is found again by a new session, the last hash of an abi wins, a removed hash stays removed and the file is compacted to one line per abi.
+bool FAnkrAbiCachePersistenceTest::RunTest(const FString& Parameters)
+{
+	const FAbiCacheBackup backup;
+
+	const FString first	 = MakeAbi(TEXT("first"));
+	const FString second = MakeAbi(TEXT("second"));
+
+	FString abiHash;
+	TestFalse(TEXT("An empty cache knows no abi"), AnkrAbiCache::Find(first, abiHash));
+
+	AnkrAbiCache::Store(first, TEXT("hash-1"));
+	AnkrAbiCache::Store(first, TEXT("hash-1"));
+	TestEqual(TEXT("Storing the same hash again writes nothing"), CountLines(), 1);
+
+	AnkrAbiCache::Store(first, TEXT("hash-2"));
+	AnkrAbiCache::Store(second, TEXT("hash-3"));
+	TestEqual(TEXT("Every change is appended"), CountLines(), 3);
+
+	AnkrAbiCache::Reload();
+	TestTrue(TEXT("The hash is loaded by a new session"), AnkrAbiCache::Find(first, abiHash));
+	TestEqual(TEXT("The last hash of an abi wins"), abiHash, FString(TEXT("hash-2")));
+	TestTrue(TEXT("The second abi is loaded"), AnkrAbiCache::Find(second, abiHash) && abiHash.Equals(TEXT("hash-3")));
+	TestEqual(TEXT("The file is compacted to one line per abi"), CountLines(), 2);
+
+	AnkrAbiCache::Invalidate(TEXT("hash-3"));
+	TestFalse(TEXT("An invalidated hash is removed"), AnkrAbiCache::Find(second, abiHash));
+
+	AnkrAbiCache::Reload();
+	TestFalse(TEXT("An invalidated hash stays removed in a new session"), AnkrAbiCache::Find(second, abiHash));
+	TestTrue(TEXT("The other hashes are kept"), AnkrAbiCache::Find(first, abiHash) && abiHash.Equals(TEXT("hash-2")));
+	TestEqual(TEXT("The removal is compacted away"), CountLines(), 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiCacheValidateTest, "AnkrSDK.AbiCache.Validate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A cached hash is checked by the first response of a session only, a rejection removes it from the cache on disk.
+bool FAnkrAbiCacheValidateTest::RunTest(const FString& Parameters)
+{
+	const FAbiCacheBackup backup;
+	const FString abi = MakeAbi(TEXT("validated"));
+
+	FString abiHash;
+	AnkrAbiCache::Store(abi, TEXT("hash-stored"));
+	TestFalse(TEXT("A hash returned by the Ankr API in this session is not checked"), AnkrAbiCache::Validate(TEXT("hash-stored"), RejectedContent));
+	TestTrue(TEXT("The hash stays in the cache"), AnkrAbiCache::Find(abi, abiHash));
+
+	AnkrAbiCache::Reload();
+	TestFalse(TEXT("An accepted hash is not rejected"), AnkrAbiCache::Validate(TEXT("hash-stored"), TEXT("{\"result\":true,\"data\":\"0\"}")));
+	TestFalse(TEXT("Only the first response of a session is checked"), AnkrAbiCache::Validate(TEXT("hash-stored"), RejectedContent));
+
+	AnkrAbiCache::Reload();
+	TestFalse(TEXT("A failure that is not about the abi keeps the hash"), AnkrAbiCache::Validate(TEXT("hash-stored"), TEXT("{\"result\":false,\"msg\":\"Mock backend error.\"}")));
+	TestTrue(TEXT("A rejection of the abi is detected"), AnkrAbiCache::Validate(TEXT("hash-stored"), RejectedContent));
+	TestFalse(TEXT("The rejected hash is removed"), AnkrAbiCache::Find(abi, abiHash));
+
+	AnkrAbiCache::Reload();
+	TestFalse(TEXT("The rejected hash is removed from disk"), AnkrAbiCache::Find(abi, abiHash));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiCacheLocalHashTest, "AnkrSDK.AbiCache.LocalHash", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The local hash of an abi is pinned to a known value and does not depend on the formatting of the abi, the "abi" endpoint of the mock backend returns the same hash.
+bool FAnkrAbiCacheLocalHashTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("The abi is written in its canonical form"), AnkrAbiCache::Canonicalize(ChangeHatAbi), ChangeHatAbi);
+	TestEqual(TEXT("The local hash is the MD5 of the canonical abi"), AnkrAbiCache::ComputeHash(ChangeHatAbi), ChangeHatHash);
+	TestEqual(TEXT("The whitespace and the order of the keys are ignored"), AnkrAbiCache::ComputeHash(ChangeHatAbiFormatted), ChangeHatHash);
+	TestNotEqual(TEXT("Another abi has another hash"), AnkrAbiCache::ComputeHash(MakeAbi(TEXT("changeHat"))), ChangeHatHash);
+
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	AnkrTransport::UseMockBackend(true, FAnkrMockBackendSettings());
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> mock = AnkrTransport::GetMockBackend();
+
+	int code = EHttpResponseCodes::Ok;
+	const FString response = mock->Respond("abi", "{\"abi\":\"" + ChangeHatAbiFormatted.ReplaceCharWithEscapedChar() + "\"}", code);
+	TestTrue(TEXT("The mock backend returns the local hash"), response.Contains("\"abi\":\"" + ChangeHatHash + "\""));
+
+	// With local hashing the hash is answered without a request, an abi the cache already knows would be answered from the cache instead.
+	const bool wasLocalHashing = AnkrAbiCache::IsLocalHashing();
+	AnkrAbiCache::SetLocalHashing(true);
+
+	FString cachedHash;
+	if (!AnkrAbiCache::Find(ChangeHatAbiFormatted, cachedHash))
+	{
+		UAnkrClient* client		= NewObject<UAnkrClient>();
+		const int numRequests	= mock->GetNumRequests();
+
+		FString localHash;
+		client->GetABIHash(ChangeHatAbiFormatted, EAnkrCallbackThread::GameThread, [&localHash](FString content, FString abiHash) { localHash = abiHash; });
+		TestEqual(TEXT("GetABIHash computes the pinned hash"), localHash, ChangeHatHash);
+		TestEqual(TEXT("No request is sent for a local hash"), mock->GetNumRequests(), numRequests);
+
+		FString abi;
+		TestTrue(TEXT("The abi is kept in case the Ankr API rejects the hash"), AnkrAbiCache::TakeLocalAbi(ChangeHatHash, abi));
+	}
+
+	AnkrAbiCache::SetLocalHashing(wasLocalHashing);
+	if (!wasMockBackend)
+	{
+		AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+	}
+	return true;
+}
+
+#endif
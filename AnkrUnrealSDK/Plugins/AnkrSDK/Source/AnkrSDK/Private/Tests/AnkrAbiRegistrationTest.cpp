@@ -0,0 +1,83 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrClient.h"
+#include "AnkrAbiCache.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The state of the call is written by the thread that delivers the result and read by the latent command on the game thread.
+	struct FAnkrRegistrationState
+	{
+		TAtomic<bool> isDone{ false };
+		TAtomic<bool> isOnGameThread{ true };
+		FString data;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrRejectedAbiRegistrationTest, "AnkrSDK.AbiCache.RegisterRejectedAbi", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A local hash the mock backend does not know is registered and the call is retried, the result still reaches the thread the caller chose.
+bool FAnkrRejectedAbiRegistrationTest::RunTest(const FString& Parameters)
+{
+	const bool wasLocalHashing = AnkrAbiCache::IsLocalHashing();
+	AnkrAbiCache::SetLocalHashing(true);
+
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = true;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> mock = AnkrTransport::GetMockBackend();
+	const int numRequests = mock->GetNumRequests();
+
+	UAnkrClient* client = NewObject<UAnkrClient>();
+	client->AddToRoot();
+
+	// The method name is unique so the abi is never answered from the abi cache of an earlier run.
+	const FString method = "registration" + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	const FString abi	 = "[{\"inputs\":[],\"name\":\"" + method + "\",\"outputs\":[],\"stateMutability\":\"view\",\"type\":\"function\"}]";
+
+	FString localHash;
+	client->GetABIHash(abi, EAnkrCallbackThread::GameThread, [&localHash](FString content, FString abiHash) { localHash = abiHash; });
+	TestEqual(TEXT("The abi hash is computed locally"), localHash, AnkrAbiCache::ComputeHash(abi));
+
+	TSharedRef<FAnkrRegistrationState, ESPMode::ThreadSafe> state = MakeShared<FAnkrRegistrationState, ESPMode::ThreadSafe>();
+	{
+		FAnkrCallbackThreadScope scope(EAnkrCallbackThread::TaskThread);
+		client->CallMethod("0x0000000000000000000000000000000000000001", localHash, method, "[]", FAnkrCallCompleteDelegate::CreateLambda([state](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+			{
+				state->data			  = response;
+				state->isOnGameThread = IsInGameThread();
+				state->isDone		  = true;
+			}));
+	}
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, mock, numRequests, deadline, wasLocalHashing, wasMockBackend]()
+		{
+			if (!state->isDone && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("The call completes"), state->isDone.Load());
+			TestTrue(TEXT("The retried call succeeds"), state->data.Contains(TEXT("\"result\":true")));
+			TestFalse(TEXT("The result of the retried call is delivered on the chosen thread"), state->isOnGameThread.Load());
+
+			TestEqual(TEXT("The call, the registration of the abi and the retry are sent"), mock->GetNumRequests() - numRequests, 3);
+
+			client->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			AnkrAbiCache::SetLocalHashing(wasLocalHashing);
+			return true;
+		}));
+	return true;
+}
+
+#endif
@@ -0,0 +1,351 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrAbi.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrClient.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The calls of the examples in the Solidity ABI specification, the calldata is written one selector and one word per line.
+	const FString BazCalldata = TEXT("0xcdcd77c0")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000045")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001");
+
+	const FString BarCalldata = TEXT("0xfce353f6")
+		TEXT("6162630000000000000000000000000000000000000000000000000000000000")
+		TEXT("6465660000000000000000000000000000000000000000000000000000000000");
+
+	const FString SamCalldata = TEXT("0xa5643bf2")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000060")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000a0")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000004")
+		TEXT("6461766500000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000003")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000003");
+
+	const FString FCalldata = TEXT("0x8be65246")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000123")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000080")
+		TEXT("3132333435363738393000000000000000000000000000000000000000000000")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000e0")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000456")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000789")
+		TEXT("000000000000000000000000000000000000000000000000000000000000000d")
+		TEXT("48656c6c6f2c20776f726c642100000000000000000000000000000000000000");
+
+	const FString GCalldata = TEXT("0x2289b18c")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000040")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000140")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000040")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000a0")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000003")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000003")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000060")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000a0")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000e0")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000003")
+		TEXT("6f6e650000000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000003")
+		TEXT("74776f0000000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000005")
+		TEXT("7468726565000000000000000000000000000000000000000000000000000000");
+
+	const FString TransferCalldata = TEXT("0xa9059cbb")
+		TEXT("000000000000000000000000d0ef33b38d8525728902d90b20d6e2f303b8dc2c")
+		TEXT("0000000000000000000000000000000000000000000000000de0b6b3a7640000");
+
+	const FString TestAbi = TEXT("[")
+		TEXT("{\"inputs\":[{\"internalType\":\"bytes\",\"name\":\"name\",\"type\":\"bytes\"},{\"internalType\":\"bool\",\"name\":\"flag\",\"type\":\"bool\"},{\"internalType\":\"uint256[]\",\"name\":\"values\",\"type\":\"uint256[]\"}],\"name\":\"sam\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},")
+		TEXT("{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"a\",\"type\":\"uint256\"},{\"internalType\":\"uint32[]\",\"name\":\"b\",\"type\":\"uint32[]\"},{\"internalType\":\"bytes10\",\"name\":\"c\",\"type\":\"bytes10\"},{\"internalType\":\"bytes\",\"name\":\"d\",\"type\":\"bytes\"}],\"name\":\"f\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},")
+		TEXT("{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"amount\",\"type\":\"uint256\"}],\"name\":\"transfer\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"nonpayable\",\"type\":\"function\"}")
+		TEXT("]");
+
+	// Two overloads of set, the arguments pick the overload.
+	const FString OverloadAbi = TEXT("[")
+		TEXT("{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"value\",\"type\":\"uint256\"}],\"name\":\"set\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},")
+		TEXT("{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"value\",\"type\":\"uint256\"},{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"}],\"name\":\"set\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},")
+		TEXT("{\"anonymous\":false,\"inputs\":[],\"name\":\"Set\",\"type\":\"event\"}")
+		TEXT("]");
+
+	// The state of a call is written by the thread that delivers the result and read by the latent command on the game thread.
+	struct FAnkrValidationState
+	{
+		TAtomic<int> numResults{ 0 };
+		FString transactionResponse;
+		FString callResponse;
+	};
+
+	FAnkrAbiValue Text(const char* _text)
+	{
+		return FAnkrAbiValue::Bytes((const uint8*)_text, FCStringAnsi::Strlen(_text));
+	}
+
+	FString EncodeCall(uint32 _selector, const TArray<FAnkrAbiValue>& _values)
+	{
+		TArray<uint8> calldata;
+		AnkrAbi::EncodeCall(_selector, _values, calldata);
+		return AnkrAbi::ToHex(calldata);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiEncodeCallTest, "AnkrSDK.Abi.EncodeCall", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Typed values are encoded to the calldata of the examples of the specification, static and dynamic values, nested arrays and fixed size arrays.
+bool FAnkrAbiEncodeCallTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("baz(uint32,bool)"), EncodeCall(0xcdcd77c0, { FAnkrAbiValue::Uint(69), FAnkrAbiValue::Bool(true) }), BazCalldata);
+
+	TestEqual(TEXT("bar(bytes3[2])"), EncodeCall(0xfce353f6, {
+		FAnkrAbiValue::Tuple({ FAnkrAbiValue::FixedBytes((const uint8*)"abc", 3), FAnkrAbiValue::FixedBytes((const uint8*)"def", 3) }) }), BarCalldata);
+
+	TestEqual(TEXT("sam(bytes,bool,uint256[])"), EncodeCall(0xa5643bf2, {
+		Text("dave"),
+		FAnkrAbiValue::Bool(true),
+		FAnkrAbiValue::Array({ FAnkrAbiValue::Uint(1), FAnkrAbiValue::Uint(2), FAnkrAbiValue::Uint(3) }) }), SamCalldata);
+
+	TestEqual(TEXT("f(uint256,uint32[],bytes10,bytes)"), EncodeCall(0x8be65246, {
+		FAnkrAbiValue::Uint(0x123),
+		FAnkrAbiValue::Array({ FAnkrAbiValue::Uint(0x456), FAnkrAbiValue::Uint(0x789) }),
+		FAnkrAbiValue::FixedBytes((const uint8*)"1234567890", 10),
+		Text("Hello, world!") }), FCalldata);
+
+	TestEqual(TEXT("g(uint256[][],string[])"), EncodeCall(0x2289b18c, {
+		FAnkrAbiValue::Array({ FAnkrAbiValue::Array({ FAnkrAbiValue::Uint(1), FAnkrAbiValue::Uint(2) }), FAnkrAbiValue::Array({ FAnkrAbiValue::Uint(3) }) }),
+		FAnkrAbiValue::Array({ FAnkrAbiValue::String("one"), FAnkrAbiValue::String("two"), FAnkrAbiValue::String("three") }) }), GCalldata);
+
+	TArray<uint8> address;
+	AnkrAbi::FromHex("0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C", address);
+	TestEqual(TEXT("transfer(address,uint256)"), EncodeCall(0xa9059cbb, { FAnkrAbiValue::Address(address.GetData()), FAnkrAbiValue::Uint(1000000000000000000ull) }), TransferCalldata);
+
+	// Encode appends the arguments without a selector after what the buffer already holds.
+	TArray<uint8> buffer = { 0xcd, 0xcd, 0x77, 0xc0 };
+	AnkrAbi::Encode({ FAnkrAbiValue::Uint(69), FAnkrAbiValue::Bool(true) }, buffer);
+	TestEqual(TEXT("Encode appends the arguments"), AnkrAbi::ToHex(buffer), BazCalldata);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiEncodeArgumentsTest, "AnkrSDK.Abi.EncodeArguments", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Arguments written for the Ankr API, as a json array or separated by commas, are encoded to the same calldata as the typed values.
+bool FAnkrAbiEncodeArgumentsTest::RunTest(const FString& Parameters)
+{
+	const FAnkrContract contract(TEXT("AbiTest"), TEXT("0x0000000000000000000000000000000000000001"), TestAbi);
+
+	const TArray<TPair<FString, FString>> vectors =
+	{
+		{ TEXT("sam"),		TEXT("[\"0x64617665\", true, [1, 2, 3]]") },
+		{ TEXT("sam"),		TEXT("0x64617665, true, [1, 2, 3]") },
+		{ TEXT("f"),		TEXT("[\"0x123\", [\"0x456\", 1929], \"0x31323334353637383930\", \"0x48656c6c6f2c20776f726c6421\"]") },
+		{ TEXT("transfer"), TEXT("[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\", \"1000000000000000000\"]") },
+		{ TEXT("transfer"), TEXT("0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C, 0xde0b6b3a7640000") },
+	};
+	const TArray<FString> expected = { SamCalldata, SamCalldata, FCalldata, TransferCalldata, TransferCalldata };
+
+	for (int32 i = 0; i < vectors.Num(); i++)
+	{
+		TArray<uint8> calldata;
+		FString error;
+		const bool isEncoded = contract.EncodeCall(vectors[i].Key, vectors[i].Value, calldata, error);
+
+		TestTrue(FString::Printf(TEXT("%s %s is encoded: %s"), *vectors[i].Key, *vectors[i].Value, *error), isEncoded);
+		TestEqual(FString::Printf(TEXT("%s %s"), *vectors[i].Key, *vectors[i].Value), AnkrAbi::ToHex(calldata), expected[i]);
+	}
+
+	TArray<uint8> calldata;
+	FString error;
+	TestFalse(TEXT("A uint32 that does not fit is rejected"), contract.EncodeCall(TEXT("f"), TEXT("[1, [4294967296], \"0x31323334353637383930\", \"0x\"]"), calldata, error));
+	TestFalse(TEXT("A missing argument is rejected"), contract.EncodeCall(TEXT("transfer"), TEXT("[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\"]"), calldata, error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiDecodeOutputValuesTest, "AnkrSDK.Abi.DecodeOutputValues", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The outputs of balanceOfBatch are handed to blueprints as typed values, the uint256[] has the text and the value of every balance.
+bool FAnkrAbiDecodeOutputValuesTest::RunTest(const FString& Parameters)
+{
+	AnkrContractRegistry::Register(TEXT("AnkrSDK.AbiTest"), TEXT("0x0000000000000000000000000000000000000001"), AnkrContractRegistry::Get(CONTRACT_GAME_ITEM).GetABI());
+
+	const FString data = TEXT("0x")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000020")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000005")
+		TEXT("8000000000000000000000000000000000000000000000000000000000000000");
+
+	TArray<FAnkrAbiOutput> outputs;
+	FString error;
+	if (!TestTrue(TEXT("The balances are decoded"), UAnkrContractLibrary::DecodeOutputValues(TEXT("AnkrSDK.AbiTest"), TEXT("balanceOfBatch"), data, outputs, error)) || !TestEqual(TEXT("balanceOfBatch has one output"), outputs.Num(), 1))
+	{
+		return false;
+	}
+
+	FAnkrUInt256 large;
+	FAnkrUInt256::Parse(TEXT("0x8000000000000000000000000000000000000000000000000000000000000000"), large);
+
+	TestEqual(TEXT("The type of the output"), outputs[0].type, FString(TEXT("uint256[]")));
+	TestEqual(TEXT("The balances as text"), outputs[0].items, TArray<FString>({ TEXT("5"), large.ToDecimal() }));
+	TestTrue(TEXT("The balances as values"), outputs[0].numbers.Num() == 2 && outputs[0].numbers[0] == FAnkrUInt256(5) && outputs[0].numbers[1] == large);
+	TestFalse(TEXT("Data that is cut short is rejected"), UAnkrContractLibrary::DecodeOutputValues(TEXT("AnkrSDK.AbiTest"), TEXT("balanceOfBatch"), data.LeftChop(64), outputs, error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiMethodIndexTest, "AnkrSDK.Abi.MethodIndex", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The functions of an abi are indexed by name with every overload and by selector, events are skipped.
+bool FAnkrAbiMethodIndexTest::RunTest(const FString& Parameters)
+{
+	const FAnkrContract contract(TEXT("AbiTest"), TEXT("0x0000000000000000000000000000000000000001"), TestAbi);
+
+	TestEqual(TEXT("Every function is indexed"), contract.GetMethods().Num(), 3);
+	TestNull(TEXT("An unknown method is not found"), contract.FindMethods(TEXT("unknown")));
+	TestNull(TEXT("An unknown selector is not found"), contract.FindMethodBySelector(0xdeadbeef));
+
+	const TArray<FAnkrAbiMethod>* transfer = contract.FindMethods(TEXT("transfer"));
+	if (TestNotNull(TEXT("transfer is found"), transfer) && TestEqual(TEXT("transfer has one overload"), transfer->Num(), 1))
+	{
+		TestEqual(TEXT("The signature of transfer"), (*transfer)[0].GetSignature(), FString(TEXT("transfer(address,uint256)")));
+		TestEqual(TEXT("The selector of transfer"), (*transfer)[0].selector, FString(TEXT("0xa9059cbb")));
+		TestFalse(TEXT("transfer is not read only"), (*transfer)[0].IsReadOnly());
+	}
+
+	const TArray<uint32> selectors = { 0xa9059cbb, 0xa5643bf2, 0x8be65246 };
+	const TArray<FString> names	   = { TEXT("transfer"), TEXT("sam"), TEXT("f") };
+	for (int32 i = 0; i < selectors.Num(); i++)
+	{
+		const FAnkrAbiMethod* method = contract.FindMethodBySelector(selectors[i]);
+		TestTrue(FString::Printf(TEXT("0x%08x is %s"), selectors[i], *names[i]), method != nullptr && method->name.Equals(names[i]));
+	}
+
+	const FAnkrContract overloads(TEXT("OverloadTest"), TEXT("0x0000000000000000000000000000000000000002"), OverloadAbi);
+	const TArray<FAnkrAbiMethod>* set = overloads.FindMethods(TEXT("set"));
+	TestTrue(TEXT("Both overloads of set are indexed"), set != nullptr && set->Num() == 2);
+	TestNull(TEXT("The event is skipped"), overloads.FindMethods(TEXT("Set")));
+	TestTrue(TEXT("Each overload has its own selector"), set != nullptr && set->Num() == 2 && (*set)[0].selectorId != (*set)[1].selectorId
+		&& overloads.FindMethodBySelector((*set)[1].selectorId) != nullptr && overloads.FindMethodBySelector((*set)[1].selectorId)->inputs.Num() == 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiValidateArgumentsTest, "AnkrSDK.Abi.ValidateArguments", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Arguments are checked against the inputs of the method and written back as a normalized json array, the overload that accepts them is used.
+bool FAnkrAbiValidateArgumentsTest::RunTest(const FString& Parameters)
+{
+	const FAnkrContract contract(TEXT("AbiTest"), TEXT("0x0000000000000000000000000000000000000001"), TestAbi);
+
+	FString normalized, error;
+	TestTrue(TEXT("Values in any form are accepted"), contract.ValidateArguments(TEXT("sam"), TEXT("[\"0x64617665\", \"TRUE\", [\"007\", \"0x0A\", 3]]"), normalized, error));
+	TestEqual(TEXT("The values are normalized"), normalized, FString(TEXT("[\"0x64617665\",true,[\"7\",\"0xa\",\"3\"]]")));
+
+	TestTrue(TEXT("Values separated by commas are accepted"), contract.ValidateArguments(TEXT("transfer"), TEXT("0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C, 1000"), normalized, error));
+	TestEqual(TEXT("Values separated by commas are written as a json array"), normalized, FString(TEXT("[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\",\"1000\"]")));
+
+	const TArray<TPair<FString, FString>> invalid =
+	{
+		{ TEXT("unknown"),	TEXT("[]") },
+		{ TEXT("transfer"), TEXT("[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\"]") },
+		{ TEXT("transfer"), TEXT("[\"0x1234\", 1]") },
+		{ TEXT("transfer"), TEXT("[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\", -1]") },
+		{ TEXT("transfer"), TEXT("[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\", \"0x10000000000000000000000000000000000000000000000000000000000000000\"]") },
+		{ TEXT("sam"),		TEXT("[\"0x646\", true, []]") },
+		{ TEXT("sam"),		TEXT("[\"0x64617665\", \"yes\", []]") },
+		{ TEXT("sam"),		TEXT("[\"0x64617665\", true, 1]") },
+		{ TEXT("f"),		TEXT("[1, [4294967296], \"0x31323334353637383930\", \"0x\"]") },
+	};
+	for (const TPair<FString, FString>& call : invalid)
+	{
+		error.Empty();
+		TestFalse(FString::Printf(TEXT("%s %s is rejected"), *call.Key, *call.Value), contract.ValidateArguments(call.Key, call.Value, normalized, error));
+		TestFalse(FString::Printf(TEXT("%s %s has an error"), *call.Key, *call.Value), error.IsEmpty());
+	}
+
+	const FAnkrContract overloads(TEXT("OverloadTest"), TEXT("0x0000000000000000000000000000000000000002"), OverloadAbi);
+	TestTrue(TEXT("The overload with one input accepts one value"), overloads.ValidateArguments(TEXT("set"), TEXT("[1]"), normalized, error));
+	TestTrue(TEXT("The overload with two inputs accepts two values"), overloads.ValidateArguments(TEXT("set"), TEXT("[1, \"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\"]"), normalized, error));
+	TestFalse(TEXT("No overload accepts three values"), overloads.ValidateArguments(TEXT("set"), TEXT("[1, 2, 3]"), normalized, error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrAbiRejectLocallyTest, "AnkrSDK.Abi.RejectWithoutRequest", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// CallMethod and SendTransaction fail a call to a registered contract whose arguments do not fit its abi without sending a request, a valid call is sent.
+bool FAnkrAbiRejectLocallyTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = false;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> mock = AnkrTransport::GetMockBackend();
+	const int numRequests = mock->GetNumRequests();
+
+	// The address is unique so the contract registered by the test never replaces one of the project.
+	const FString address = "0x" + FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower() + "00000000";
+	AnkrContractRegistry::Register("AnkrSDK.AbiTest." + address, address, TestAbi);
+
+	UAnkrClient* client = NewObject<UAnkrClient>();
+	client->AddToRoot();
+
+	TSharedRef<FAnkrValidationState, ESPMode::ThreadSafe> state = MakeShared<FAnkrValidationState, ESPMode::ThreadSafe>();
+	client->SendTransaction(address, "abi", "transfer", "[\"0x1234\", 1]", FAnkrCallCompleteDelegate::CreateLambda([state](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+		{
+			state->transactionResponse = response;
+			state->numResults++;
+		}));
+	client->CallMethod(address, "abi", "sam", "[]", FAnkrCallCompleteDelegate::CreateLambda([state](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+		{
+			state->callResponse = response;
+			state->numResults++;
+		}));
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, mock, numRequests, address, deadline]()
+		{
+			if (state->numResults < 2 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("The invalid transaction fails"), state->transactionResponse.Contains(TEXT("\"result\":false")));
+			TestTrue(TEXT("The invalid call fails"), state->callResponse.Contains(TEXT("\"result\":false")));
+			TestEqual(TEXT("No request is sent for invalid arguments"), mock->GetNumRequests(), numRequests);
+
+			client->CallMethod(address, "abi", "transfer", "[\"0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C\", 1]", FAnkrCallCompleteDelegate::CreateLambda([state](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+				{
+					state->callResponse = response;
+					state->numResults++;
+				}));
+			return true;
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, mock, numRequests, deadline, wasMockBackend]()
+		{
+			if (state->numResults < 3 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("The valid call succeeds"), state->callResponse.Contains(TEXT("\"result\":true")));
+			TestEqual(TEXT("Only the valid call is sent"), mock->GetNumRequests() - numRequests, 1);
+
+			client->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrCallDispatcher.h"
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS && ANKR_WITH_NATIVE_LIBRARY
+
+namespace
+{
+	// Every completion takes this long on the game thread, so a budget of a few milliseconds only fits a few of them.
+	const float CompletionMs = 0.5f;
+
+	// Completes the calls like native callbacks, their completions wait in the CallQueue for the dispatcher.
+	void QueueCompletions(int _count, int& _numExecuted)
+	{
+		LibraryManager& library = LibraryManager::GetInstance();
+		for (int i = 0; i < _count; i++)
+		{
+			const int callIndex = library.AddCall("CallMethod", [&_numExecuted](bool _success, const FString& _data)
+				{
+					_numExecuted++;
+					FPlatformProcess::Sleep(CompletionMs / 1000.0f);
+				}, EAnkrCallbackThread::GameThread);
+			library.FlushCall(callIndex, true, "{}");
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrCallDispatcherBudgetTest, "AnkrSDK.CallDispatcher.FrameBudget", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A burst of completions is spread over several frames by the budget, the frames that run out carry the rest over and the stats follow the queue.
+bool FAnkrCallDispatcherBudgetTest::RunTest(const FString& Parameters)
+{
+	FAnkrCallDispatcher* dispatcher = FAnkrCallDispatcher::Get();
+	if (!TestNotNull(TEXT("The module creates the dispatcher"), dispatcher))
+	{
+		return false;
+	}
+
+	const float previousBudget = dispatcher->GetFrameBudget();
+	dispatcher->SetFrameBudget(2.0f);
+
+	// Completions left by other calls are dispatched first, so the burst starts on an empty queue.
+	while (!LibraryManager::GetInstance().CallQueue.IsEmpty())
+	{
+		dispatcher->Tick(0.0f);
+	}
+
+	const int total = 40;
+	int numExecuted = 0;
+	QueueCompletions(total, numExecuted);
+
+	const FAnkrCallDispatchStats before = dispatcher->GetStats();
+	TestEqual(TEXT("The queue depth counts the burst"), before.queueDepth, total);
+
+	dispatcher->Tick(0.0f);
+	FAnkrCallDispatchStats stats = dispatcher->GetStats();
+	TestTrue(TEXT("A frame dispatches at least one completion"), stats.dispatchedLastFrame >= 1);
+	TestTrue(TEXT("A frame stops once the budget runs out"), stats.dispatchedLastFrame < total);
+	TestEqual(TEXT("The completions that were dispatched are executed"), numExecuted, stats.dispatchedLastFrame);
+	TestEqual(TEXT("The rest stays queued"), stats.queueDepth, total - numExecuted);
+	TestEqual(TEXT("The frame is counted as carried over"), stats.carriedOverFrames, before.carriedOverFrames + 1);
+	TestTrue(TEXT("The time of the frame is measured"), stats.lastFrameMs >= CompletionMs && stats.maxFrameMs >= stats.lastFrameMs);
+
+	int frames = 1;
+	while (numExecuted < total && frames < total)
+	{
+		dispatcher->Tick(0.0f);
+		frames++;
+	}
+
+	stats = dispatcher->GetStats();
+	TestEqual(TEXT("Every completion is executed"), numExecuted, total);
+	TestTrue(TEXT("The burst takes several frames"), frames > 1);
+	TestEqual(TEXT("The queue is empty"), stats.queueDepth, 0);
+	TestEqual(TEXT("Every completion is counted"), stats.totalDispatched, before.totalDispatched + total);
+
+	dispatcher->SetFrameBudget(previousBudget);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrCallDispatcherZeroBudgetTest, "AnkrSDK.CallDispatcher.ZeroBudget", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A budget of zero still dispatches one completion per frame, so the queue keeps moving.
+bool FAnkrCallDispatcherZeroBudgetTest::RunTest(const FString& Parameters)
+{
+	FAnkrCallDispatcher* dispatcher = FAnkrCallDispatcher::Get();
+	if (!TestNotNull(TEXT("The module creates the dispatcher"), dispatcher))
+	{
+		return false;
+	}
+
+	const float previousBudget = dispatcher->GetFrameBudget();
+	dispatcher->SetFrameBudget(-1.0f);
+	TestEqual(TEXT("A negative budget is clamped to zero"), dispatcher->GetFrameBudget(), 0.0f);
+
+	while (!LibraryManager::GetInstance().CallQueue.IsEmpty())
+	{
+		dispatcher->Tick(0.0f);
+	}
+
+	int numExecuted = 0;
+	QueueCompletions(3, numExecuted);
+
+	for (int frame = 1; frame <= 3; frame++)
+	{
+		dispatcher->Tick(0.0f);
+		TestEqual(FString::Printf(TEXT("Frame %d dispatches one completion"), frame), dispatcher->GetStats().dispatchedLastFrame, 1);
+		TestEqual(FString::Printf(TEXT("Frame %d leaves the rest queued"), frame), numExecuted, frame);
+	}
+
+	dispatcher->Tick(0.0f);
+	TestEqual(TEXT("An empty queue dispatches nothing"), dispatcher->GetStats().dispatchedLastFrame, 0);
+
+	dispatcher->SetFrameBudget(previousBudget);
+	return true;
+}
+
+#endif
@@ -0,0 +1,294 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrCallQueue.h"
+#include "AnkrCallDispatcher.h"
+#include <thread>
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int NumProducers		   = 8;
+	const int CompletionsPerThread = 5000;
+
+	// RunProducers starts the producers at once and waits for them, every producer is handed its index.
+	template<typename TFunctor>
+	void RunProducers(int _count, TFunctor _functor)
+	{
+		std::vector<std::thread> threads;
+		threads.reserve(_count);
+		for (int i = 0; i < _count; i++)
+		{
+			threads.emplace_back([&_functor, i]() { _functor(i); });
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrCompletionQueueStressTest, "AnkrSDK.CallQueue.CompletionQueue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Thousands of completions are pushed from several threads while the test thread pops them, the small ring makes the pushes spill into the overflow list.
+bool FAnkrCompletionQueueStressTest::RunTest(const FString& Parameters)
+{
+	const int total = NumProducers * CompletionsPerThread;
+
+	AnkrCompletionQueue<int> queue(256);
+	std::vector<uint8> received(total, 0);
+	int numReceived	  = 0;
+	int numDuplicates = 0;
+
+	std::thread consumer([&]()
+		{
+			int value;
+			while (numReceived < total)
+			{
+				if (!queue.Pop(value))
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				numDuplicates += received[value];
+				received[value] = 1;
+				numReceived++;
+			}
+		});
+
+	RunProducers(NumProducers, [&queue](int _producer)
+		{
+			for (int i = 0; i < CompletionsPerThread; i++)
+			{
+				queue.Push(_producer * CompletionsPerThread + i);
+			}
+		});
+	consumer.join();
+
+	TestEqual(TEXT("Every completion is received"), numReceived, total);
+	TestEqual(TEXT("No completion is received twice"), numDuplicates, 0);
+	TestTrue(TEXT("The queue is empty"), queue.IsEmpty());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrPendingCallTableStressTest, "AnkrSDK.CallQueue.PendingCallTable", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Calls are added from several threads, then taken by index and by sender at the same time, every call must be handed out exactly once.
+bool FAnkrPendingCallTableStressTest::RunTest(const FString& Parameters)
+{
+	const int total = NumProducers * CompletionsPerThread;
+
+	AnkrPendingCallTable<int, int> table;
+	std::atomic<int> numRejected{ 0 };
+
+	RunProducers(NumProducers, [&](int _producer)
+		{
+			const std::string group = _producer % 2 == 0 ? "CallMethod" : "SendTransaction";
+			for (int i = 0; i < CompletionsPerThread; i++)
+			{
+				const int key = _producer * CompletionsPerThread + i;
+				if (!table.Add(key, group, key))
+				{
+					numRejected++;
+				}
+			}
+		});
+
+	TestEqual(TEXT("No call is rejected"), numRejected.load(), 0);
+	TestEqual(TEXT("Every call is pending"), table.Num(), total);
+
+	std::vector<std::atomic<int>> taken(total);
+	for (std::atomic<int>& count : taken)
+	{
+		count.store(0);
+	}
+
+	RunProducers(NumProducers, [&](int _producer)
+		{
+			int call;
+			for (int i = 0; i < CompletionsPerThread; i++)
+			{
+				const bool isTaken = _producer < NumProducers / 2
+					? table.Take(_producer * CompletionsPerThread + i, call)
+					: table.TakeOldest(_producer % 2 == 0 ? "CallMethod" : "SendTransaction", call);
+
+				if (isTaken)
+				{
+					taken[call]++;
+				}
+			}
+		});
+
+	int call;
+	while (table.TakeOldest("CallMethod", call) || table.TakeOldest("SendTransaction", call))
+	{
+		taken[call]++;
+	}
+
+	int numMissing	  = 0;
+	int numDuplicates = 0;
+	for (std::atomic<int>& count : taken)
+	{
+		numMissing	  += count.load() == 0 ? 1 : 0;
+		numDuplicates += count.load() > 1 ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Every call is taken"), numMissing, 0);
+	TestEqual(TEXT("No call is taken twice"), numDuplicates, 0);
+	TestEqual(TEXT("The table is empty"), table.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrSenderCallQueueTest, "AnkrSDK.CallQueue.SenderCallQueue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The calls of a sender are sent one after the other, so every callback that reports only the sender completes the call that was sent.
+bool FAnkrSenderCallQueueTest::RunTest(const FString& Parameters)
+{
+	AnkrSenderCallQueue queue;
+	TArray<int> sent;
+
+	TestTrue(TEXT("The first call is sent right away"), queue.Send("CallMethod", 1, [&sent]() { sent.Add(1); }));
+	TestFalse(TEXT("The second call waits"), queue.Send("CallMethod", 2, [&sent]() { sent.Add(2); }));
+	TestFalse(TEXT("The third call waits"), queue.Send("CallMethod", 3, [&sent]() { sent.Add(3); }));
+	TestTrue(TEXT("Another sender is not held back"), queue.Send("GetResult", 4, [&sent]() { sent.Add(4); }));
+
+	TArray<int> completed;
+	int callIndex;
+	std::function<void()> next;
+	while (queue.Complete("CallMethod", callIndex, next))
+	{
+		completed.Add(callIndex);
+		if (next)
+		{
+			next();
+			next = nullptr;
+		}
+	}
+
+	TestEqual(TEXT("The calls complete in the order they were sent"), completed, TArray<int>({ 1, 2, 3 }));
+	TestEqual(TEXT("The waiting calls are sent once the previous call completed"), sent, TArray<int>({ 2, 3 }));
+	TestTrue(TEXT("The other sender still has its call in flight"), queue.Complete("GetResult", callIndex, next) && callIndex == 4);
+	TestFalse(TEXT("A callback without a call in flight is ignored"), queue.Complete("GetResult", callIndex, next));
+	return true;
+}
+
+#if ANKR_WITH_NATIVE_LIBRARY
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrNativeCompletionStressTest, "AnkrSDK.CallQueue.NativeCompletions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The calls are completed through LibraryManager::FlushCall from several threads like native callbacks, then dispatched on this thread like FAnkrCallDispatcher does.
+bool FAnkrNativeCompletionStressTest::RunTest(const FString& Parameters)
+{
+	LibraryManager& library = LibraryManager::GetInstance();
+	const int total = NumProducers * CompletionsPerThread;
+
+	TMap<int, int> expected;
+	TArray<int> callIndices;
+	int numExecuted	 = 0;
+	int numMismatched = 0;
+	for (int i = 0; i < total; i++)
+	{
+		const int callIndex = library.AddCall("CallMethod", [i, &numExecuted, &numMismatched](bool _success, const FString& _data)
+			{
+				numExecuted++;
+				numMismatched += (_success && _data == FString::FromInt(i)) ? 0 : 1;
+			}, EAnkrCallbackThread::GameThread);
+
+		if (!TestTrue(TEXT("The call is added"), callIndex >= 0))
+		{
+			return false;
+		}
+
+		expected.Add(callIndex, i);
+		callIndices.Add(callIndex);
+	}
+
+	RunProducers(NumProducers, [&](int _producer)
+		{
+			for (int i = 0; i < CompletionsPerThread; i++)
+			{
+				const int callIndex = callIndices[_producer * CompletionsPerThread + i];
+				const std::string data = std::to_string(expected.FindChecked(callIndex));
+				library.FlushCall(callIndex, true, data.c_str());
+			}
+		});
+
+	FAnkrCallStruct call{};
+	while (library.CallQueue.Pop(call))
+	{
+		call.Execute();
+	}
+
+	TestEqual(TEXT("Every completion is executed"), numExecuted, total);
+	TestEqual(TEXT("Every completion carries its own data"), numMismatched, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrNativeNullDataTest, "AnkrSDK.CallQueue.NativeNullData", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A native callback without data completes its call with empty data.
+bool FAnkrNativeNullDataTest::RunTest(const FString& Parameters)
+{
+	LibraryManager& library = LibraryManager::GetInstance();
+
+	bool isExecuted = false;
+	FString data	= TEXT("unset");
+	const int callIndex = library.AddCall("GetResult", [&isExecuted, &data](bool _success, const FString& _data)
+		{
+			isExecuted = true;
+			data	   = _data;
+		}, EAnkrCallbackThread::CompletionThread);
+
+	library.FlushCall(callIndex, false, nullptr);
+
+	TestTrue(TEXT("The call is completed"), isExecuted);
+	TestTrue(TEXT("The data is empty"), data.IsEmpty());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrUnavailableLibraryTest, "AnkrSDK.CallQueue.UnavailableLibrary", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Without a native library every call of a batch fails right away instead of staying pending forever.
+bool FAnkrUnavailableLibraryTest::RunTest(const FString& Parameters)
+{
+	LibraryManager& library = LibraryManager::GetInstance();
+	if (library.EnsureLoaded() && library.IsClientAvailable())
+	{
+		AddInfo(TEXT("The native library is available, there is nothing to fail."));
+		return true;
+	}
+
+	int numFailed = 0;
+	std::vector<AnkrNativeRequest> requests;
+	for (int i = 0; i < 4; i++)
+	{
+		AnkrNativeRequest request;
+		request.callIndex = library.AddCall("CallMethod", [&numFailed](bool _success, const FString& _data)
+			{
+				numFailed += _success ? 0 : 1;
+			}, EAnkrCallbackThread::CompletionThread);
+		request.method	= "CallMethod";
+		request.content = "{}";
+		requests.push_back(request);
+	}
+
+	const int numPending = library.CallList.Num();
+#if ANKR_WITH_NATIVE_BATCH
+	library.SubmitBatch(requests);
+#else
+	library.SubmitEach(requests);
+#endif
+
+	TestEqual(TEXT("Every call of the batch fails"), numFailed, 4);
+	TestEqual(TEXT("No call is left pending"), library.CallList.Num(), numPending - 4);
+	return true;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/Event.h"
+#include "AnkrCallbackThread.h"
+#include "AnkrCallDispatcher.h"
+
+#if ANKR_WITH_NATIVE_LIBRARY
+#include "LibraryManager.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrCallbackThreadNativeTest, "AnkrSDK.CallbackThread.NativeDelegate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A native delegate is executed inline for CompletionThread, on the thread that completed the call.
+bool FAnkrCallbackThreadNativeTest::RunTest(const FString& Parameters)
+{
+	const uint32 callerThreadId = FPlatformTLS::GetCurrentThreadId();
+	uint32 executedThreadId		= 0;
+	FString data;
+
+	FAnkrCallCompleteDelegate native = FAnkrCallCompleteDelegate::CreateLambda([&executedThreadId, &data](FString _response, FString _data, FString _optionalData, int _optionalCode, bool _optionalBool)
+		{
+			executedThreadId = FPlatformTLS::GetCurrentThreadId();
+			data			 = _data;
+		});
+
+	AnkrCallbackThread::Execute(EAnkrCallbackThread::CompletionThread, native, TEXT("{}"), TEXT("data"), TEXT(""), -1, false);
+
+	TestEqual(TEXT("The delegate is executed inline"), executedThreadId, callerThreadId);
+	TestEqual(TEXT("The delegate receives the data"), data, FString(TEXT("data")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrCallbackThreadTaskThreadTest, "AnkrSDK.CallbackThread.TaskThread", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The functions run for TaskThread are executed off the game thread, on one thread and in the order they were run.
+bool FAnkrCallbackThreadTaskThreadTest::RunTest(const FString& Parameters)
+{
+	const int total = 1000;
+
+	FEvent* doneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+	TArray<int> order;
+	TSet<uint32> threadIds;
+	bool isOnGameThread = false;
+
+	for (int i = 0; i < total; i++)
+	{
+		AnkrCallbackThread::Run(EAnkrCallbackThread::TaskThread, [i, total, doneEvent, &order, &threadIds, &isOnGameThread]()
+			{
+				order.Add(i);
+				threadIds.Add(FPlatformTLS::GetCurrentThreadId());
+				isOnGameThread |= IsInGameThread();
+				if (i == total - 1)
+				{
+					doneEvent->Trigger();
+				}
+			});
+	}
+
+	const bool isDone = doneEvent->Wait(FTimespan::FromSeconds(10));
+	FPlatformProcess::ReturnSynchEventToPool(doneEvent);
+
+	if (!TestTrue(TEXT("Every function is executed"), isDone))
+	{
+		return false;
+	}
+
+	bool isInOrder = order.Num() == total;
+	for (int i = 0; isInOrder && i < total; i++)
+	{
+		isInOrder = order[i] == i;
+	}
+
+	TestTrue(TEXT("The functions are executed in the order they were run"), isInOrder);
+	TestEqual(TEXT("The functions are executed on one thread"), threadIds.Num(), 1);
+	TestFalse(TEXT("The functions are not executed on the game thread"), isOnGameThread);
+	return true;
+}
+
+#if ANKR_WITH_NATIVE_LIBRARY
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrCallbackThreadDynamicCallTest, "AnkrSDK.CallbackThread.DynamicNativeCall", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A native call with a dynamic delegate is completed through the game thread queue even when another thread is chosen for it.
+bool FAnkrCallbackThreadDynamicCallTest::RunTest(const FString& Parameters)
+{
+	LibraryManager& library = LibraryManager::GetInstance();
+
+	const int callIndex = library.AddCall("CallMethod", FAnkrCallCompleteDynamicDelegate(), EAnkrCallbackThread::CompletionThread);
+	library.FlushCall(callIndex, true, "{}");
+
+	bool isQueued = false;
+	FAnkrCallStruct call{};
+	while (library.CallQueue.Pop(call))
+	{
+		isQueued |= call.callIndex == callIndex;
+	}
+
+	TestTrue(TEXT("The completion waits for the game thread"), isQueued);
+	return true;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,113 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrMulticall.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The names and addresses are unique so the contracts registered by a test never collide with the ones of the project.
+	FString MakeName()
+	{
+		return "RegistryTest" + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	}
+
+	FString MakeAddress()
+	{
+		return "0x" + FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower() + "00000000";
+	}
+
+	FString MakeAbi(const FString& _method)
+	{
+		return "[{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"" + _method + "\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"}]";
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrContractRegistryLookupTest, "AnkrSDK.ContractRegistry.Lookups", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A registered contract is found by its name and by its address in any case, an unknown contract is null or empty.
+bool FAnkrContractRegistryLookupTest::RunTest(const FString& Parameters)
+{
+	const FString name	  = MakeName();
+	const FString address = MakeAddress();
+	const FString abi	  = MakeAbi(TEXT("burn"));
+
+	TestFalse(TEXT("An unknown contract is not found"), AnkrContractRegistry::Find(name).IsValid());
+	TestTrue(TEXT("Get returns an empty contract for an unknown name"), AnkrContractRegistry::Get(name).GetAddress().IsEmpty() && AnkrContractRegistry::Get(name).GetABI().IsEmpty());
+	TestFalse(TEXT("An unknown address is not found"), AnkrContractRegistry::FindByAddress(address).IsValid());
+
+	AnkrContractRegistry::Register(name, address, abi);
+
+	FAnkrContractPtr contract = AnkrContractRegistry::Find(name);
+	if (TestTrue(TEXT("The contract is found by its name"), contract.IsValid()))
+	{
+		TestEqual(TEXT("The name is kept"), contract->GetName(), name);
+		TestEqual(TEXT("The address is kept"), contract->GetAddress(), address);
+		TestEqual(TEXT("The abi is kept"), contract->GetABI(), abi);
+	}
+
+	TestEqual(TEXT("Get returns the registered contract"), AnkrContractRegistry::Get(name).GetAddress(), address);
+	TestEqual(TEXT("The blueprint library reads the registry"), UAnkrContractLibrary::GetContractAddress(name), address);
+	TestTrue(TEXT("The address is found"), AnkrContractRegistry::FindByAddress(address) == contract);
+	TestTrue(TEXT("The case of the address is ignored"), AnkrContractRegistry::FindByAddress("0x" + address.Mid(2).ToUpper()) == contract);
+
+	TestTrue(TEXT("Multicall3 is always registered"), AnkrContractRegistry::Find(CONTRACT_MULTICALL).IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrContractRegistryReplaceTest, "AnkrSDK.ContractRegistry.Replace", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A contract registered again replaces the old one for the next lookups, a descriptor read before keeps its address and its methods.
+bool FAnkrContractRegistryReplaceTest::RunTest(const FString& Parameters)
+{
+	const FString name		 = MakeName();
+	const FString oldAddress = MakeAddress();
+	const FString newAddress = MakeAddress();
+
+	AnkrContractRegistry::Register(name, oldAddress, MakeAbi(TEXT("burn")));
+	FAnkrContractPtr old = AnkrContractRegistry::Find(name);
+
+	AnkrContractRegistry::Register(name, newAddress, MakeAbi(TEXT("mint")));
+	FAnkrContractPtr current = AnkrContractRegistry::Find(name);
+
+	if (TestTrue(TEXT("Both descriptors are valid"), old.IsValid() && current.IsValid()))
+	{
+		TestEqual(TEXT("The new contract is found"), current->GetAddress(), newAddress);
+		TestNotNull(TEXT("The new contract has the new method"), current->FindMethods(TEXT("mint")));
+
+		TestEqual(TEXT("The old descriptor keeps its address"), old->GetAddress(), oldAddress);
+		TestNotNull(TEXT("The old descriptor keeps its method"), old->FindMethods(TEXT("burn")));
+		TestNull(TEXT("The old descriptor does not see the new method"), old->FindMethods(TEXT("mint")));
+	}
+
+	TestFalse(TEXT("The old address is no longer registered"), AnkrContractRegistry::FindByAddress(oldAddress).IsValid());
+	TestTrue(TEXT("The new address is registered"), AnkrContractRegistry::FindByAddress(newAddress) == current);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrContractRegistryItemTest, "AnkrSDK.ContractRegistry.Items", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The token id of an item is returned as it was registered and as a 256 bit integer, an unknown item has no token id.
+bool FAnkrContractRegistryItemTest::RunTest(const FString& Parameters)
+{
+	const FString name = MakeName();
+
+	TestTrue(TEXT("An unknown item has no token id"), AnkrContractRegistry::GetItem(name).IsEmpty());
+	TestTrue(TEXT("The value of an unknown item is 0"), UAnkrContractLibrary::GetItemTokenIdValue(name) == FAnkrUInt256());
+
+	AnkrContractRegistry::RegisterItem(name, TEXT("0x0100000000000000000000000000000000000000000000000000000000000001"));
+	TestEqual(TEXT("The token id is returned as registered"), AnkrContractRegistry::GetItem(name), FString(TEXT("0x0100000000000000000000000000000000000000000000000000000000000001")));
+	TestEqual(TEXT("The blueprint library returns the token id"), UAnkrContractLibrary::GetItemTokenId(name), AnkrContractRegistry::GetItem(name));
+
+	FAnkrUInt256 expected;
+	FAnkrUInt256::Parse(TEXT("0x0100000000000000000000000000000000000000000000000000000000000001"), expected);
+	TestTrue(TEXT("The value keeps the 256 bits of the token id"), UAnkrContractLibrary::GetItemTokenIdValue(name) == expected);
+	TestFalse(TEXT("The value does not fit in 64 bits"), UAnkrContractLibrary::GetItemTokenIdValue(name) == FAnkrUInt256(1));
+
+	AnkrContractRegistry::RegisterItem(name, TEXT("42"));
+	TestTrue(TEXT("An item registered again is replaced"), UAnkrContractLibrary::GetItemTokenIdValue(name) == FAnkrUInt256(42));
+	return true;
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
+#include "WearableNFTExample.h"
+#include "AnkrJournal.h"
+#include "AnkrRequestContext.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	FString MakeAddress()
+	{
+		return "0x" + FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower() + "00000000";
+	}
+
+	// The character ids are above 2^128, so the equipment is keyed by the whole id and not by a part that fits in an int.
+	FAnkrUInt256 MakeCharacterId()
+	{
+		FAnkrUInt256 characterId;
+		FAnkrUInt256::Parse("0x1" + FGuid::NewGuid().ToString(EGuidFormats::Digits), characterId);
+		return characterId;
+	}
+
+	// FindTicket gets the ticket the journal received for the pending request whose body holds the item.
+	bool FindTicket(const FString& _item, FString& _ticket)
+	{
+		for (const FAnkrJournalEntry& entry : AnkrJournal::GetPendingEntries())
+		{
+			if (entry.body.Contains(_item) && !entry.ticket.IsEmpty())
+			{
+				_ticket = entry.ticket;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool ResolveTicket(const FString& _ticket, const FString& _json)
+	{
+		TSharedPtr<FJsonObject> object;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(_json);
+		FJsonSerializer::Deserialize(Reader, object);
+
+		FString status;
+		return AnkrJournal::ResolveTicket(_ticket, object, status);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrEquipmentRollbackTest, "AnkrSDK.Equipment.RollbackOnFailedTicket", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A hat predicted by ChangeHat is shown until its ticket fails, the equipment then falls back to the confirmed hat and nothing stays pending.
+bool FAnkrEquipmentRollbackTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = false;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	UWearableNFTExample* example = NewObject<UWearableNFTExample>();
+	example->AddToRoot();
+	example->Init("AnkrEquipmentTest", "");
+	example->OptimisticEquip = true;
+
+	const FAnkrUInt256 characterId	= MakeCharacterId();
+	const FString confirmedHat		= MakeAddress();
+	const FString predictedHat		= MakeAddress();
+
+	example->ResolveEquipment(AnkrRequestContext::Make(EAnkrOperation::ChangeHat, characterId, { confirmedHat }), true);
+	TestEqual(TEXT("The hat is confirmed"), example->GetEquipment(characterId).hat, confirmedHat);
+
+	example->ChangeHat("equipment", characterId, true, predictedHat, FAnkrCallCompleteDynamicDelegate());
+	TestEqual(TEXT("The new hat is predicted right away"), example->GetEquipment(characterId).hat, predictedHat);
+	TestTrue(TEXT("The change is pending"), example->IsEquipmentPending(characterId));
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, example, characterId, confirmedHat, predictedHat, deadline, wasMockBackend]()
+		{
+			FString ticket;
+			if (!FindTicket(predictedHat, ticket) && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			if (TestFalse(TEXT("The change receives a ticket"), ticket.IsEmpty()))
+			{
+				TestFalse(TEXT("A pending ticket keeps the prediction"), ResolveTicket(ticket, TEXT("{\"result\":true,\"data\":{\"status\":\"pending\"}}")));
+				TestEqual(TEXT("The predicted hat is kept while the ticket is pending"), example->GetEquipment(characterId).hat, predictedHat);
+
+				TestTrue(TEXT("A reverted ticket is final"), ResolveTicket(ticket, TEXT("{\"result\":true,\"data\":{\"status\":\"reverted\"}}")));
+				AnkrRequestContext::Release(ticket);
+
+				TestEqual(TEXT("The hat is rolled back to the confirmed one"), example->GetEquipment(characterId).hat, confirmedHat);
+				TestFalse(TEXT("Nothing is pending after the rollback"), example->IsEquipmentPending(characterId));
+			}
+
+			example->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrEquipmentNewerPredictionTest, "AnkrSDK.Equipment.NewerPrediction", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// An older change of a slot that fails after a newer change of the same slot was predicted leaves the newer prediction in place.
+bool FAnkrEquipmentNewerPredictionTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = false;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	UWearableNFTExample* example = NewObject<UWearableNFTExample>();
+	example->AddToRoot();
+	example->Init("AnkrEquipmentTest", "");
+	example->OptimisticEquip = true;
+
+	const FAnkrUInt256 characterId	= MakeCharacterId();
+	const FString confirmedHat		= MakeAddress();
+	const FString olderHat			= MakeAddress();
+	const FString newerHat			= MakeAddress();
+
+	example->ResolveEquipment(AnkrRequestContext::Make(EAnkrOperation::ChangeHat, characterId, { confirmedHat }), true);
+	example->ChangeHat("equipment", characterId, true, olderHat, FAnkrCallCompleteDynamicDelegate());
+	example->ChangeHat("equipment", characterId, true, newerHat, FAnkrCallCompleteDynamicDelegate());
+	TestEqual(TEXT("The newest hat is predicted"), example->GetEquipment(characterId).hat, newerHat);
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, example, characterId, confirmedHat, olderHat, newerHat, deadline, wasMockBackend]()
+		{
+			FString olderTicket, newerTicket;
+			const bool hasTickets = FindTicket(olderHat, olderTicket) && FindTicket(newerHat, newerTicket);
+			if (!hasTickets && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			if (TestTrue(TEXT("Both changes receive a ticket"), hasTickets))
+			{
+				TestTrue(TEXT("The older ticket fails"), ResolveTicket(olderTicket, TEXT("{\"result\":false,\"msg\":\"rejected\"}")));
+				AnkrRequestContext::Release(olderTicket);
+				TestEqual(TEXT("The newer prediction survives the older failure"), example->GetEquipment(characterId).hat, newerHat);
+				TestTrue(TEXT("The newer change is still pending"), example->IsEquipmentPending(characterId));
+
+				TestTrue(TEXT("The newer ticket fails"), ResolveTicket(newerTicket, TEXT("{\"result\":true,\"data\":{\"status\":\"failed\"}}")));
+				AnkrRequestContext::Release(newerTicket);
+				TestEqual(TEXT("The hat is rolled back to the confirmed one"), example->GetEquipment(characterId).hat, confirmedHat);
+				TestFalse(TEXT("Nothing is pending after the rollback"), example->IsEquipmentPending(characterId));
+			}
+
+			example->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+#endif
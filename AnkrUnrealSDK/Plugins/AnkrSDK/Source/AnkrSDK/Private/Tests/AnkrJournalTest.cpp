@@ -0,0 +1,209 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonSerializer.h"
+#include "AnkrJournal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The journal of the project is moved aside while a test runs and put back afterwards.
+	struct FJournalBackup
+	{
+		bool exists = false;
+		FString content;
+
+		FJournalBackup()
+		{
+			exists = FFileHelper::LoadFileToString(content, *AnkrJournal::GetJournalPath());
+			IFileManager::Get().Delete(*AnkrJournal::GetJournalPath(), false, false, true);
+			AnkrJournal::Reload();
+		}
+
+		void Restore() const
+		{
+			IFileManager::Get().Delete(*AnkrJournal::GetJournalPath(), false, false, true);
+			if (exists)
+			{
+				FFileHelper::SaveStringToFile(content, *AnkrJournal::GetJournalPath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+			}
+			AnkrJournal::Reload();
+		}
+	};
+
+	struct FJournalResponseState
+	{
+		int32 responses = 0;
+		FString ticket;
+	};
+
+	FAnkrJournalEntry MakeEntry(const FString& _event, const FString& _requestId, const FString& _body, int64 _timestamp)
+	{
+		FAnkrJournalEntry entry{};
+		entry.event		= _event;
+		entry.requestId = _requestId;
+		entry.sender	= TEXT("AnkrJournalTest");
+		entry.body		= _body;
+		entry.timestamp = _timestamp;
+		if (!_body.IsEmpty())
+		{
+			entry.requestKey = FMD5::HashAnsiString(*_body);
+		}
+		return entry;
+	}
+
+	bool IsPending(const FString& _requestId, FString* _ticket = nullptr)
+	{
+		for (const FAnkrJournalEntry& entry : AnkrJournal::GetPendingEntries())
+		{
+			if (entry.requestId.Equals(_requestId))
+			{
+				if (_ticket != nullptr) *_ticket = entry.ticket;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IsResolved(const FString& _json, FString& _status)
+	{
+		TSharedPtr<FJsonObject> object;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(_json);
+		FJsonSerializer::Deserialize(Reader, object);
+		_status.Empty();
+		return AnkrJournal::IsResolved(object, _status);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrJournalDedupTest, "AnkrSDK.Journal.Dedup", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// An identical request is only held back while the first one waits for its ticket, it is answered with that ticket. Once the ticket is known the same request is sent again.
+bool FAnkrJournalDedupTest::RunTest(const FString& Parameters)
+{
+	const FJournalBackup backup;
+
+	const FString id   = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	const FString body = "{\"method\":\"mintItems\",\"args\":[\"" + id + "\"]}";
+
+	TSharedRef<FJournalResponseState, ESPMode::ThreadSafe> state = MakeShared<FJournalResponseState, ESPMode::ThreadSafe>();
+	FAnkrJournalResponse response = [state](FString content, FString ticket)
+	{
+		state->responses++;
+		state->ticket = ticket;
+	};
+
+	TestTrue(TEXT("The first request is sent"), AnkrJournal::RecordSubmit(id + "-1", TEXT("MintItems"), body, FAnkrRequestContext(), response));
+	TestFalse(TEXT("An identical request in flight is held back"), AnkrJournal::RecordSubmit(id + "-2", TEXT("MintItems"), body, FAnkrRequestContext(), response));
+
+	AnkrJournal::RecordResponse(id + "-1", id + "-ticket");
+	TestTrue(TEXT("The same request is sent again once the first one has a ticket"), AnkrJournal::RecordSubmit(id + "-3", TEXT("MintItems"), body, FAnkrRequestContext(), response));
+	TestTrue(TEXT("The ticket of the first request stays pending"), IsPending(id + "-1"));
+
+	AnkrJournal::RecordResponse(id + "-3", "");
+	TestFalse(TEXT("A rejected request is discarded"), IsPending(id + "-3"));
+
+	// The requests that were held back are answered on the game thread.
+	const double deadline = FPlatformTime::Seconds() + 5.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, id, deadline, backup]()
+		{
+			if (state->responses == 0 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestEqual(TEXT("The request held back is answered once"), state->responses, 1);
+			TestEqual(TEXT("The request held back receives the ticket of the first one"), state->ticket, id + "-ticket");
+
+			AnkrJournal::RecordResolved(id + "-ticket", TICKET_STATUS_SUCCESS);
+			AnkrRequestContext::Release(id + "-ticket");
+			backup.Restore();
+			return true;
+		}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrJournalReplayTest, "AnkrSDK.Journal.Replay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A journal left by a previous session is replayed into the pending requests, expired and finished requests are dropped and the file is compacted to one line per pending request.
+bool FAnkrJournalReplayTest::RunTest(const FString& Parameters)
+{
+	const FJournalBackup backup;
+	const int64 now = FDateTime::UtcNow().ToUnixTimestamp();
+
+	const FAnkrJournalEntry unsent	 = MakeEntry(JOURNAL_EVENT_SUBMIT, TEXT("unsent"), TEXT("{\"method\":\"changeHat\",\"args\":[1]}"), now - 60);
+	const FAnkrJournalEntry ticketed = MakeEntry(JOURNAL_EVENT_SUBMIT, TEXT("ticketed"), TEXT("{\"method\":\"mintItems\",\"args\":[2]}"), now - 60);
+	const FAnkrJournalEntry resolved = MakeEntry(JOURNAL_EVENT_SUBMIT, TEXT("resolved"), TEXT("{\"method\":\"mintItems\",\"args\":[3]}"), now - 60);
+	const FAnkrJournalEntry expired	 = MakeEntry(JOURNAL_EVENT_SUBMIT, TEXT("expired"), TEXT("{\"method\":\"mintItems\",\"args\":[4]}"), now - JOURNAL_ENTRY_TTL_SECONDS - 60);
+
+	FAnkrJournalEntry ticket = MakeEntry(JOURNAL_EVENT_TICKET, TEXT("ticketed"), TEXT(""), now - 50);
+	ticket.ticket = TEXT("ticket-2");
+	FAnkrJournalEntry resolvedTicket = MakeEntry(JOURNAL_EVENT_TICKET, TEXT("resolved"), TEXT(""), now - 50);
+	resolvedTicket.ticket = TEXT("ticket-3");
+	FAnkrJournalEntry resolution = MakeEntry(JOURNAL_EVENT_RESOLVED, TEXT("resolved"), TEXT(""), now - 40);
+	resolution.ticket = TEXT("ticket-3");
+	resolution.status = TICKET_STATUS_FAILED;
+
+	FString journal;
+	for (const FAnkrJournalEntry& entry : { unsent, ticketed, resolved, expired, ticket, resolvedTicket, resolution })
+	{
+		journal += FAnkrJournalEntry::ToJson(entry) + TEXT("\n");
+	}
+	FFileHelper::SaveStringToFile(journal, *AnkrJournal::GetJournalPath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+	AnkrJournal::Reload();
+
+	FString replayedTicket;
+	TestTrue(TEXT("A request without a ticket is recovered"), IsPending(TEXT("unsent")));
+	TestTrue(TEXT("A request with a ticket is recovered"), IsPending(TEXT("ticketed"), &replayedTicket));
+	TestEqual(TEXT("The ticket is recovered with its request"), replayedTicket, FString(TEXT("ticket-2")));
+	TestFalse(TEXT("A resolved request is dropped"), IsPending(TEXT("resolved")));
+	TestFalse(TEXT("A request older than the TTL is dropped"), IsPending(TEXT("expired")));
+
+	TArray<FString> lines;
+	FFileHelper::LoadFileToStringArray(lines, *AnkrJournal::GetJournalPath());
+	lines.RemoveAll([](const FString& line) { return line.IsEmpty(); });
+	TestEqual(TEXT("The journal is compacted to one line per pending request"), lines.Num(), 2);
+
+	// The compacted journal is replayed to the same requests.
+	AnkrJournal::Reload();
+	TestTrue(TEXT("The compacted journal keeps the ticket"), IsPending(TEXT("ticketed"), &replayedTicket) && replayedTicket.Equals(TEXT("ticket-2")));
+
+	TestTrue(TEXT("A request identical to an unsent one of the previous session is sent"), AnkrJournal::RecordSubmit(TEXT("resent"), TEXT("ChangeHat"), unsent.body, FAnkrRequestContext(), [](FString, FString) {}));
+	TestFalse(TEXT("The unsent request is replaced"), IsPending(TEXT("unsent")));
+	TestTrue(TEXT("A request identical to one with a ticket is sent"), AnkrJournal::RecordSubmit(TEXT("repeated"), TEXT("MintItems"), ticketed.body, FAnkrRequestContext(), [](FString, FString) {}));
+
+	AnkrJournal::Discard(TEXT("resent"));
+	AnkrJournal::Discard(TEXT("repeated"));
+	TestTrue(TEXT("The ticket of the previous session is resolved"), AnkrJournal::RecordResolved(TEXT("ticket-2"), TICKET_STATUS_SUCCESS));
+	AnkrRequestContext::Release(TEXT("ticket-2"));
+
+	TestEqual(TEXT("Nothing is pending"), AnkrJournal::GetPendingEntries().Num(), 0);
+	TestFalse(TEXT("The journal is deleted when nothing is pending"), IFileManager::Get().FileExists(*AnkrJournal::GetJournalPath()));
+
+	backup.Restore();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrJournalIsResolvedTest, "AnkrSDK.Journal.IsResolved", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Every ticket status except an empty or pending one is final, only "success" succeeds.
+bool FAnkrJournalIsResolvedTest::RunTest(const FString& Parameters)
+{
+	FString status;
+
+	TestFalse(TEXT("A response without a result is not final"), IsResolved(TEXT("{\"data\":{\"status\":\"success\"}}"), status));
+	TestFalse(TEXT("A result without a status is pending"), IsResolved(TEXT("{\"result\":true,\"data\":{}}"), status));
+	TestFalse(TEXT("A pending status is pending"), IsResolved(TEXT("{\"result\":true,\"data\":{\"status\":\"pending\"}}"), status));
+
+	TestTrue(TEXT("success is final"), IsResolved(TEXT("{\"result\":true,\"data\":{\"status\":\"success\"}}"), status) && status.Equals(TICKET_STATUS_SUCCESS));
+	TestTrue(TEXT("A result of false is a failure"), IsResolved(TEXT("{\"result\":false,\"msg\":\"rejected\"}"), status) && status.Equals(TICKET_STATUS_FAILED));
+	TestTrue(TEXT("A transaction that failed on chain is a failure"), IsResolved(TEXT("{\"result\":true,\"data\":{\"status\":\"failed\"}}"), status) && status.Equals(TICKET_STATUS_FAILED));
+	TestTrue(TEXT("A reverted transaction is a failure"), IsResolved(TEXT("{\"result\":true,\"data\":{\"status\":\"reverted\"}}"), status) && status.Equals(TICKET_STATUS_FAILED));
+	TestTrue(TEXT("The top level status is read without a data object"), IsResolved(TEXT("{\"result\":true,\"status\":\"expired\"}"), status) && status.Equals(TICKET_STATUS_FAILED));
+	return true;
+}
+
+#endif
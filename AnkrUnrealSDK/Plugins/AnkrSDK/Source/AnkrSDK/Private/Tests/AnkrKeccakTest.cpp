@@ -0,0 +1,96 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrKeccak.h"
+#include "AnkrAbi.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FKeccakVector
+	{
+		FString name;
+		TArray<uint8> input;
+		FString digest;
+	};
+
+	// Bytes 0, 1, 2 ... of the given length, 135 bytes fill the first block with the padding and 136 bytes need a second block for it.
+	TArray<uint8> MakeSequence(int32 _length)
+	{
+		TArray<uint8> bytes;
+		for (int32 i = 0; i < _length; i++)
+		{
+			bytes.Add((uint8)i);
+		}
+		return bytes;
+	}
+
+	TArray<uint8> MakeText(const char* _text)
+	{
+		return TArray<uint8>((const uint8*)_text, FCStringAnsi::Strlen(_text));
+	}
+
+	// The digests are the Keccak-256 of the reference implementation, the original padding and not the SHA3-256 one.
+	TArray<FKeccakVector> MakeVectors()
+	{
+		return {
+			{ TEXT("The empty input"), MakeText(""), TEXT("0xc5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470") },
+			{ TEXT("abc"), MakeText("abc"), TEXT("0x4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45") },
+			{ TEXT("transfer(address,uint256)"), MakeText("transfer(address,uint256)"), TEXT("0xa9059cbb2ab09eb219583f4a59a5d0623ade346d962bcd4e46b11da047c9049b") },
+			{ TEXT("135 bytes"), MakeSequence(135), TEXT("0xcbdfd9dee5faad3818d6b06f95a219fd290b0e1706f6a82e5a595b9ce9faca62") },
+			{ TEXT("136 bytes"), MakeSequence(136), TEXT("0x7ce759f1ab7f9ce437719970c26b0a66ff11fe3e38e17df89cf5d29c7d7f807e") },
+			{ TEXT("137 bytes"), MakeSequence(137), TEXT("0xac73d4fae68b8453f764007c1a20ce95994187861f0c3227a3a8e99a73a3b1db") },
+		};
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrKeccakHash256Test, "AnkrSDK.Keccak.Hash256", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Every input is hashed to its known digest, the inputs around the rate of 136 bytes check the padding at the end of a block.
+bool FAnkrKeccakHash256Test::RunTest(const FString& Parameters)
+{
+	for (const FKeccakVector& vector : MakeVectors())
+	{
+		TestEqual(vector.name, AnkrAbi::ToHex(AnkrKeccak::Hash256(vector.input)), vector.digest);
+	}
+
+	TestEqual(TEXT("A string is hashed as UTF-8"), AnkrAbi::ToHex(AnkrKeccak::Hash256(FString(TEXT("abc")))), FString(TEXT("0x4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45")));
+	TestTrue(TEXT("The selector of transfer"), AnkrKeccak::GetSelector(TEXT("transfer(address,uint256)")) == 0xa9059cbbu);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrKeccakHash256BatchTest, "AnkrSDK.Keccak.Hash256Batch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Every vector is given several times, so the inputs of the same block count fill the SIMD lanes and the rest is hashed on its own.
+bool FAnkrKeccakHash256BatchTest::RunTest(const FString& Parameters)
+{
+	const TArray<FKeccakVector> vectors = MakeVectors();
+
+	TArray<TArray<uint8>> inputs;
+	TArray<FString> digests;
+	for (int32 copy = 0; copy < 5; copy++)
+	{
+		for (const FKeccakVector& vector : vectors)
+		{
+			inputs.Add(vector.input);
+			digests.Add(vector.digest);
+		}
+	}
+
+	const TArray<TArray<uint8>> results = AnkrKeccak::Hash256Batch(inputs);
+	if (!TestEqual(TEXT("One digest per input"), results.Num(), inputs.Num()))
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < results.Num(); i++)
+	{
+		TestEqual(FString::Printf(TEXT("%s, input %d with %s"), *vectors[i % vectors.Num()].name, i, AnkrKeccak::GetImplementation()), AnkrAbi::ToHex(results[i]), digests[i]);
+	}
+
+	const TArray<uint32> selectors = AnkrKeccak::GetSelectors({ TEXT("transfer(address,uint256)"), TEXT("balanceOf(address)") });
+	TestTrue(TEXT("The selectors of transfer and balanceOf"), selectors.Num() == 2 && selectors[0] == 0xa9059cbbu && selectors[1] == 0x70a08231u);
+	return true;
+}
+
+#endif
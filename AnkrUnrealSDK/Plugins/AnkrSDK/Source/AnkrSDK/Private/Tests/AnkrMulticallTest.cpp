@@ -0,0 +1,122 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrAbi.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrMulticall.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const FString TestContract = TEXT("AnkrSDK.MulticallTest");
+	const FString TestAddress  = TEXT("0x00000000000000000000000000000000000000aa");
+
+	const FString TestAbi = TEXT("[")
+		TEXT("{\"inputs\":[{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"}],\"name\":\"balanceOf\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},")
+		TEXT("{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"name\":\"uri\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"}")
+		TEXT("]");
+
+	// aggregate3 of balanceOf(0x...01, 1) that may fail and uri(7) that may not, the calldata is written one selector and one word per line.
+	const FString Aggregate3Calldata = TEXT("0x82ad56cb")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000020")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000040")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000120")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000aa")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000060")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000044")
+		TEXT("00fdd58e00000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000100000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000100000000000000000000000000000000000000000000000000000000")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000aa")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000060")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000024")
+		TEXT("0e89341c00000000000000000000000000000000000000000000000000000000")
+		TEXT("0000000700000000000000000000000000000000000000000000000000000000");
+
+	// The (bool,bytes)[] returned for the calls above, balanceOf returns 5 and uri returns "ipfs://item/7".
+	const FString Aggregate3ReturnData = TEXT("0x")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000020")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000002")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000040")
+		TEXT("00000000000000000000000000000000000000000000000000000000000000c0")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000040")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000020")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000005")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000001")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000040")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000060")
+		TEXT("0000000000000000000000000000000000000000000000000000000000000020")
+		TEXT("000000000000000000000000000000000000000000000000000000000000000d")
+		TEXT("697066733a2f2f6974656d2f3700000000000000000000000000000000000000");
+
+	TArray<FAnkrMulticallRequest> MakeCalls()
+	{
+		FAnkrMulticallRequest balance;
+		balance.contract	 = TestContract;
+		balance.method		 = TEXT("balanceOf");
+		balance.args		 = TEXT("[\"0x0000000000000000000000000000000000000001\", 1]");
+		balance.allowFailure = true;
+
+		FAnkrMulticallRequest uri;
+		uri.contract	 = TestContract;
+		uri.method		 = TEXT("uri");
+		uri.args		 = TEXT("7");
+		uri.allowFailure = false;
+
+		return { balance, uri };
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrMulticallGoldenTest, "AnkrSDK.Multicall.Aggregate3", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The calls are packed into the aggregate3 calldata a node expects, and the data a node returns is split back into the decoded result of each call.
+bool FAnkrMulticallGoldenTest::RunTest(const FString& Parameters)
+{
+	AnkrContractRegistry::Register(TestContract, TestAddress, TestAbi);
+	const TArray<FAnkrMulticallRequest> calls = MakeCalls();
+
+	FString args, error;
+	if (!TestTrue(TEXT("The calls are packed"), AnkrMulticall::BuildArguments(calls, args, error)))
+	{
+		AddError(error);
+		return false;
+	}
+
+	TArray<uint8> calldata;
+	TestTrue(TEXT("aggregate3 is encoded"), AnkrContractRegistry::Get(CONTRACT_MULTICALL).EncodeCall(MULTICALL_METHOD, args, calldata, error));
+	TestEqual(TEXT("The aggregate3 calldata"), AnkrAbi::ToHex(calldata), Aggregate3Calldata);
+
+	// The mock backend runs the packed calls with Execute, it has to return what a node returns.
+	TArray<TSharedPtr<FJsonValue>> values;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(args);
+	TestTrue(TEXT("The packed calls are json"), FJsonSerializer::Deserialize(Reader, values));
+
+	FString data;
+	TestTrue(TEXT("aggregate3 is executed"), AnkrMulticall::Execute(values, [](const FAnkrAbiMethod& _method) -> FString
+		{
+			return _method.name == TEXT("balanceOf") ? TEXT("5") : TEXT("ipfs://item/7");
+		}, data, error));
+	TestEqual(TEXT("The aggregate3 return data"), data, Aggregate3ReturnData);
+
+	TArray<FAnkrMulticallResult> results;
+	if (!TestTrue(TEXT("The return data is split"), AnkrMulticall::ParseResults(calls, Aggregate3ReturnData, results, error)) || !TestEqual(TEXT("One result per call"), results.Num(), 2))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("balanceOf succeeded"), results[0].success);
+	TestEqual(TEXT("The data of balanceOf"), results[0].data, FString(TEXT("0x0000000000000000000000000000000000000000000000000000000000000005")));
+	TestEqual(TEXT("The outputs of balanceOf"), results[0].outputs, FString(TEXT("[\"5\"]")));
+	TestTrue(TEXT("uri succeeded"), results[1].success);
+	TestEqual(TEXT("The outputs of uri"), results[1].outputs, FString(TEXT("[\"ipfs://item/7\"]")));
+
+	TestFalse(TEXT("Return data with fewer results than calls is rejected"), AnkrMulticall::ParseResults({ calls[0] }, Aggregate3ReturnData, results, error));
+	return true;
+}
+
+#endif
@@ -0,0 +1,137 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
+#include "AnkrClient.h"
+#include "AnkrJournal.h"
+#include "AnkrRequestContext.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The state of the round trip is written by the thread that delivers the results and read by the latent commands on the game thread.
+	struct FAnkrTicketLifetimeState
+	{
+		TAtomic<bool> isSent{ false };
+		TAtomic<bool> isPolled{ false };
+		TAtomic<bool> isFoundInCallback{ false };
+		FString ticket;
+		FString context;
+	};
+
+	TSharedPtr<FJsonObject> ParseJson(const FString& _json)
+	{
+		TSharedPtr<FJsonObject> object;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(_json);
+		FJsonSerializer::Deserialize(Reader, object);
+		return object;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrRequestContextLifetimeTest, "AnkrSDK.RequestContext.TicketLifetime", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The context of a transaction is attached to its ticket once the ticket is received, survives the polls of a pending ticket and is released after the final result was handed to the caller.
+bool FAnkrRequestContextLifetimeTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = false;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	UAnkrClient* client = NewObject<UAnkrClient>();
+	client->AddToRoot();
+
+	TSharedRef<FAnkrTicketLifetimeState, ESPMode::ThreadSafe> state = MakeShared<FAnkrTicketLifetimeState, ESPMode::ThreadSafe>();
+
+	// The arguments are unique so the journal never holds the transaction back as a repeat of an earlier run.
+	const FString args = "[\\\"" + FGuid::NewGuid().ToString(EGuidFormats::Digits) + "\\\"]";
+	client->SendTransaction("0x0000000000000000000000000000000000000001", "lifetime", "mintItems", args, FAnkrCallCompleteDelegate::CreateLambda([state](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+		{
+			state->ticket = data;
+			state->isSent = true;
+		}));
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, deadline]()
+		{
+			if (!state->isSent && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			FAnkrRequestContext context;
+			if (!TestTrue(TEXT("The context is attached to the ticket"), state->isSent.Load() && AnkrRequestContext::Find(state->ticket, context)))
+			{
+				return true;
+			}
+			TestTrue(TEXT("The context is the one of the transaction"), context.operation == EAnkrOperation::SendTransaction);
+
+			FString status;
+			TestFalse(TEXT("A pending ticket is not resolved"), AnkrJournal::ResolveTicket(state->ticket, ParseJson(TEXT("{\"result\":true,\"data\":{\"status\":\"pending\"}}")), status));
+			TestTrue(TEXT("The context survives a poll of the pending ticket"), AnkrRequestContext::Find(state->ticket, context));
+
+			const FString ticket = state->ticket;
+			client->GetTicketResult(ticket, FAnkrCallCompleteDelegate::CreateLambda([state, ticket](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+				{
+					FAnkrRequestContext found;
+					state->isFoundInCallback = AnkrRequestContext::Find(ticket, found);
+					state->context			 = optionalData;
+					state->isPolled			 = true;
+				}));
+			return true;
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, deadline, wasMockBackend]()
+		{
+			if (state->isSent && !state->isPolled && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			if (state->isSent)
+			{
+				FAnkrRequestContext context;
+				TestTrue(TEXT("The final result is polled"), state->isPolled.Load());
+				TestTrue(TEXT("The context is still attached while the final result is handed over"), state->isFoundInCallback.Load());
+				TestTrue(TEXT("The context is handed over with the final result"), FAnkrRequestContext::FromJson(state->context).operation == EAnkrOperation::SendTransaction);
+				TestFalse(TEXT("The context is released after the final result"), AnkrRequestContext::Find(state->ticket, context));
+
+				for (const FAnkrJournalEntry& entry : AnkrJournal::GetPendingEntries())
+				{
+					TestFalse(TEXT("The ticket is no longer pending in the journal"), entry.ticket.Equals(state->ticket));
+				}
+			}
+
+			client->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrRequestContextJsonTest, "AnkrSDK.RequestContext.Json", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A context is written to the journal as json, its character id is written as a decimal string and read back with all of its 256 bits.
+bool FAnkrRequestContextJsonTest::RunTest(const FString& Parameters)
+{
+	FAnkrUInt256 characterId;
+	FAnkrUInt256::Parse(TEXT("0x0100000000000000000000000000000000000000000000000000000000000001"), characterId);
+
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::ChangeHat, characterId, { TEXT("0x00000000000000000000000000000000000000a1") });
+	const FString json = FAnkrRequestContext::ToJson(context);
+	TestTrue(TEXT("The character id is written in decimal"), json.Contains("\"" + characterId.ToDecimal() + "\""));
+
+	const FAnkrRequestContext read = FAnkrRequestContext::FromJson(json);
+	TestTrue(TEXT("The character id is read back"), read.characterId == characterId);
+	TestTrue(TEXT("The operation is read back"), read.operation == EAnkrOperation::ChangeHat);
+	TestTrue(TEXT("The items are read back"), read.itemIds == context.itemIds);
+
+	TestTrue(TEXT("A context without a character has the id 0"), AnkrRequestContext::Make(EAnkrOperation::SendTransaction).characterId.IsZero());
+	return true;
+}
+
+#endif
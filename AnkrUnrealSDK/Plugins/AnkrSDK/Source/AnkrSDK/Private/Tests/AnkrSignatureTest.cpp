@@ -0,0 +1,86 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrSignature.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FSignatureVector
+	{
+		FString message;
+		FString signature;
+		FString address;
+	};
+
+	const FString AddressOfKey1		= TEXT("0x7E5F4552091A69125d5DfCb7b8C2659029395Bdf");
+	const FString AddressOfKey2		= TEXT("0x2B5AD5c4795c026514f8317c7a215E218DcCD6cF");
+	const FString AddressOfWeb3Key	= TEXT("0x2c7536E3605D9C16a7a3D7b1898e529396a65c23");
+	const FString AddressOfLastKey	= TEXT("0x80C0dbf239224071c59dD8970ab9d542E3414aB2");
+
+	// personal_sign signatures made with the private keys 1, 2, 0x4c0883a6...3f362318 of the web3 documentation and n - 1.
+	// The hex messages are signed as the bytes they encode, "0xabc" has an odd number of digits and is signed as text.
+	TArray<FSignatureVector> MakeVectors()
+	{
+		return {
+			{ TEXT(""), TEXT("0xaa7859f1819f33d0b185b061900759f1afdeceb813af9686b873131ddb060fe140b565615412c8ead187cf9cb1825523be26199d24631e66536e20bf3a1e03571c"), AddressOfKey1 },
+			{ TEXT("hello"), TEXT("0xa62bbea1f1859a2fe1bc5178e228ae22cede95f6d5f7883817ac99a45591906703097d2d26c17598fb4a2890c2b6b4a1f3fdfcb23479fca2432858bf5b57bfe71c"), AddressOfKey1 },
+			{ TEXT("Hello, Ankr! \u00e9\U0001F30D"), TEXT("0xc950daeec3025820ae16e69f577416c3a8290d724cc2f01c8c150152c34fa96b081e6077c5012c69a39b491a0fd51960fdcc0b33159f62ed95511c8cd9798be81b"), AddressOfKey1 },
+			{ TEXT("0x68656c6c6f"), TEXT("0xa62bbea1f1859a2fe1bc5178e228ae22cede95f6d5f7883817ac99a45591906703097d2d26c17598fb4a2890c2b6b4a1f3fdfcb23479fca2432858bf5b57bfe71c"), AddressOfKey1 },
+			{ TEXT("0xdeadbeef"), TEXT("0x33622b447d04dc676fec457a9d88b40262a8aadeb6ec874ca67fc0fb73b6cd8954ddaf63ed2d3a5512706a2d700c9bc316f61686cc18a647d761e0aed6624b161c"), AddressOfKey1 },
+			{ TEXT("0xabc"), TEXT("0x6fc2bfbc77237e1ec7f7cb52cb1dee8368ac73312aac317fbbe7890b91ba51553eb0394da375dac1d1f608a213712c055a9a4df739d81671d17578266364038e1c"), AddressOfKey1 },
+			{ FString::ChrN(200, TEXT('x')), TEXT("0x8f0902bdadd1909fe8b063e2b91c9e2e1f71bbbaf81ec22270489513a2d1f33d63d071baf538180960830f1276df1cb24571ff4504c4fb93c980917478a9b3981c"), AddressOfKey1 },
+			{ TEXT("hello"), TEXT("0x08cc4d15e49c9a1b075032cb892f5389c382a20c2b425dffc3b041a5f91b560613782e1164bed0beb81903b21c4b535f21cd5aa7061f61ccb3ccc278d3b5d0051c"), AddressOfKey2 },
+			{ TEXT("Hello, Ankr! \u00e9\U0001F30D"), TEXT("0x0ee563cafd627be6f4b21a5a356d6b6137e211fa453aeac2efedca55220948b71177ee17dfe0deead246325568c33661251bfffc8154cc400bc4aac2b98a54101b"), AddressOfKey2 },
+			{ TEXT(""), TEXT("0x88b7aa088fac2e7a89cf66f88878ecbd6e0c389b04d1358fdf8254f1caa108f7117ff002d49a986e0ef85bb3e321d70ab154b1778e37aa7d9d1c64e455e7d5891b"), AddressOfWeb3Key },
+			{ TEXT("0xdeadbeef"), TEXT("0x50f3bbad61146c28aa6121a141e9207e1c742a7774ee687435ca49cff9aa2f4e44ac6fda450a2a7cb6fbc618134f964594aba0b5df3a920f8922c773477017f81b"), AddressOfWeb3Key },
+			{ TEXT("hello"), TEXT("0x6b33f5b67b96e9edc7bdb65355751599cc23558e205c521f2a95924c95cc13693e1f262213b86709fa817266ecd8b3e25747d0e029e9fa77208ea4faea22ad761b"), AddressOfLastKey },
+			{ FString::ChrN(200, TEXT('x')), TEXT("0x7c3016e163ce1860d490e1f58466415acbf0bd4203b64a08311d970cbe98ffc84403a1effecd86600054fe594cfb7b282bc869899bc265ef9cabb0b9124f0d921b"), AddressOfLastKey },
+		};
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrSignatureRecoverTest, "AnkrSDK.Signature.RecoverSigner", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The signer of every reference signature is recovered with its EIP-55 address, malformed signatures are rejected and another message recovers another signer.
+bool FAnkrSignatureRecoverTest::RunTest(const FString& Parameters)
+{
+	const TArray<FSignatureVector> vectors = MakeVectors();
+	for (int32 i = 0; i < vectors.Num(); i++)
+	{
+		FString address, error;
+		if (TestTrue(FString::Printf(TEXT("Signature %d is recovered"), i), AnkrSignature::RecoverSigner(vectors[i].message, vectors[i].signature, address, error)))
+		{
+			TestEqual(FString::Printf(TEXT("The signer of signature %d"), i), address, vectors[i].address);
+		}
+	}
+
+	const FSignatureVector& hello = vectors[1];
+	FString address, error;
+
+	TestFalse(TEXT("A signature of 64 bytes is rejected"), AnkrSignature::RecoverSigner(hello.message, hello.signature.LeftChop(2), address, error));
+	TestFalse(TEXT("A v of 29 is rejected"), AnkrSignature::RecoverSigner(hello.message, hello.signature.LeftChop(2) + TEXT("1d"), address, error));
+
+	TestTrue(TEXT("A v of 1 is read as 28"), AnkrSignature::RecoverSigner(hello.message, hello.signature.LeftChop(2) + TEXT("01"), address, error) && address == AddressOfKey1);
+	TestTrue(TEXT("Another message recovers another signer"), AnkrSignature::RecoverSigner(TEXT("hello!"), hello.signature, address, error) && address != AddressOfKey1);
+
+	TestTrue(TEXT("The signer is found with the case of the address ignored"), UAnkrSignatureLibrary::IsMessageSignedBy(hello.message, hello.signature, AddressOfKey1.ToLower()));
+	TestFalse(TEXT("Another address is not the signer"), UAnkrSignatureLibrary::IsMessageSignedBy(hello.message, hello.signature, AddressOfKey2));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrSignatureHexMessageTest, "AnkrSDK.Signature.HexMessage", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A message of hex with 0x is hashed as the bytes it encodes like personal_sign, other messages are hashed as UTF-8.
+bool FAnkrSignatureHexMessageTest::RunTest(const FString& Parameters)
+{
+	const TArray<uint8> hello = AnkrSignature::HashPersonalMessage(TEXT("hello"));
+
+	TestTrue(TEXT("0x68656c6c6f is hashed as hello"), AnkrSignature::HashPersonalMessage(TEXT("0x68656c6c6f")) == hello);
+	TestTrue(TEXT("The case of the digits is ignored"), AnkrSignature::HashPersonalMessage(TEXT("0x68656C6C6F")) == hello);
+	TestTrue(TEXT("0X is not a hex prefix"), AnkrSignature::HashPersonalMessage(TEXT("0X68656c6c6f")) != hello);
+	TestTrue(TEXT("Hex without 0x is text"), AnkrSignature::HashPersonalMessage(TEXT("68656c6c6f")) != hello);
+	return true;
+}
+
+#endif
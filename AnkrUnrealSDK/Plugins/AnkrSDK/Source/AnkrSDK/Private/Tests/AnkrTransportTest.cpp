@@ -0,0 +1,171 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AnkrClient.h"
+#include "AnkrAbiCache.h"
+#include "AnkrJournal.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// The state of the round trip is written by the completions of the requests and read by the latent commands on the game thread.
+	struct FAnkrRoundTripState
+	{
+		TAtomic<int> step{ 0 };
+		FString abiHash;
+		FString ticket;
+		FString callData;
+		FString status;
+	};
+
+	const FString Contract = "0x0000000000000000000000000000000000000001";
+
+	// MakeStep keeps the data of a result, the response of CallMethod, the ticket of SendTransaction or the status of GetTicketResult.
+	FAnkrCallCompleteDelegate MakeStep(TSharedRef<FAnkrRoundTripState, ESPMode::ThreadSafe> _state, FString FAnkrRoundTripState::* _field)
+	{
+		return FAnkrCallCompleteDelegate::CreateLambda([_state, _field](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool)
+			{
+				(*_state).*_field = data;
+				_state->step++;
+			});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrMockRoundTripTest, "AnkrSDK.Transport.MockRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// An abi registered with the mock backend is accepted by CallMethod and SendTransaction, the ticket of the transaction is known to "result" and the method responses are returned by "call/method".
+bool FAnkrMockRoundTripTest::RunTest(const FString& Parameters)
+{
+	const bool wasLocalHashing = AnkrAbiCache::IsLocalHashing();
+	AnkrAbiCache::SetLocalHashing(false);
+
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = true;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> mock = AnkrTransport::GetMockBackend();
+	const int numRequests = mock->GetNumRequests();
+	const int numErrors	  = mock->GetNumErrors();
+
+	UAnkrClient* client = NewObject<UAnkrClient>();
+	client->AddToRoot();
+
+	// The method name is unique so the abi is never answered from the abi cache of an earlier run.
+	const FString method = "roundTrip" + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	const FString abi	 = "[{\"inputs\":[],\"name\":\"" + method + "\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"}]";
+	mock->SetMethodResponse(method, "0x2a");
+
+	TSharedRef<FAnkrRoundTripState, ESPMode::ThreadSafe> state = MakeShared<FAnkrRoundTripState, ESPMode::ThreadSafe>();
+	client->GetABIHash(abi, EAnkrCallbackThread::GameThread, [state](FString content, FString abiHash)
+		{
+			state->abiHash = abiHash;
+			state->step++;
+		});
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, method, abi, deadline]()
+		{
+			if (state->step < 1 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestEqual(TEXT("The mock backend hashes the abi like AnkrAbiCache"), state->abiHash, AnkrAbiCache::ComputeHash(abi));
+
+			// The arguments are unique so the journal never holds the transaction back as a repeat of an earlier run.
+			const FString args = "[\\\"" + FGuid::NewGuid().ToString(EGuidFormats::Digits) + "\\\"]";
+			client->CallMethod(Contract, state->abiHash, method, "[]", MakeStep(state, &FAnkrRoundTripState::callData));
+			client->SendTransaction(Contract, state->abiHash, method, args, MakeStep(state, &FAnkrRoundTripState::ticket));
+			return true;
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, deadline]()
+		{
+			if (state->step < 3 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("The call returns the method response"), state->callData.Contains(TEXT("\"data\":\"0x2a\"")));
+			TestFalse(TEXT("The transaction receives a ticket"), state->ticket.IsEmpty());
+			client->GetTicketResult(state->ticket, MakeStep(state, &FAnkrRoundTripState::status));
+			return true;
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, mock, numRequests, numErrors, deadline, wasLocalHashing, wasMockBackend]()
+		{
+			if (state->step < 4 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestEqual(TEXT("The ticket of the transaction succeeds"), state->status, FString(TICKET_STATUS_SUCCESS));
+			TestEqual(TEXT("The abi, the call, the transaction and the result are sent"), mock->GetNumRequests() - numRequests, 4);
+			TestEqual(TEXT("No request fails"), mock->GetNumErrors() - numErrors, 0);
+
+			client->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			AnkrAbiCache::SetLocalHashing(wasLocalHashing);
+			return true;
+		}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrMockFailureTest, "AnkrSDK.Transport.MockFailures", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A failing endpoint still answers with a response carrying the error code, and the mock backend rejects what the Ankr API would reject.
+bool FAnkrMockFailureTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = true;
+	settings.failingEndpoints		= { "call/method" };
+	settings.errorCode				= 503;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> mock = AnkrTransport::GetMockBackend();
+
+	int code = EHttpResponseCodes::Ok;
+	TestTrue(TEXT("An unknown abi hash is rejected"), mock->Respond("send/transaction", "{\"abi_hash\":\"unknown\"}", code).Contains(TEXT("\"result\":false")));
+	TestTrue(TEXT("An unknown ticket is unknown"), mock->Respond("result", "{\"ticket\":\"unknown\"}", code).Contains(TEXT("\"status\":\"unknown\"")));
+	TestEqual(TEXT("A rejection is still answered with 200"), code, (int)EHttpResponseCodes::Ok);
+
+	mock->Respond("unknown/endpoint", "{}", code);
+	TestEqual(TEXT("An unknown endpoint is not found"), code, (int)EHttpResponseCodes::NotFound);
+
+	const int numErrors = mock->GetNumErrors();
+
+	UAnkrClient* client = NewObject<UAnkrClient>();
+	client->AddToRoot();
+
+	TSharedRef<FAnkrRoundTripState, ESPMode::ThreadSafe> state = MakeShared<FAnkrRoundTripState, ESPMode::ThreadSafe>();
+	client->CallMethod(Contract, "unknown", "failing", "[]", MakeStep(state, &FAnkrRoundTripState::callData));
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, state, client, mock, numErrors, deadline, wasMockBackend]()
+		{
+			if (state->step < 1 && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("The failed call is answered"), state->step.Load() == 1);
+			TestTrue(TEXT("The response carries the error code"), state->callData.Contains(TEXT("\"code\":503")));
+			TestEqual(TEXT("The failure is counted"), mock->GetNumErrors() - numErrors, 1);
+
+			client->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+#endif
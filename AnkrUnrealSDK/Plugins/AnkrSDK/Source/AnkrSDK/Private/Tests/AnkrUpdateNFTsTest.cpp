@@ -0,0 +1,194 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UpdateNFTExample.h"
+#include "AnkrJournal.h"
+#include "AnkrRequestContext.h"
+#include "AnkrTransport.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	TArray<FItemInfoStructure> MakeItems(int32 _count, TSet<FString>& _tokenIds)
+	{
+		const int32 first = FMath::RandRange(100000000, 200000000);
+
+		TArray<FItemInfoStructure> items;
+		for (int32 i = 0; i < _count; i++)
+		{
+			FItemInfoStructure item{};
+			item.tokenId	= first + i;
+			item.itemType	= 1;
+			item.strength	= i;
+			item.level		= 2;
+			item.expireTime = 0;
+			items.Add(item);
+			_tokenIds.Add(item.GetTokenId());
+		}
+		return items;
+	}
+
+	// GetChunks gets the requests UpdateNFTs journaled for the items, only the requests that received their ticket are returned once all of them did.
+	bool GetChunks(const TSet<FString>& _tokenIds, int32 _expected, TArray<FAnkrJournalEntry>& _chunks)
+	{
+		_chunks.Reset();
+		for (const FAnkrJournalEntry& entry : AnkrJournal::GetPendingEntries())
+		{
+			if (entry.sender.Equals(TEXT("UpdateNFTs")) && entry.context.itemIds.Num() > 0 && _tokenIds.Contains(entry.context.itemIds[0]) && !entry.ticket.IsEmpty())
+			{
+				_chunks.Add(entry);
+			}
+		}
+		return _chunks.Num() >= _expected;
+	}
+
+	void ResolveChunks(const TArray<FAnkrJournalEntry>& _chunks)
+	{
+		for (const FAnkrJournalEntry& chunk : _chunks)
+		{
+			AnkrJournal::RecordResolved(chunk.ticket, TICKET_STATUS_SUCCESS);
+			AnkrRequestContext::Release(chunk.ticket);
+		}
+	}
+
+	UUpdateNFTExample* MakeExample()
+	{
+		UUpdateNFTExample* example = NewObject<UUpdateNFTExample>();
+		example->AddToRoot();
+		example->Init("AnkrUpdateNFTsTest", "");
+		return example;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrUpdateNFTsChunkTest, "AnkrSDK.UpdateNFT.Chunks", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// The items of a batch method are split by MaxItemsPerRequest and by MaxRequestBytes, every chunk is one request with one ticket and carries the token ids of its items in order.
+bool FAnkrUpdateNFTsChunkTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = false;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	UUpdateNFTExample* example		= MakeExample();
+	example->BatchUpdateMethodName	= "updateTokensWithSignedMessage";
+	example->MaxItemsPerRequest		= 4;
+	example->MaxConcurrentRequests	= 2;
+
+	TSet<FString> countedIds;
+	const TArray<FItemInfoStructure> counted = MakeItems(10, countedIds);
+	example->UpdateNFTs("updates", counted, FAnkrUpdateNFTItemDelegate(), FAnkrCallCompleteDynamicDelegate());
+
+	// The second call is bounded by the size, a request body holds the envelope and about four items.
+	UUpdateNFTExample* sized = MakeExample();
+	sized->BatchUpdateMethodName = "updateTokensWithSignedMessage";
+	sized->MaxItemsPerRequest	 = 100;
+	sized->MaxRequestBytes		 = 600;
+
+	TSet<FString> sizedIds;
+	const TArray<FItemInfoStructure> sizedItems = MakeItems(7, sizedIds);
+	sized->UpdateNFTs("updates", sizedItems, FAnkrUpdateNFTItemDelegate(), FAnkrCallCompleteDynamicDelegate());
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, example, sized, countedIds, sizedIds, counted, deadline, wasMockBackend]()
+		{
+			TArray<FAnkrJournalEntry> countedChunks, sizedChunks;
+			const bool isDone = GetChunks(countedIds, 3, countedChunks) & GetChunks(sizedIds, 2, sizedChunks);
+			if (!isDone && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			if (TestEqual(TEXT("Ten items in chunks of four make three requests"), countedChunks.Num(), 3))
+			{
+				TArray<FString> sent;
+				countedChunks.Sort([](const FAnkrJournalEntry& a, const FAnkrJournalEntry& b) { return a.context.itemIds[0] < b.context.itemIds[0]; });
+				for (const FAnkrJournalEntry& chunk : countedChunks)
+				{
+					TestTrue(TEXT("A chunk holds at most four items"), chunk.context.itemIds.Num() <= 4);
+					TestTrue(TEXT("A chunk calls the batch method"), chunk.body.Contains(TEXT("\"updateTokensWithSignedMessage\"")));
+					sent.Append(chunk.context.itemIds);
+				}
+
+				TArray<FString> expected;
+				for (const FItemInfoStructure& item : counted)
+				{
+					expected.Add(item.GetTokenId());
+				}
+				TestTrue(TEXT("Every item is sent once and in order"), sent == expected);
+			}
+
+			TestTrue(TEXT("The size splits seven items in several requests"), sizedChunks.Num() >= 2);
+			int32 sizedItems = 0;
+			for (const FAnkrJournalEntry& chunk : sizedChunks)
+			{
+				TestTrue(TEXT("A request body fits in MaxRequestBytes"), FTCHARToUTF8(*chunk.body).Length() <= 600);
+				sizedItems += chunk.context.itemIds.Num();
+			}
+			TestEqual(TEXT("Every item of the sized call is sent"), sizedItems, 7);
+
+			ResolveChunks(countedChunks);
+			ResolveChunks(sizedChunks);
+			example->RemoveFromRoot();
+			sized->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnkrUpdateNFTsSingleTest, "AnkrSDK.UpdateNFT.SingleItemRequests", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Without a batch method every item is sent on its own with updateTokenWithSignedMessage and receives its own ticket.
+bool FAnkrUpdateNFTsSingleTest::RunTest(const FString& Parameters)
+{
+	const bool wasMockBackend = AnkrTransport::GetMockBackend().IsValid();
+	FAnkrMockBackendSettings settings;
+	settings.rejectUnknownAbiHashes = false;
+	AnkrTransport::UseMockBackend(true, settings);
+
+	TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> mock = AnkrTransport::GetMockBackend();
+	const int numRequests = mock->GetNumRequests();
+
+	UUpdateNFTExample* example = MakeExample();
+
+	TSet<FString> tokenIds;
+	example->UpdateNFTs("updates", MakeItems(3, tokenIds), FAnkrUpdateNFTItemDelegate(), FAnkrCallCompleteDynamicDelegate());
+	example->UpdateNFTs("updates", TArray<FItemInfoStructure>(), FAnkrUpdateNFTItemDelegate(), FAnkrCallCompleteDynamicDelegate());
+
+	const double deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, example, mock, numRequests, tokenIds, deadline, wasMockBackend]()
+		{
+			TArray<FAnkrJournalEntry> chunks;
+			if (!GetChunks(tokenIds, 3, chunks) && FPlatformTime::Seconds() < deadline)
+			{
+				return false;
+			}
+
+			TestEqual(TEXT("Every item is its own request"), chunks.Num(), 3);
+			TestEqual(TEXT("No request is sent for an empty update"), mock->GetNumRequests() - numRequests, 3);
+
+			TSet<FString> tickets;
+			for (const FAnkrJournalEntry& chunk : chunks)
+			{
+				TestEqual(TEXT("A request holds one item"), chunk.context.itemIds.Num(), 1);
+				TestTrue(TEXT("A single item is sent with updateTokenWithSignedMessage"), chunk.body.Contains(TEXT("\"updateTokenWithSignedMessage\"")));
+				tickets.Add(chunk.ticket);
+			}
+			TestEqual(TEXT("Every request receives its own ticket"), tickets.Num(), chunks.Num());
+
+			ResolveChunks(chunks);
+			example->RemoveFromRoot();
+			if (!wasMockBackend)
+			{
+				AnkrTransport::UseMockBackend(false, FAnkrMockBackendSettings());
+			}
+			return true;
+		}));
+	return true;
+}
+
+#endif
@@ -1,14 +1,36 @@
 #include "UpdateNFTExample.h"
 #include "AnkrUtility.h"
+#include "AnkrTransport.h"
 #include "RequestBodyStructure.h"
+#include "AnkrJournal.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrAbiCache.h"
+
+// UpdateNFTBatch holds the chunks of an UpdateNFTs call and how far the submission went.
+struct FUpdateNFTBatch
+{
+	FString abi_hash;
+	TArray<FString> bodies;
+	TArray<TArray<FItemInfoStructure>> chunks;
+	int next = 0;
+	int inFlight = 0;
+	int updated = 0;
+	bool isWalletOpened = false;
+	FAnkrUpdateNFTItemDelegate ItemResult;
+	FAnkrCallCompleteDynamicDelegate Result;
+};
 
-// Contract address and ABI are assigned.
 UUpdateNFTExample::UUpdateNFTExample(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
-	ContractAddress = "0x159D0A933137f3EC155f43834BDFCd534A8bfd61";
-	ABI				= "[{\"inputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"constructor\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"approved\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"Approval\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"indexed\":false,\"internalType\":\"bool\",\"name\":\"approved\",\"type\":\"bool\"}],\"name\":\"ApprovalForAll\",\"type\":\"event\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"approve\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"burn\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"grantRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"components\":[{\"internalType\":\"uint256\",\"name\":\"itemType\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"strength\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"level\",\"type\":\"uint256\"}],\"internalType\":\"struct GameItem.Item\",\"name\":\"item\",\"type\":\"tuple\"}],\"name\":\"mintToken\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"components\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"itemType\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"strength\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"level\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"expireTime\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"signature\",\"type\":\"bytes\"}],\"internalType\":\"struct GameItem.ItemInfo\",\"name\":\"itemInfo\",\"type\":\"tuple\"}],\"name\":\"mintTokenWithSignedMessage\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"pause\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":false,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"Paused\",\"type\":\"event\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"renounceRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"revokeRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"previousAdminRole\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"newAdminRole\",\"type\":\"bytes32\"}],\"name\":\"RoleAdminChanged\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"sender\",\"type\":\"address\"}],\"name\":\"RoleGranted\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"sender\",\"type\":\"address\"}],\"name\":\"RoleRevoked\",\"type\":\"event\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"safeTransferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"_data\",\"type\":\"bytes\"}],\"name\":\"safeTransferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"internalType\":\"bool\",\"name\":\"approved\",\"type\":\"bool\"}],\"name\":\"setApprovalForAll\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"Transfer\",\"type\":\"event\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"transferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"unpause\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":false,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"Unpaused\",\"type\":\"event\"},{\"inputs\":[{\"components\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"itemType\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"strength\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"level\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"expireTime\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"signature\",\"type\":\"bytes\"}],\"internalType\":\"struct GameItem.ItemInfo\",\"name\":\"itemInfo\",\"type\":\"tuple\"}],\"name\":\"updateTokenWithSignedMessage\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"}],\"name\":\"balanceOf\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"DEFAULT_ADMIN_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"getApproved\",\"outputs\":[{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"}],\"name\":\"getRoleAdmin\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"getTokenDetails\",\"outputs\":[{\"components\":[{\"internalType\":\"uint256\",\"name\":\"itemType\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"strength\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"level\",\"type\":\"uint256\"}],\"internalType\":\"struct GameItem.Item\",\"name\":\"\",\"type\":\"tuple\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"hasRole\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"}],\"name\":\"isApprovedForAll\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"MINTER_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"name\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"ownerOf\",\"outputs\":[{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"paused\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"PAUSER_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes4\",\"name\":\"interfaceId\",\"type\":\"bytes4\"}],\"name\":\"supportsInterface\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"symbol\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"index\",\"type\":\"uint256\"}],\"name\":\"tokenByIndex\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"index\",\"type\":\"uint256\"}],\"name\":\"tokenOfOwnerByIndex\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"tokenURI\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"totalSupply\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"UPDATER_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"}]";
+	MaxItemsPerRequest	  = 50;
+	MaxRequestBytes		  = 16384;
+	MaxConcurrentRequests = 4;
 }
 
+// The contract is looked up whenever it is used, so blueprint subclasses and the class default object see the registered contract too.
+FString UUpdateNFTExample::GetContractAddress() const { return AnkrContractRegistry::Get(CONTRACT_UPDATE_NFT).GetAddress(); }
+FString UUpdateNFTExample::GetABI() const			  { return AnkrContractRegistry::Get(CONTRACT_UPDATE_NFT).GetABI(); }
+
 // Init will save deviceId and session when the wallet is connected successfully.
 void UUpdateNFTExample::Init(FString _deviceId, FString _session)
 {
@@ -26,6 +48,8 @@ void UUpdateNFTExample::SetAccount(FString _account, int _chainId)
 // GetNFTInfo is used to get the NFT metadata.
 void UUpdateNFTExample::GetNFTInfo(FString abi_hash, int tokenId, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -33,10 +57,11 @@ void UUpdateNFTExample::GetNFTInfo(FString abi_hash, int tokenId, FAnkrCallCompl
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("UpdateNFTExample - GetNFTInfo - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -48,20 +73,22 @@ void UUpdateNFTExample::GetNFTInfo(FString abi_hash, int tokenId, FAnkrCallCompl
 	});
 
 	FString getTokenDetailsMethodName = "getTokenDetails";
-	FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + ContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + getTokenDetailsMethodName + "\", \"args\": \"" + FString::FromInt(tokenId) + "\"}";
+	FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + getTokenDetailsMethodName + "\", \"args\": \"" + FString::FromInt(tokenId) + "\"}";
 	
 	FString url = AnkrUtility::GetUrl() + ENDPOINT_CALL_METHOD;
 	Request->SetURL(url);
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString(body);
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // UpdateNFT is used to update the metadata of an NFT.
 // Metamask will show popup to sign or confirm the transaction for that ticket.
 void UUpdateNFTExample::UpdateNFT(FString abi_hash, FItemInfoStructure _item, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -69,10 +96,13 @@ void UUpdateNFTExample::UpdateNFT(FString abi_hash, FItemInfoStructure _item, FA
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::UpdateNFT, FAnkrUInt256(), { _item.GetTokenId() });
+
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, context, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("UpdateNFTExample - UpdateNFT - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -80,6 +110,7 @@ void UUpdateNFTExample::UpdateNFT(FString abi_hash, FItemInfoStructure _item, FA
 		if (FJsonSerializer::Deserialize(Reader, JsonObject))
 		{
 			FString ticket = JsonObject->GetStringField("ticket");
+			AnkrJournal::RecordResponse(context.requestId, ticket);
 			Result.ExecuteIfBound(content, ticket, "", -1, false);
 
 #if PLATFORM_ANDROID
@@ -90,26 +121,200 @@ void UUpdateNFTExample::UpdateNFT(FString abi_hash, FItemInfoStructure _item, FA
 
 	AnkrUtility::SetLastRequest("UpdateNFT");
 
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, abi_hash, _item]()
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, context, abi_hash, _item, Result]()
 	{
 		FItemInfoStructure item = _item;
 
 		FRequestBodyStruct body{};
 		body.device_id		  = deviceId;
-		body.contract_address = ContractAddress;
+		body.contract_address = GetContractAddress();
 		body.abi_hash		  = abi_hash;
 		body.method			  = "updateTokenWithSignedMessage";
 		body.args.Add(item);
 
+		FString content = FRequestBodyStruct::ToJson(body);
+		if (!AnkrJournal::RecordSubmit(context.requestId, "UpdateNFT", content, context, Result))
+		{
+			return;
+		}
+
 		FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
 		Request->SetURL(url);
 		Request->SetVerb("POST");
 		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-		Request->SetContentAsString(FRequestBodyStruct::ToJson(body));
-		Request->ProcessRequest();
+		Request->SetContentAsString(content);
+		AnkrTransport::ProcessRequest(Request);
 	});
 }
 
+// UpdateNFTs is used to update the metadata of many NFTs, the items are chunked and every chunk receives one ticket.
+// Metamask will show popup to sign or confirm the transaction for every ticket.
+void UUpdateNFTExample::UpdateNFTs(FString abi_hash, TArray<FItemInfoStructure> _items, FAnkrUpdateNFTItemDelegate ItemResult, FAnkrCallCompleteDynamicDelegate Result)
+{
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
+	if (_items.Num() <= 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UpdateNFTExample - UpdateNFTs - There are no items to update"));
+		Result.ExecuteIfBound("", "0", "", 0, false);
+		return;
+	}
+
+	http = &FHttpModule::Get();
+
+	TSharedPtr<FUpdateNFTBatch> batch = MakeShared<FUpdateNFTBatch>();
+	batch->abi_hash	  = abi_hash;
+	batch->ItemResult = ItemResult;
+	batch->Result	  = Result;
+
+	const bool isBatched		  = !BatchUpdateMethodName.IsEmpty();
+	const int maxItems			  = isBatched ? FMath::Max(1, MaxItemsPerRequest) : 1;
+	const FString contractAddress = GetContractAddress();
+	const FString prefix		  = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + contractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + BatchUpdateMethodName + "\", \"args\": [[";
+	const FString postfix		  = "]]}";
+
+	// The body is sent as UTF-8, so its size is counted in UTF-8 bytes and not in characters.
+	const int envelopeBytes = FTCHARToUTF8(*prefix).Length() + FTCHARToUTF8(*postfix).Length();
+
+	// Items are appended to the current chunk until either limit is reached, a single item always makes a chunk on its own.
+	TArray<FItemInfoStructure> chunk;
+	FString chunkArgs;
+	int chunkBytes = 0;
+	for (const FItemInfoStructure& item : _items)
+	{
+		const FString itemJson = FItemInfoStructure::ToJson(item, false);
+		const int itemBytes = FTCHARToUTF8(*itemJson).Length();
+
+		const int size = envelopeBytes + chunkBytes + 1 + itemBytes;
+		if (chunk.Num() > 0 && (chunk.Num() >= maxItems || size > MaxRequestBytes))
+		{
+			batch->chunks.Add(chunk);
+			batch->bodies.Add(prefix + chunkArgs + postfix);
+			chunk.Reset();
+			chunkArgs.Reset();
+			chunkBytes = 0;
+		}
+
+		chunkBytes += (chunk.Num() > 0 ? 1 : 0) + itemBytes;
+		chunkArgs  += (chunk.Num() > 0 ? "," : "") + itemJson;
+		chunk.Add(item);
+
+		if (!isBatched)
+		{
+			FRequestBodyStruct body{};
+			body.device_id		  = deviceId;
+			body.contract_address = contractAddress;
+			body.abi_hash		  = abi_hash;
+			body.method			  = "updateTokenWithSignedMessage";
+			body.args.Add(item);
+
+			batch->chunks.Add(chunk);
+			batch->bodies.Add(FRequestBodyStruct::ToJson(body));
+			chunk.Reset();
+			chunkArgs.Reset();
+			chunkBytes = 0;
+		}
+	}
+	if (chunk.Num() > 0)
+	{
+		batch->chunks.Add(chunk);
+		batch->bodies.Add(prefix + chunkArgs + postfix);
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("UpdateNFTExample - UpdateNFTs - %d items are sent in %d requests"), _items.Num(), batch->chunks.Num());
+
+	AnkrUtility::SetLastRequest("UpdateNFTs");
+	SendUpdateChunks(batch);
+}
+
+// SendUpdateChunks keeps up to MaxConcurrentRequests chunks in flight, every answered chunk sends the next one.
+void UUpdateNFTExample::SendUpdateChunks(TSharedPtr<FUpdateNFTBatch> batch)
+{
+	while (batch->inFlight < FMath::Max(1, MaxConcurrentRequests) && batch->next < batch->chunks.Num())
+	{
+		const int index = batch->next++;
+		const TArray<FItemInfoStructure>& chunk = batch->chunks[index];
+		const FString& body = batch->bodies[index];
+
+		TArray<FString> tokenIds;
+		for (const FItemInfoStructure& item : chunk)
+		{
+			tokenIds.Add(item.GetTokenId());
+		}
+		const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::UpdateNFT, FAnkrUInt256(), tokenIds);
+
+		// OnChunkComplete reports every item of the chunk and finishes the batch after the last chunk.
+		// The wallet is opened once, when the first ticket to confirm is received.
+		TFunction<void(FString)> OnChunkComplete = [this, batch, index](FString ticket)
+		{
+			const bool success = !ticket.IsEmpty();
+
+#if PLATFORM_ANDROID
+			if (success && !batch->isWalletOpened)
+			{
+				batch->isWalletOpened = true;
+				FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
+			}
+#endif
+			for (const FItemInfoStructure& item : batch->chunks[index])
+			{
+				batch->ItemResult.ExecuteIfBound(item.GetTokenIdValue(), ticket, success);
+				if (success) batch->updated++;
+			}
+
+			batch->inFlight--;
+			if (batch->next < batch->chunks.Num())
+			{
+				SendUpdateChunks(batch);
+			}
+			else if (batch->inFlight == 0)
+			{
+				batch->Result.ExecuteIfBound("", FString::FromInt(batch->chunks.Num()), "", batch->updated, batch->updated > 0);
+			}
+		};
+
+		batch->inFlight++;
+
+		if (!AnkrJournal::RecordSubmit(context.requestId, "UpdateNFTs", body, context, [OnChunkComplete](FString content, FString ticket) { OnChunkComplete(ticket); }))
+		{
+			continue;
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
+#else
+		TSharedRef<IHttpRequest> Request = http->CreateRequest();
+#endif
+		Request->OnProcessRequestComplete().BindLambda([abi_hash = batch->abi_hash, OnChunkComplete, context](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+		{
+			FString ticket;
+			if (bWasSuccessful && Response.IsValid())
+			{
+				const FString content = Response->GetContentAsString();
+				UE_LOG(LogTemp, Warning, TEXT("UpdateNFTExample - UpdateNFTs - GetContentAsString: %s"), *content);
+				AnkrAbiCache::Validate(abi_hash, content);
+
+				TSharedPtr<FJsonObject> JsonObject;
+				TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
+				if (FJsonSerializer::Deserialize(Reader, JsonObject))
+				{
+					JsonObject->TryGetStringField("ticket", ticket);
+				}
+			}
+			AnkrJournal::RecordResponse(context.requestId, ticket);
+
+			OnChunkComplete(ticket);
+		});
+
+		FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
+		Request->SetURL(url);
+		Request->SetVerb("POST");
+		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
+		Request->SetContentAsString(body);
+		AnkrTransport::ProcessRequest(Request);
+	}
+}
+
 // GetTicketResult is used to verify if the ticket was successfully confirmed.
 // The 'status' shows whether the result for the ticket signed has a success with a transaction hash.
 // The 'code' shows a code number related to a specific failure or success.
@@ -132,7 +337,18 @@ void UUpdateNFTExample::GetTicketResult(FString ticketId, FAnkrCallCompleteDynam
 			{
 				FString data = JsonObject->GetStringField("data");
 
-				Result.ExecuteIfBound(content, data, "", 1, false);// "Transaction Hash: " + data, 1);
+				FAnkrRequestContext context;
+				AnkrRequestContext::Find(ticketId, context);
+
+				FString ticketStatus;
+				const bool resolved = AnkrJournal::ResolveTicket(ticketId, JsonObject, ticketStatus);
+
+				Result.ExecuteIfBound(content, data, FAnkrRequestContext::ToJson(context), 1, false);// "Transaction Hash: " + data, 1);
+
+				if (resolved)
+				{
+					AnkrRequestContext::Release(ticketId);
+				}
 		}
 	});
 
@@ -141,5 +357,5 @@ void UUpdateNFTExample::GetTicketResult(FString ticketId, FAnkrCallCompleteDynam
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"ticket\": \"" + ticketId + "\" }");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
 }
\ No newline at end of file
@@ -2,31 +2,49 @@
 #include "UpdateNFTExample.h"
 #include "ItemInfo.h"
 #include "AnkrUtility.h"
+#include "AnkrTransport.h"
 #include "RequestBodyStructure.h"
+#include "AnkrJournal.h"
+#include "AnkrRequestContext.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrAbiCache.h"
+#include "AnkrAbi.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 
-// Contract addresses, ABIs, transaction limit and some item tokens are assigned.
+// The transaction limit is assigned here, contract addresses, ABIs and item tokens are read from the contract registry whenever they are used.
 UWearableNFTExample::UWearableNFTExample(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
-	GameItemContractAddress		 = "0xD0eF33b38D8525728902D90b20d6e2F303B8dc2C";
-	//GameItemContractAddress		 = "0x26aFc7805Aa279fB0E806c2bc1e2bF37A70F995d";
-	GameItemABI					 = "[{\"inputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"constructor\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"indexed\":false,\"internalType\":\"bool\",\"name\":\"approved\",\"type\":\"bool\"}],\"name\":\"ApprovalForAll\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"previousAdminRole\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"newAdminRole\",\"type\":\"bytes32\"}],\"name\":\"RoleAdminChanged\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"sender\",\"type\":\"address\"}],\"name\":\"RoleGranted\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"sender\",\"type\":\"address\"}],\"name\":\"RoleRevoked\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"indexed\":false,\"internalType\":\"uint256[]\",\"name\":\"ids\",\"type\":\"uint256[]\"},{\"indexed\":false,\"internalType\":\"uint256[]\",\"name\":\"values\",\"type\":\"uint256[]\"}],\"name\":\"TransferBatch\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"value\",\"type\":\"uint256\"}],\"name\":\"TransferSingle\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":false,\"internalType\":\"string\",\"name\":\"value\",\"type\":\"string\"},{\"indexed\":true,\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"}],\"name\":\"URI\",\"type\":\"event\"},{\"inputs\":[],\"name\":\"DEFAULT_ADMIN_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"MINTER_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"URI_SETTER_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"}],\"name\":\"balanceOf\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address[]\",\"name\":\"accounts\",\"type\":\"address[]\"},{\"internalType\":\"uint256[]\",\"name\":\"ids\",\"type\":\"uint256[]\"}],\"name\":\"balanceOfBatch\",\"outputs\":[{\"internalType\":\"uint256[]\",\"name\":\"\",\"type\":\"uint256[]\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"value\",\"type\":\"uint256\"}],\"name\":\"burn\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"internalType\":\"uint256[]\",\"name\":\"ids\",\"type\":\"uint256[]\"},{\"internalType\":\"uint256[]\",\"name\":\"values\",\"type\":\"uint256[]\"}],\"name\":\"burnBatch\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"}],\"name\":\"exists\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"}],\"name\":\"getRoleAdmin\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"grantRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"hasRole\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"}],\"name\":\"isApprovedForAll\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"amount\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"data\",\"type\":\"bytes\"}],\"name\":\"mint\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256[]\",\"name\":\"ids\",\"type\":\"uint256[]\"},{\"internalType\":\"uint256[]\",\"name\":\"amounts\",\"type\":\"uint256[]\"},{\"internalType\":\"bytes\",\"name\":\"data\",\"type\":\"bytes\"}],\"name\":\"mintBatch\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"renounceRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"revokeRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256[]\",\"name\":\"ids\",\"type\":\"uint256[]\"},{\"internalType\":\"uint256[]\",\"name\":\"amounts\",\"type\":\"uint256[]\"},{\"internalType\":\"bytes\",\"name\":\"data\",\"type\":\"bytes\"}],\"name\":\"safeBatchTransferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"amount\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"data\",\"type\":\"bytes\"}],\"name\":\"safeTransferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"internalType\":\"bool\",\"name\":\"approved\",\"type\":\"bool\"}],\"name\":\"setApprovalForAll\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"string\",\"name\":\"newuri\",\"type\":\"string\"}],\"name\":\"setURI\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes4\",\"name\":\"interfaceId\",\"type\":\"bytes4\"}],\"name\":\"supportsInterface\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"id\",\"type\":\"uint256\"}],\"name\":\"totalSupply\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"name\":\"uri\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"}]";
-
-	GameCharacterContractAddress = "0x7081F409F750EACD27867c988b4B3771d935Fe16";
-	//GameCharacterContractAddress = "0x2ff8d8a0e5d8e3cf34aa490abfd8f365e1f77f0d";
-	//GameCharacterContractAddress = "0x10555B832DE7bAD8459d6de1D8E8F5ad990709A0";
-	GameCharacterABI			 = "[{\"inputs\":[{\"internalType\":\"address\",\"name\":\"gameItemContractAddress\",\"type\":\"address\"}],\"stateMutability\":\"nonpayable\",\"type\":\"constructor\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"approved\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"Approval\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"indexed\":false,\"internalType\":\"bool\",\"name\":\"approved\",\"type\":\"bool\"}],\"name\":\"ApprovalForAll\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"oldGlassesId\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"newGlassesId\",\"type\":\"uint256\"}],\"name\":\"GlassesChanged\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"oldHatId\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"newHatId\",\"type\":\"uint256\"}],\"name\":\"HatChanged\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"previousAdminRole\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"newAdminRole\",\"type\":\"bytes32\"}],\"name\":\"RoleAdminChanged\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"sender\",\"type\":\"address\"}],\"name\":\"RoleGranted\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"sender\",\"type\":\"address\"}],\"name\":\"RoleRevoked\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"oldShoesId\",\"type\":\"uint256\"},{\"indexed\":false,\"internalType\":\"uint256\",\"name\":\"newShoesId\",\"type\":\"uint256\"}],\"name\":\"ShoesChanged\",\"type\":\"event\"},{\"anonymous\":false,\"inputs\":[{\"indexed\":true,\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"indexed\":true,\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"Transfer\",\"type\":\"event\"},{\"inputs\":[],\"name\":\"DEFAULT_ADMIN_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"MINTER_ROLE\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"approve\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"}],\"name\":\"balanceOf\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"burn\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"newGlassesId\",\"type\":\"uint256\"}],\"name\":\"changeGlasses\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"newHatId\",\"type\":\"uint256\"}],\"name\":\"changeHat\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"newShoesId\",\"type\":\"uint256\"}],\"name\":\"changeShoes\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"getApproved\",\"outputs\":[{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"}],\"name\":\"getGlasses\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"}],\"name\":\"getHat\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"}],\"name\":\"getRoleAdmin\",\"outputs\":[{\"internalType\":\"bytes32\",\"name\":\"\",\"type\":\"bytes32\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"characterId\",\"type\":\"uint256\"}],\"name\":\"getShoes\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"grantRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"hasRole\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"}],\"name\":\"isApprovedForAll\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"name\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"},{\"internalType\":\"uint256[]\",\"name\":\"\",\"type\":\"uint256[]\"},{\"internalType\":\"uint256[]\",\"name\":\"\",\"type\":\"uint256[]\"},{\"internalType\":\"bytes\",\"name\":\"\",\"type\":\"bytes\"}],\"name\":\"onERC1155BatchReceived\",\"outputs\":[{\"internalType\":\"bytes4\",\"name\":\"\",\"type\":\"bytes4\"}],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"},{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"\",\"type\":\"bytes\"}],\"name\":\"onERC1155Received\",\"outputs\":[{\"internalType\":\"bytes4\",\"name\":\"\",\"type\":\"bytes4\"}],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"ownerOf\",\"outputs\":[{\"internalType\":\"address\",\"name\":\"\",\"type\":\"address\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"renounceRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes32\",\"name\":\"role\",\"type\":\"bytes32\"},{\"internalType\":\"address\",\"name\":\"account\",\"type\":\"address\"}],\"name\":\"revokeRole\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"}],\"name\":\"safeMint\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"safeTransferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"},{\"internalType\":\"bytes\",\"name\":\"_data\",\"type\":\"bytes\"}],\"name\":\"safeTransferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"operator\",\"type\":\"address\"},{\"internalType\":\"bool\",\"name\":\"approved\",\"type\":\"bool\"}],\"name\":\"setApprovalForAll\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"bytes4\",\"name\":\"interfaceId\",\"type\":\"bytes4\"}],\"name\":\"supportsInterface\",\"outputs\":[{\"internalType\":\"bool\",\"name\":\"\",\"type\":\"bool\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"symbol\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"index\",\"type\":\"uint256\"}],\"name\":\"tokenByIndex\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"owner\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"index\",\"type\":\"uint256\"}],\"name\":\"tokenOfOwnerByIndex\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"tokenURI\",\"outputs\":[{\"internalType\":\"string\",\"name\":\"\",\"type\":\"string\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[],\"name\":\"totalSupply\",\"outputs\":[{\"internalType\":\"uint256\",\"name\":\"\",\"type\":\"uint256\"}],\"stateMutability\":\"view\",\"type\":\"function\"},{\"inputs\":[{\"internalType\":\"address\",\"name\":\"from\",\"type\":\"address\"},{\"internalType\":\"address\",\"name\":\"to\",\"type\":\"address\"},{\"internalType\":\"uint256\",\"name\":\"tokenId\",\"type\":\"uint256\"}],\"name\":\"transferFrom\",\"outputs\":[],\"stateMutability\":\"nonpayable\",\"type\":\"function\"}]";
-
-	TransactionGasLimit			 = "1000000";
-	BlueHatAddress				 = "0x00010000000000000000000000000000000000000000000000000000000001";
-	RedHatAddress				 = "0x00010000000000000000000000000000000000000000000000000000000002";
-	WhiteHatAddress				 = "0x00010000000000000000000000000000000000000000000000000000000003";
-	BlueShoesAddress			 = "0x00020000000000000000000000000000000000000000000000000000000001";
-	RedShoesAddress				 = "0x00020000000000000000000000000000000000000000000000000000000002";
-	WhiteShoesAddress			 = "0x00020000000000000000000000000000000000000000000000000000000003";
-	BlueGlassesAddress			 = "0x00030000000000000000000000000000000000000000000000000000000001";
-	RedGlassesAddress			 = "0x00030000000000000000000000000000000000000000000000000000000002";
-	WhiteGlassesAddress			 = "0x00030000000000000000000000000000000000000000000000000000000003";
+	TransactionGasLimit = "1000000";
+	OptimisticEquip		= false;
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return;
+	}
+
+	AnkrJournal::OnTicketResolved().AddUObject(this, &UWearableNFTExample::OnTicketResolved);
+}
+
+FString UWearableNFTExample::GetGameItemContractAddress() const		 { return AnkrContractRegistry::Get(CONTRACT_GAME_ITEM).GetAddress(); }
+FString UWearableNFTExample::GetGameItemABI() const					 { return AnkrContractRegistry::Get(CONTRACT_GAME_ITEM).GetABI(); }
+FString UWearableNFTExample::GetGameCharacterContractAddress() const { return AnkrContractRegistry::Get(CONTRACT_GAME_CHARACTER).GetAddress(); }
+FString UWearableNFTExample::GetGameCharacterABI() const			 { return AnkrContractRegistry::Get(CONTRACT_GAME_CHARACTER).GetABI(); }
+
+FString UWearableNFTExample::GetBlueHatAddress() const		{ return AnkrContractRegistry::GetItem("BlueHat"); }
+FString UWearableNFTExample::GetRedHatAddress() const		{ return AnkrContractRegistry::GetItem("RedHat"); }
+FString UWearableNFTExample::GetWhiteHatAddress() const		{ return AnkrContractRegistry::GetItem("WhiteHat"); }
+FString UWearableNFTExample::GetBlueShoesAddress() const	{ return AnkrContractRegistry::GetItem("BlueShoes"); }
+FString UWearableNFTExample::GetRedShoesAddress() const		{ return AnkrContractRegistry::GetItem("RedShoes"); }
+FString UWearableNFTExample::GetWhiteShoesAddress() const	{ return AnkrContractRegistry::GetItem("WhiteShoes"); }
+FString UWearableNFTExample::GetBlueGlassesAddress() const	{ return AnkrContractRegistry::GetItem("BlueGlasses"); }
+FString UWearableNFTExample::GetRedGlassesAddress() const	{ return AnkrContractRegistry::GetItem("RedGlasses"); }
+FString UWearableNFTExample::GetWhiteGlassesAddress() const { return AnkrContractRegistry::GetItem("WhiteGlasses"); }
+
+void UWearableNFTExample::BeginDestroy()
+{
+	AnkrJournal::OnTicketResolved().RemoveAll(this);
+
+	Super::BeginDestroy();
 }
 
 // Init will save deviceId and session when the GetClient is called from MirageClient.cpp.
@@ -47,6 +65,8 @@ void UWearableNFTExample::SetAccount(FString _account, int _chainId)
 // Metamask will show popup to sign or confirm the transaction for that ticket.
 void UWearableNFTExample::MintItems(FString abi_hash, FString to, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -54,10 +74,13 @@ void UWearableNFTExample::MintItems(FString abi_hash, FString to, FAnkrCallCompl
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::MintItems, FAnkrUInt256(), { GetBlueHatAddress(), GetRedHatAddress(), GetBlueShoesAddress(), GetWhiteShoesAddress(), GetRedGlassesAddress(), GetWhiteGlassesAddress() });
+
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, context, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - MintItems - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -67,25 +90,32 @@ void UWearableNFTExample::MintItems(FString abi_hash, FString to, FAnkrCallCompl
 		{
 			FString ticket = JsonObject->GetStringField("ticket");
 			data = ticket;
+			AnkrJournal::RecordResponse(context.requestId, ticket);
 		}
 			
 		AnkrUtility::SetLastRequest("MintItems");
 		Result.ExecuteIfBound(content, data, "", -1, false);
 	});
 
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, abi_hash, to]()
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, context, abi_hash, to, Result]()
 	{
 		FString mintBatchMethodName = "mintBatch";
 
-		FString args = "[\"" + to + "\", [\"" + BlueHatAddress + "\", \"" + RedHatAddress + "\", \"" + BlueShoesAddress + "\", \"" + WhiteShoesAddress + "\", \"" + RedGlassesAddress + "\", \"" + WhiteGlassesAddress + "\"], [1, 2, 3, 4, 5, 6], \"0x\"]";
+		FString args = "[\"" + to + "\", [\"" + GetBlueHatAddress() + "\", \"" + GetRedHatAddress() + "\", \"" + GetBlueShoesAddress() + "\", \"" + GetWhiteShoesAddress() + "\", \"" + GetRedGlassesAddress() + "\", \"" + GetWhiteGlassesAddress() + "\"], [1, 2, 3, 4, 5, 6], \"0x\"]";
 		args = args.Replace(TEXT(" "), TEXT(""));
 
+		FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameItemContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + mintBatchMethodName + "\", \"args\": " + args + "}";
+		if (!AnkrJournal::RecordSubmit(context.requestId, "MintItems", body, context, Result))
+		{
+			return;
+		}
+
 		FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
 		Request->SetURL(url);
 		Request->SetVerb("POST");
 		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-		Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameItemContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + mintBatchMethodName + "\", \"args\": " + args + "}");
-		Request->ProcessRequest();
+		Request->SetContentAsString(body);
+		AnkrTransport::ProcessRequest(Request);
 
 #if PLATFORM_ANDROID
 		FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
@@ -97,6 +127,8 @@ void UWearableNFTExample::MintItems(FString abi_hash, FString to, FAnkrCallCompl
 // Metamask will show popup to sign or confirm the transaction for that ticket.
 void UWearableNFTExample::MintCharacter(FString abi_hash, FString to, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -104,10 +136,13 @@ void UWearableNFTExample::MintCharacter(FString abi_hash, FString to, FAnkrCallC
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::MintCharacter);
+
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, context, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - MintCharacter - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -117,22 +152,29 @@ void UWearableNFTExample::MintCharacter(FString abi_hash, FString to, FAnkrCallC
 		{
 			FString ticket = JsonObject->GetStringField("ticket");
 			data = ticket;
+			AnkrJournal::RecordResponse(context.requestId, ticket);
 		}
 			
 		AnkrUtility::SetLastRequest("MintCharacter");
 		Result.ExecuteIfBound(content, data, "", -1, false);
 	});
 
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, abi_hash, to]()
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, context, abi_hash, to, Result]()
 	{
 		FString safeMintMethodName = "safeMint";
 
+		FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameCharacterContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + safeMintMethodName + "\", \"args\": [\"" + to + "\"]}";
+		if (!AnkrJournal::RecordSubmit(context.requestId, "MintCharacter", body, context, Result))
+		{
+			return;
+		}
+
 		FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
 		Request->SetURL(url);
 		Request->SetVerb("POST");
 		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-		Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameCharacterContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + safeMintMethodName + "\", \"args\": [\"" + to + "\"]}");
-		Request->ProcessRequest();
+		Request->SetContentAsString(body);
+		AnkrTransport::ProcessRequest(Request);
 
 #if PLATFORM_ANDROID
 			FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
@@ -144,6 +186,8 @@ void UWearableNFTExample::MintCharacter(FString abi_hash, FString to, FAnkrCallC
 // Metamask will show popup to sign or confirm the transaction for that ticket.
 void UWearableNFTExample::GameItemSetApproval(FString abi_hash, FString callOperator, bool approved, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -151,10 +195,13 @@ void UWearableNFTExample::GameItemSetApproval(FString abi_hash, FString callOper
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::GameItemSetApproval);
+
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, context, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GameItemSetApproval - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -163,29 +210,35 @@ void UWearableNFTExample::GameItemSetApproval(FString abi_hash, FString callOper
 		if (FJsonSerializer::Deserialize(Reader, JsonObject))
 		{
 			bool result = JsonObject->GetBoolField("result");
+			FString ticket;
 			if (result)
 			{
-				FString ticket = JsonObject->GetStringField("ticket");
+				ticket = JsonObject->GetStringField("ticket");
 				data = ticket;
 			}
+			AnkrJournal::RecordResponse(context.requestId, ticket);
 		}
 			
 		AnkrUtility::SetLastRequest("GameItemSetApproval");
 		Result.ExecuteIfBound(content, data, "", -1, false);
 	});
 
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, abi_hash, callOperator, approved]()
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, context, abi_hash, callOperator, approved, Result]()
 	{
 		FString setApprovalForAllMethodName = "setApprovalForAll";
 
-		FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameItemContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + setApprovalForAllMethodName + "\", \"args\": [\"" + GameCharacterContractAddress + "\", true ]}";
+		FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameItemContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + setApprovalForAllMethodName + "\", \"args\": [\"" + GetGameCharacterContractAddress() + "\", true ]}";
+		if (!AnkrJournal::RecordSubmit(context.requestId, "GameItemSetApproval", body, context, Result))
+		{
+			return;
+		}
 			
 		FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
 		Request->SetURL(url);
 		Request->SetVerb("POST");
 		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 		Request->SetContentAsString(body);
-		Request->ProcessRequest();
+		AnkrTransport::ProcessRequest(Request);
 
 #if PLATFORM_ANDROID
 			FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
@@ -197,6 +250,8 @@ void UWearableNFTExample::GameItemSetApproval(FString abi_hash, FString callOper
 // The 'data' shows the number of tokens that the user holds.
 void UWearableNFTExample::GetCharacterBalance(FString abi_hash, FString address, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -204,10 +259,11 @@ void UWearableNFTExample::GetCharacterBalance(FString abi_hash, FString address,
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetCharacterBalance - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -227,8 +283,8 @@ void UWearableNFTExample::GetCharacterBalance(FString abi_hash, FString address,
 	Request->SetURL(url);
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameCharacterContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + balanceOfMethodName + "\", \"args\": [\"" + address + "\"]}");
-	Request->ProcessRequest();
+	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameCharacterContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + balanceOfMethodName + "\", \"args\": [\"" + address + "\"]}");
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // GetCharacterTokenId is used to get the token ids that the user holds.
@@ -241,6 +297,24 @@ void UWearableNFTExample::GetCharacterTokenId(FString abi_hash, int tokenBalance
 		return;
 	}
 
+	RequestCharacterTokenId(abi_hash, owner, index, Result);
+}
+
+void UWearableNFTExample::GetCharacterTokenIdValue(FString abi_hash, const FAnkrUInt256& tokenBalance, FString owner, const FAnkrUInt256& index, FAnkrCallCompleteDynamicDelegate Result)
+{
+	if (tokenBalance.IsZero())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetCharacterTokenIdValue - You don't own any of these tokens - tokenBalance: 0"));
+		return;
+	}
+
+	RequestCharacterTokenId(abi_hash, owner, index.ToDecimal(), Result);
+}
+
+void UWearableNFTExample::RequestCharacterTokenId(FString abi_hash, const FString& owner, const FString& index, FAnkrCallCompleteDynamicDelegate Result)
+{
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -248,10 +322,11 @@ void UWearableNFTExample::GetCharacterTokenId(FString abi_hash, int tokenBalance
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetCharacterTokenId - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -271,17 +346,19 @@ void UWearableNFTExample::GetCharacterTokenId(FString abi_hash, int tokenBalance
 	Request->SetURL(url);
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameCharacterContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + tokenOfOwnerByIndexMethodName + "\", \"args\": [\"" + owner + "\", \"" + index + "\"]}");
-	Request->ProcessRequest();
+	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameCharacterContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + tokenOfOwnerByIndexMethodName + "\", \"args\": [\"" + owner + "\", \"" + index + "\"]}");
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // ChangeHat is used to change the hat of a character.
 // Metamask will show popup to sign or confirm the transaction for that ticket.
-void UWearableNFTExample::ChangeHat(FString abi_hash, int characterId, bool hasHat, FString hatAddress, FAnkrCallCompleteDynamicDelegate Result)
+void UWearableNFTExample::ChangeHat(FString abi_hash, const FAnkrUInt256& characterId, bool hasHat, FString hatAddress, FAnkrCallCompleteDynamicDelegate Result)
 {
-	if (!hasHat || characterId == -1)
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
+	if (!hasHat)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - ChangeHat - CharacterID or HatID is null"));
+		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - ChangeHat - HatID is null"));
 		return;
 	}
 
@@ -292,38 +369,58 @@ void UWearableNFTExample::ChangeHat(FString abi_hash, int characterId, bool hasH
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this, hatAddress](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	const FAnkrRequestContext context = AnkrRequestContext::Make(EAnkrOperation::ChangeHat, characterId, { hatAddress });
+
+	if (OptimisticEquip)
+	{
+		PredictEquipment(context);
+	}
+
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, context, this, hatAddress](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - ChangeHat - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
 			
 		FString ticket = content;
+		bool hasTicket = false;
 		if (FJsonSerializer::Deserialize(Reader, JsonObject))
 		{
 			ticket = JsonObject->GetStringField("ticket");
+			hasTicket = !ticket.IsEmpty();
+			AnkrJournal::RecordResponse(context.requestId, ticket);
+		}
+
+		if (!hasTicket)
+		{
+			ResolveEquipment(context, false);
 		}
 			
-		if		(hatAddress.Equals(BlueHatAddress)) AnkrUtility::SetLastRequest("ChangeHatBlue");
-		else if (hatAddress.Equals(RedHatAddress))  AnkrUtility::SetLastRequest("ChangeHatRed");
+		if		(hatAddress.Equals(GetBlueHatAddress())) AnkrUtility::SetLastRequest("ChangeHatBlue");
+		else if (hatAddress.Equals(GetRedHatAddress()))  AnkrUtility::SetLastRequest("ChangeHatRed");
 			
 		Result.ExecuteIfBound(content, ticket, "", -1, false);
 	});
 
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, abi_hash, characterId, hasHat, hatAddress]()
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Request, context, abi_hash, characterId, hasHat, hatAddress, Result]()
 	{
 		FString changeHatMethodName = "changeHat";
 
-		FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameCharacterContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + changeHatMethodName + "\", \"args\": [\"" + FString::FromInt(characterId) + "\", \"" + hatAddress + "\"]}";
+		FString body = "{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameCharacterContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + changeHatMethodName + "\", \"args\": [\"" + characterId.ToDecimal() + "\", \"" + hatAddress + "\"]}";
+		if (!AnkrJournal::RecordSubmit(context.requestId, "ChangeHat", body, context, Result))
+		{
+			return;
+		}
 
 		FString url = AnkrUtility::GetUrl() + ENDPOINT_SEND_TRANSACTION;
 		Request->SetURL(url);
 		Request->SetVerb("POST");
 		Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 		Request->SetContentAsString(body);
-		Request->ProcessRequest();
+		AnkrTransport::ProcessRequest(Request);
 
 #if PLATFORM_ANDROID
 		FPlatformProcess::LaunchURL(session.GetCharArray().GetData(), NULL, NULL);
@@ -332,9 +429,11 @@ void UWearableNFTExample::ChangeHat(FString abi_hash, int characterId, bool hasH
 }
 
 // GetHat is used to get the hat of the user.
-// The 'data' shows the token address that the user has.
-void UWearableNFTExample::GetHat(FString abi_hash, int characterId, FAnkrCallCompleteDynamicDelegate Result)
+// The 'data' shows the token address that the user has, it is kept as the confirmed hat of the character.
+void UWearableNFTExample::GetHat(FString abi_hash, const FAnkrUInt256& characterId, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -342,10 +441,11 @@ void UWearableNFTExample::GetHat(FString abi_hash, int characterId, FAnkrCallCom
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, characterId, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetHat - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -354,6 +454,10 @@ void UWearableNFTExample::GetHat(FString abi_hash, int characterId, FAnkrCallCom
 		if (FJsonSerializer::Deserialize(Reader, JsonObject))
 		{
 			data = JsonObject->GetStringField("data");
+
+			FEquipmentInfoStructure& confirmed = ConfirmedEquipment.FindOrAdd(characterId);
+			confirmed.characterId = characterId;
+			confirmed.hat		  = data;
 		}
 			
 		Result.ExecuteIfBound(content, data, "", -1, false);
@@ -365,8 +469,13 @@ void UWearableNFTExample::GetHat(FString abi_hash, int characterId, FAnkrCallCom
 	Request->SetURL(url);
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameCharacterContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + getHatMethodName + "\", \"args\": [\"" + FString::FromInt(characterId) + "\"]}");
-	Request->ProcessRequest();
+	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameCharacterContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + getHatMethodName + "\", \"args\": [\"" + characterId.ToDecimal() + "\"]}");
+	AnkrTransport::ProcessRequest(Request);
+}
+
+void UWearableNFTExample::GetHatValue(FString abi_hash, const FAnkrUInt256& characterId, FAnkrCallCompleteDynamicDelegate Result)
+{
+	GetHat(abi_hash, characterId, Result);
 }
 
 // GetTicketResult is used to get the result of a ticket.
@@ -374,26 +483,53 @@ void UWearableNFTExample::GetHat(FString abi_hash, int characterId, FAnkrCallCom
 // The 'code' shows a code number related to a specific failure or success.
 void UWearableNFTExample::GetTicketResult(FString ticketId, FAnkrCallCompleteDynamicDelegate Result)
 {
+	RequestTicketResult(ticketId, [Result](FString content, FString data, FAnkrRequestContext context, int code, FString status)
+	{
+		Result.ExecuteIfBound(content, data, "", code, false);
+	});
+}
+
+// GetTicketResultWithContext is used to get the result of a ticket together with the context of the operation that produced it.
+void UWearableNFTExample::GetTicketResultWithContext(FString ticketId, FAnkrTicketResultDynamicDelegate Result)
+{
+	RequestTicketResult(ticketId, [Result](FString content, FString data, FAnkrRequestContext context, int code, FString status)
+	{
+		Result.ExecuteIfBound(content, data, context, code);
+	});
+}
+
+// RequestTicketResult interprets the result of a ticket according to the operation that produced it.
+void UWearableNFTExample::RequestTicketResult(FString ticketId, TFunction<void(FString, FString, FAnkrRequestContext, int, FString)> Callback)
+{
+	http = &FHttpModule::Get();
+
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = http->CreateRequest();
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, ticketId, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([Callback, ticketId, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetTicketResult - GetContentAsString: %s"), *content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
+
+		FAnkrRequestContext context;
+		AnkrRequestContext::Find(ticketId, context);
 			
 		FString data = content;
 		int code = 0;
+		bool resolved = false;
+		FString ticketStatus;
 		if (FJsonSerializer::Deserialize(Reader, JsonObject))
 		{
 			code = 1;
 
-			if (AnkrUtility::GetLastRequest().Equals("ChangeHatBlue") || AnkrUtility::GetLastRequest().Equals("ChangeHatRed"))
+			resolved = AnkrJournal::ResolveTicket(ticketId, JsonObject, ticketStatus);
+
+			if (IsEquipmentOperation(context.operation))
 			{
 				bool result					   = JsonObject->GetBoolField("result");
 				TSharedPtr<FJsonObject> object = JsonObject->GetObjectField("data");
@@ -408,7 +544,13 @@ void UWearableNFTExample::GetTicketResult(FString ticketId, FAnkrCallCompleteDyn
 			}
 		}
 
-		Result.ExecuteIfBound(content, data, "", code, false);
+		Callback(content, data, context, code, ticketStatus);
+
+		// The context is kept until the final result has been handed to the caller.
+		if (resolved)
+		{
+			AnkrRequestContext::Release(ticketId);
+		}
 	});
 
 	FString url = AnkrUtility::GetUrl() + ENDPOINT_RESULT;
@@ -416,12 +558,128 @@ void UWearableNFTExample::GetTicketResult(FString ticketId, FAnkrCallCompleteDyn
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
 	Request->SetContentAsString("{\"ticket\": \"" + ticketId + "\" }");
-	Request->ProcessRequest();
+	AnkrTransport::ProcessRequest(Request);
+}
+
+// GetEquipment returns the confirmed equipment with the pending predictions applied on top of it.
+FEquipmentInfoStructure UWearableNFTExample::GetEquipment(const FAnkrUInt256& characterId)
+{
+	FEquipmentInfoStructure equipment{};
+	if (const FEquipmentInfoStructure* confirmed = ConfirmedEquipment.Find(characterId))
+	{
+		equipment = *confirmed;
+	}
+	equipment.characterId = characterId;
+
+	if (const FEquipmentInfoStructure* predicted = PredictedEquipment.Find(characterId))
+	{
+		if (!predicted->hat.IsEmpty())		equipment.hat	  = predicted->hat;
+		if (!predicted->shoes.IsEmpty())	equipment.shoes	  = predicted->shoes;
+		if (!predicted->glasses.IsEmpty())	equipment.glasses = predicted->glasses;
+	}
+
+	return equipment;
+}
+
+bool UWearableNFTExample::IsEquipmentPending(const FAnkrUInt256& characterId)
+{
+	return PredictedEquipment.Contains(characterId);
+}
+
+// PredictEquipment publishes the equipment expected once the change described by the context is mined.
+// Only the latest change of a slot is kept, so an older ticket resolving later can't override a newer prediction.
+void UWearableNFTExample::PredictEquipment(const FAnkrRequestContext& context)
+{
+	if (context.itemIds.Num() <= 0)
+	{
+		return;
+	}
+
+	FEquipmentInfoStructure& predicted = PredictedEquipment.FindOrAdd(context.characterId);
+	predicted.characterId = context.characterId;
+
+	FString* slot = GetEquipmentSlot(predicted, context.operation);
+	if (slot == nullptr)
+	{
+		return;
+	}
+	*slot = context.itemIds[0];
+
+	onEquipmentChanged.Broadcast(GetEquipment(context.characterId), EEquipmentChangeType::Predicted);
+}
+
+// ResolveEquipment confirms the change when its ticket succeeded, otherwise the prediction of that change is removed.
+void UWearableNFTExample::ResolveEquipment(const FAnkrRequestContext& context, bool success)
+{
+	if (context.itemIds.Num() <= 0)
+	{
+		return;
+	}
+
+	if (!IsEquipmentOperation(context.operation))
+	{
+		return;
+	}
+
+	const FString& item = context.itemIds[0];
+
+	bool wasPredicted = false;
+	if (FEquipmentInfoStructure* predicted = PredictedEquipment.Find(context.characterId))
+	{
+		FString* slot = GetEquipmentSlot(*predicted, context.operation);
+		if (slot->Equals(item))
+		{
+			slot->Empty();
+			wasPredicted = true;
+		}
+
+		if (predicted->hat.IsEmpty() && predicted->shoes.IsEmpty() && predicted->glasses.IsEmpty())
+		{
+			PredictedEquipment.Remove(context.characterId);
+		}
+	}
+
+	if (success)
+	{
+		FEquipmentInfoStructure& confirmed = ConfirmedEquipment.FindOrAdd(context.characterId);
+		confirmed.characterId = context.characterId;
+		*GetEquipmentSlot(confirmed, context.operation) = item;
+
+		onEquipmentChanged.Broadcast(GetEquipment(context.characterId), EEquipmentChangeType::Confirmed);
+	}
+	else if (wasPredicted)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - ResolveEquipment - The change of character %s to %s failed, it is rolled back."), *context.characterId.ToDecimal(), *item);
+		onEquipmentChanged.Broadcast(GetEquipment(context.characterId), EEquipmentChangeType::RolledBack);
+	}
+}
+
+// OnTicketResolved resolves the equipment of every ticket that reaches a final status, whichever poll received it.
+void UWearableNFTExample::OnTicketResolved(FString ticket, FAnkrRequestContext context, bool success)
+{
+	ResolveEquipment(context, success);
+}
+
+FString* UWearableNFTExample::GetEquipmentSlot(FEquipmentInfoStructure& equipment, EAnkrOperation operation)
+{
+	switch (operation)
+	{
+		case EAnkrOperation::ChangeHat: return &equipment.hat;
+		default:						return nullptr;
+	}
+}
+
+bool UWearableNFTExample::IsEquipmentOperation(EAnkrOperation operation)
+{
+	FEquipmentInfoStructure probe{};
+	return GetEquipmentSlot(probe, operation) != nullptr;
 }
 
 // GetItemsBalance is used to get the item balances that the user has.
 void UWearableNFTExample::GetItemsBalance(FString abi_hash, FString address, FAnkrCallCompleteDynamicDelegate Result)
 {
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -429,10 +687,11 @@ void UWearableNFTExample::GetItemsBalance(FString abi_hash, FString address, FAn
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 	{
 		const FString content = Response->GetContentAsString();
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetItemsBalance - GetContentAsString: %s"), *content);
+		AnkrAbiCache::Validate(abi_hash, content);
 
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -442,6 +701,7 @@ void UWearableNFTExample::GetItemsBalance(FString abi_hash, FString address, FAn
 		{
 			data = JsonObject->GetStringField("data");
 			UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetItemsBalance - Balance: %s"), *data);
+			DecodeBalances(data);
 		}
 			
 		Result.ExecuteIfBound(content, data, "", -1, false);
@@ -449,39 +709,121 @@ void UWearableNFTExample::GetItemsBalance(FString abi_hash, FString address, FAn
 
 	FString balanceOfBatchMethodName = "balanceOfBatch";
 
-	FString args = "[ [\"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\"], [\"" + BlueHatAddress + "\", \"" + RedHatAddress + "\", \"" + WhiteHatAddress + "\", \"" + BlueShoesAddress + "\", \"" + RedShoesAddress + "\", \"" + WhiteShoesAddress + "\", \"" + BlueGlassesAddress + "\", \"" + RedGlassesAddress + "\", \"" + WhiteGlassesAddress + "\"]]";
+	FString args = "[ [\"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\", \"" + activeAccount + "\"], [\"" + GetBlueHatAddress() + "\", \"" + GetRedHatAddress() + "\", \"" + GetWhiteHatAddress() + "\", \"" + GetBlueShoesAddress() + "\", \"" + GetRedShoesAddress() + "\", \"" + GetWhiteShoesAddress() + "\", \"" + GetBlueGlassesAddress() + "\", \"" + GetRedGlassesAddress() + "\", \"" + GetWhiteGlassesAddress() + "\"]]";
 	
 	FString url = AnkrUtility::GetUrl() + ENDPOINT_CALL_METHOD;
 	Request->SetURL(url);
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameItemContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + balanceOfBatchMethodName + "\", \"args\": " + args + "}");
-	Request->ProcessRequest();
+	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameItemContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + balanceOfBatchMethodName + "\", \"args\": " + args + "}");
+	AnkrTransport::ProcessRequest(Request);
 }
 
 // GetItemValueFromBalances is used to get the balance value for a token inside the balance array that is returned from GetItemsBalance.
-int UWearableNFTExample::GetItemValueFromBalances(FString data, int index)
+int UWearableNFTExample::GetItemValueFromBalances(const FString& data, int index)
 {
-	TArray<FString> tokens;
-	FString seperator(",");
-	data.ParseIntoArray(tokens, *seperator, true);
-	int numberOfTokens = tokens.Num();
+	if (!data.Equals(BalancesData, ESearchCase::CaseSensitive))
+	{
+		DecodeBalances(data);
+	}
 
+	const int numberOfTokens = Balances.Num();
 	if (numberOfTokens <= 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetItemValueFromBalances - numberOfTokens: %d"), numberOfTokens);
 		return -1;
 	}
 
-	if (index > numberOfTokens - 1) index = numberOfTokens - 1;
-	else if (index < -1) index = 0;
+	return Balances[FMath::Clamp(index, 0, numberOfTokens - 1)];
+}
 
+TArray<int> UWearableNFTExample::GetItemBalances() const
+{
+	return Balances;
+}
+
+FAnkrUInt256 UWearableNFTExample::GetItemBalanceValue(int index) const
+{
+	return BalanceValues.Num() > 0 ? BalanceValues[FMath::Clamp(index, 0, BalanceValues.Num() - 1)] : FAnkrUInt256();
+}
+
+// DecodeBalances decodes the balances in a single pass and keeps them with the data they came from.
+// Hex data is decoded as the uint256[] output of balanceOfBatch, any other data as numbers separated by commas.
+void UWearableNFTExample::DecodeBalances(const FString& data)
+{
+	BalancesData = data;
+	Balances.Reset();
+	BalanceValues.Reset();
+
+	const FString trimmed = data.TrimStartAndEnd();
+	if (trimmed.StartsWith("0x", ESearchCase::IgnoreCase))
+	{
+		FAnkrContractPtr contract = AnkrContractRegistry::Find(CONTRACT_GAME_ITEM);
+		const TArray<FAnkrAbiMethod>* methods = contract.IsValid() ? contract->FindMethods("balanceOfBatch") : nullptr;
+
+		TArray<FAnkrAbiValue> values;
+		FString error;
+		if (methods == nullptr || !AnkrAbi::DecodeOutputs((*methods)[0], trimmed, values, error) || values.Num() != 1)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - DecodeBalances - %s"), *error);
+			return;
+		}
+
+		BalanceValues.Reserve(values[0].items.Num());
+		for (const FAnkrAbiValue& balance : values[0].items)
+		{
+			BalanceValues.Add(balance.GetUInt256());
+		}
+	}
+	else
+	{
+		// Brackets, quotes and spaces around a balance are skipped, a token without digits counts as 0 like Atoi.
+		FAnkrUInt256 value;
+		bool hasToken	= false;
+		bool isOverflow = false;
+		for (TCHAR character : trimmed)
+		{
+			if (character == ',')
+			{
+				if (hasToken) BalanceValues.Add(isOverflow ? FAnkrUInt256() - FAnkrUInt256(1) : value);
+				value	   = FAnkrUInt256();
+				hasToken   = false;
+				isOverflow = false;
+			}
+			else if (FChar::IsDigit(character))
+			{
+				isOverflow |= value.MultiplyAdd(10, character - '0') != 0;
+				hasToken	= true;
+			}
+			else if (character != '[' && character != ']' && character != '"' && !FChar::IsWhitespace(character))
+			{
+				hasToken = true;
+			}
+		}
+		if (hasToken) BalanceValues.Add(isOverflow ? FAnkrUInt256() - FAnkrUInt256(1) : value);
+	}
 
-	return FCString::Atoi(*tokens[index]);
+	Balances.Reserve(BalanceValues.Num());
+	for (const FAnkrUInt256& balance : BalanceValues)
+	{
+		Balances.Add(balance.FitsUint64() ? (int)FMath::Min<uint64>(balance.limbs[0], MAX_int32) : MAX_int32);
+	}
 }
 
 void UWearableNFTExample::GetTokenURI(FString abi_hash, int tokenId, FAnkrCallCompleteDynamicDelegate Result)
 {
+	RequestTokenURI(abi_hash, FString::FromInt(tokenId), Result);
+}
+
+void UWearableNFTExample::GetTokenURIValue(FString abi_hash, const FAnkrUInt256& tokenId, FAnkrCallCompleteDynamicDelegate Result)
+{
+	RequestTokenURI(abi_hash, tokenId.ToDecimal(), Result);
+}
+
+void UWearableNFTExample::RequestTokenURI(FString abi_hash, const FString& tokenId, FAnkrCallCompleteDynamicDelegate Result)
+{
+	abi_hash = AnkrAbiCache::Resolve(abi_hash);
+
 	http = &FHttpModule::Get();
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
@@ -489,10 +831,11 @@ void UWearableNFTExample::GetTokenURI(FString abi_hash, int tokenId, FAnkrCallCo
 #else
 	TSharedRef<IHttpRequest> Request = http->CreateRequest();
 #endif
-	Request->OnProcessRequestComplete().BindLambda([Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+	Request->OnProcessRequestComplete().BindLambda([abi_hash, Result, this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 		{
 			const FString content = Response->GetContentAsString();
 			UE_LOG(LogTemp, Warning, TEXT("WearableNFTExample - GetCharacterTokenId - GetContentAsString: %s"), *content);
+			AnkrAbiCache::Validate(abi_hash, content);
 
 			TSharedPtr<FJsonObject> JsonObject;
 			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(content);
@@ -512,6 +855,6 @@ void UWearableNFTExample::GetTokenURI(FString abi_hash, int tokenId, FAnkrCallCo
 	Request->SetURL(url);
 	Request->SetVerb("POST");
 	Request->SetHeader(CONTENT_TYPE_KEY, CONTENT_TYPE_VALUE);
-	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GameCharacterContractAddress + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + tokenURI + "\", \"args\": \"" + FString::FromInt(tokenId) + "\"}");
-	Request->ProcessRequest();
+	Request->SetContentAsString("{\"device_id\": \"" + deviceId + "\", \"contract_address\": \"" + GetGameCharacterContractAddress() + "\", \"abi_hash\": \"" + abi_hash + "\", \"method\": \"" + tokenURI + "\", \"args\": \"" + tokenId + "\"}");
+	AnkrTransport::ProcessRequest(Request);
 }
\ No newline at end of file
@@ -11,94 +11,148 @@ void LibraryManager::Load()
 
 void LibraryManager::Unload()
 {
+    std::lock_guard<std::mutex> lock(loadLock);
+    isLoaded     = false;
+    isLoadFailed = false;
 }
 
 void LibraryManager::Initialize(bool _isDevelopment, FString _device_id)
 {
     [ankrClient InitializeWith_isDevelopment:_isDevelopment _device_id:FStringToNSString(*_device_id)];
 }
-void LibraryManager::Ping()
+void LibraryManager::Ping(int _callIndex)
 {
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
     [ankrClient PingWithFunction:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::ConnectWallet(FString _content)
+void LibraryManager::ConnectWallet(int _callIndex, const std::string& _content)
 {
-    [ankrClient ConnectWalletWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient ConnectWalletWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::GetWallet(FString _content)
+void LibraryManager::GetWallet(int _callIndex, const std::string& _content)
 {
-    [ankrClient GetWalletWith_content : FStringToNSString(_content) function : ^ (BOOL _success, NSString * _sender, NSString * _data)
+    if (FailIfUnavailable(_callIndex))
     {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        return;
+    }
 
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+    [ankrClient GetWalletWith_content : UTF8ToNSString(_content) function : ^ (BOOL _success, NSString * _sender, NSString * _data)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
+
+        FlushCall(_callIndex, _success, [_data UTF8String]);
     }] ;
 }
-void LibraryManager::SendABI(FString _content)
+void LibraryManager::SendABI(int _callIndex, const std::string& _content)
 {
-    [ankrClient SendABIWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient SendABIWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::SendTransaction(FString _content)
+void LibraryManager::SendTransaction(int _callIndex, const std::string& _content)
 {
-    [ankrClient SendTransactionWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient SendTransactionWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::CallMethod(FString _content)
+void LibraryManager::CallMethod(int _callIndex, const std::string& _content)
 {
-    [ankrClient CallMethodWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient CallMethodWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::SignMessage(FString _content)
+void LibraryManager::SignMessage(int _callIndex, const std::string& _content)
 {
-    [ankrClient SignMessageWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient SignMessageWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::GetResult(FString _content)
+void LibraryManager::GetResult(int _callIndex, const std::string& _content)
 {
-    [ankrClient GetResultWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient GetResultWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
-void LibraryManager::VerifyMessage(FString _content)
+void LibraryManager::VerifyMessage(int _callIndex, const std::string& _content)
 {
-    [ankrClient VerifyMessageWith_content:FStringToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
+    if (FailIfUnavailable(_callIndex))
+    {
+        return;
+    }
+
+    [ankrClient VerifyMessageWith_content:UTF8ToNSString(_content) function:^(BOOL _success, NSString* _sender, NSString* _data)
      {
-        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d | _data: %s"), *NSStringToFString(_sender), _success, *NSStringToFString(_data));
+        UE_LOG(LogTemp, Warning, TEXT("ObjC - LibraryManager - %s - _success: %d"), *NSStringToFString(_sender), _success);
         
-        FlushCall([_sender UTF8String], _success, [_data UTF8String]);
+        FlushCall(_callIndex, _success, [_data UTF8String]);
      }];
 }
 
+// SubmitEach sends the requests one by one, the framework has no batch entry point.
+void LibraryManager::SubmitEach(const std::vector<AnkrNativeRequest>& _requests)
+{
+    AnkrSubmitEach(*this, _requests);
+}
+
 std::wstring LibraryManager::GetWString(FString input)
 {
     std::string raw = std::string(TCHAR_TO_UTF8(*input));
@@ -127,6 +181,12 @@ NSString* LibraryManager::FStringToNSString(FString _input)
     NSString* conversion = [[NSString alloc] initWithUTF8String:source.c_str()];
     return conversion;
 }
+// UTF8ToNSString wraps the UTF-8 bytes of the content without going through an FString.
+NSString* LibraryManager::UTF8ToNSString(const std::string& _input)
+{
+    NSString* conversion = [[NSString alloc] initWithBytes:_input.data() length:_input.size() encoding:NSUTF8StringEncoding];
+    return conversion;
+}
 FString LibraryManager::NSStringToFString(NSString* _input)
 {
     FString conversion([_input UTF8String]);
@@ -138,46 +198,17 @@ void LibraryManager::Log(FString _message)
     UE_LOG(LogTemp, Warning, TEXT("%s"), *_message);
 }
 
-int LibraryManager::GetGlobalCallIndex()
-{
-    GlobalCallIndex++; if (GlobalCallIndex > INT_MAX) GlobalCallIndex = 0;
-    return GlobalCallIndex;
-}
-bool LibraryManager::AddCall(const char* _sender, const FAnkrCallCompleteDynamicDelegate _callComplete)
+// EnsureLoaded loads the library on first use instead of at startup, it can be called from any thread and only the first call does the work.
+bool LibraryManager::EnsureLoaded()
 {
-    std::string caller = std::string(_sender);
-    
-    if (CallList.count(caller) > 0)
+    std::lock_guard<std::mutex> lock(loadLock);
+    if (!isLoaded && !isLoadFailed)
     {
-        //UE_LOG(LogTemp, Warning, TEXT("LibraryManager - AddCall - %s call is already in the call list, can not add again."), *FString(caller.c_str()));
-        return false;
-    }
-
-    FAnkrCallStruct call{};
-    call.callIndex = LibraryManager::GetGlobalCallIndex();
-    call.sender = FString(_sender);
-    call.CallComplete = _callComplete;
-    CallList[caller] = call;
-
-    //UE_LOG(LogTemp, Warning, TEXT("LibraryManager - AddCall - %s call is added to the call list successfully."), *call.sender);
-    return true;
-}
+        Load();
 
-void LibraryManager::FlushCall(const char* _sender, bool _success, const char* _data)
-{
-    std::string caller = std::string(_sender);
-
-    if (CallList.count(caller) <= 0)
-    {
-        //UE_LOG(LogTemp, Warning, TEXT("LibraryManager - FlushCall - %s call doesn't exist in the call list."), *FString(caller.c_str()));
-        return;
+        // A failed load is recorded instead of being retried by every call, Unload clears it so the library can be loaded again.
+        isLoaded     = ankrClient != nullptr;
+        isLoadFailed = !isLoaded;
     }
-
-    FAnkrCallStruct call = CallList[caller];
-    call.success = _success;
-    call.data = FString(_data);
-    CallQueue.push(call);
-    CallList.erase(caller);
-
-    //UE_LOG(LogTemp, Warning, TEXT("LibraryManager - FlushCall - %s call is pushed to queue successfully."), *call.sender);
+    return isLoaded;
 }
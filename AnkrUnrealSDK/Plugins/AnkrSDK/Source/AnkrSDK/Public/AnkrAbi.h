@@ -0,0 +1,156 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "AnkrContractRegistry.h"
+#include "AnkrUInt256.h"
+
+/// The encodings of the ABI, a word is a static 32 byte value, bytes and strings are dynamic, an array has a length and a tuple does not, fixed size arrays are tuples.
+enum class EAnkrAbiKind : uint8
+{
+	Word,
+	Bytes,
+	Array,
+	Tuple
+};
+
+/// FAnkrAbiValue is a typed argument of a contract call, it is encoded to calldata without going through a string.
+///
+/// Integers, addresses, booleans and bytes<N> are words in big endian order, e.g. FAnkrAbiValue::Uint(42) or FAnkrAbiValue::Address(bytes).\n
+/// Arrays and tuples hold their items, e.g. FAnkrAbiValue::Array({ FAnkrAbiValue::Uint(1), FAnkrAbiValue::Uint(2) }) for a uint256[].
+struct ANKRSDK_API FAnkrAbiValue
+{
+	EAnkrAbiKind kind = EAnkrAbiKind::Word;
+	uint8 word[32]	  = {};
+	TArray<uint8> data;
+	TArray<FAnkrAbiValue> items;
+
+	static FAnkrAbiValue Uint(uint64 _value);
+	static FAnkrAbiValue Int(int64 _value);
+
+	/// A uint256 or int256 given as 32 bytes in big endian order.
+	static FAnkrAbiValue Word(const uint8* _bigEndian);
+	static FAnkrAbiValue UInt256(const FAnkrUInt256& _value);
+
+	static FAnkrAbiValue Bool(bool _value);
+
+	/// An address given as its 20 bytes.
+	static FAnkrAbiValue Address(const uint8* _address);
+
+	/// A bytes<N> value, the bytes are aligned to the left of the word.
+	static FAnkrAbiValue FixedBytes(const uint8* _bytes, int32 _length);
+
+	static FAnkrAbiValue Bytes(const uint8* _bytes, int32 _length);
+	static FAnkrAbiValue Bytes(TArray<uint8> _bytes);
+
+	/// A string, it is encoded as its UTF-8 bytes.
+	static FAnkrAbiValue String(const FString& _text);
+
+	/// A dynamic array, e.g. uint256[].
+	static FAnkrAbiValue Array(TArray<FAnkrAbiValue> _items);
+
+	/// A tuple or a fixed size array, e.g. (uint256,address) or address[3].
+	static FAnkrAbiValue Tuple(TArray<FAnkrAbiValue> _items);
+
+	/// Whether the value is encoded in the tail with an offset in the head.
+	bool IsDynamic() const;
+
+	/// The size of the value in the head, 32 bytes for dynamic values.
+	int32 GetHeadSize() const;
+
+	/// The size of the whole encoding of the value.
+	int32 GetEncodedSize() const;
+
+	/// Whether a word fits in 64 bits, i.e. its first 24 bytes are zero.
+	bool FitsUint64() const;
+
+	/// The low 64 bits of a word.
+	uint64 GetUint64() const;
+
+	/// The low 64 bits of a word as a signed number, e.g. an int64 or a smaller intN.
+	int64 GetInt64() const;
+
+	bool GetBool() const;
+
+	/// The address of a word in lowercase hex with 0x.
+	FString GetAddress() const;
+
+	/// A word as an unsigned decimal number.
+	FString GetDecimal() const;
+
+	FAnkrUInt256 GetUInt256() const;
+
+	/// The UTF-8 bytes of a string.
+	FString GetString() const;
+};
+
+/// AnkrAbi checks the arguments of contract methods against their ABI types before they are sent and encodes them.
+///
+/// Arguments are given as a json array, e.g. ["1", "0xD0eF...", true], or separated by commas, e.g. 1, 0xD0eF..., true.\n
+/// Supported types are uint<N>, int<N>, address, bool, bytes<N>, bytes, string, arrays of those with [] or [k] and tuples written as (type,type).\n
+/// The throughput of EncodeCall is logged by the console command Ankr.AbiBenchmark [count] [accounts], the calldata is checked by the AnkrSDK.Abi automation tests.
+class ANKRSDK_API AnkrAbi
+{
+
+public:
+
+	/// Splits arguments into json values, a value separated by commas that starts with '[' is read as a json array.
+	///
+	/// @returns Whether the arguments could be read.
+	static bool ParseArguments(const FString& _args, TArray<TSharedPtr<FJsonValue>>& _values, bool& _isJsonArray);
+
+	/// Writes arguments as a condensed json array, values separated by commas can't be written back without losing their quotes.
+	static FString WriteArguments(const TArray<TSharedPtr<FJsonValue>>& _values);
+
+	/// Checks a value against an ABI type.
+	///
+	/// Numbers are written in decimal or in hex with 0x, they are normalized without a sign or leading zeros, hex is written in lowercase and booleans as true or false.
+	///
+	/// @returns Whether the value fits the type, the error describes why it does not.
+	static bool ValidateValue(const FString& _type, const TSharedPtr<FJsonValue>& _value, TSharedPtr<FJsonValue>& _normalized, FString& _error);
+
+	/// Checks the arguments of a call against the inputs of a method.
+	///
+	/// @returns Whether the arguments fit the method, the normalized arguments are written as a json array whatever form the arguments were given in.
+	static bool ValidateArguments(const FAnkrAbiMethod& _method, const FString& _args, FString& _normalizedArgs, FString& _error);
+
+	/// Splits the canonical type of a tuple, e.g. "(uint256,address)", into its component types.
+	static TArray<FString> SplitTupleType(const FString& _type);
+
+	/// Gets the element type and the length of an array type, the length is -1 for a dynamic array.
+	///
+	/// @returns Whether the type is an array.
+	static bool GetArrayType(const FString& _type, FString& _elementType, int32& _length);
+
+	/// Appends the encoding of values as the arguments of a call, i.e. as one tuple.
+	static void Encode(const TArray<FAnkrAbiValue>& _values, TArray<uint8>& _out);
+
+	/// Builds the calldata of a call, the 4 byte selector followed by the encoded arguments.
+	static void EncodeCall(uint32 _selector, const TArray<FAnkrAbiValue>& _values, TArray<uint8>& _calldata);
+
+	/// Converts a json value to a typed value of an ABI type, the value is validated like ValidateValue.
+	static bool ToAbiValue(const FString& _type, const TSharedPtr<FJsonValue>& _value, FAnkrAbiValue& _abiValue, FString& _error);
+
+	/// Builds the calldata of a call from arguments given as a json array or separated by commas.
+	///
+	/// @returns Whether the arguments fit the method, the error describes why they do not.
+	static bool EncodeArguments(const FAnkrAbiMethod& _method, const FString& _args, TArray<uint8>& _calldata, FString& _error);
+
+	/// Decodes values of ABI types, e.g. the outputs of a call, every offset and length is checked against the data.
+	///
+	/// @returns Whether the data holds the types, the error describes why it does not.
+	static bool Decode(const TArray<FString>& _types, const uint8* _data, int32 _length, TArray<FAnkrAbiValue>& _values, FString& _error);
+
+	/// Decodes the outputs of a method from the hex data returned by a call.
+	static bool DecodeOutputs(const FAnkrAbiMethod& _method, const FString& _hex, TArray<FAnkrAbiValue>& _values, FString& _error);
+
+	/// Converts a decoded value to json, integers are written as decimal strings since they may not fit in a double.
+	static TSharedPtr<FJsonValue> ToJsonValue(const FString& _type, const FAnkrAbiValue& _value);
+
+	/// Writes bytes in lowercase hex with 0x.
+	static FString ToHex(const uint8* _bytes, int32 _length);
+	static FString ToHex(const TArray<uint8>& _bytes);
+
+	/// Reads hex with or without 0x, the number of digits must be even.
+	static bool FromHex(const FString& _hex, TArray<uint8>& _bytes);
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <JsonObjectConverter.h>
+#include "AnkrAbiCache.generated.h"
+
+/// FAnkrAbiCacheEntry is a single line of the ABI hash cache, an empty abi_hash removes the digest from the cache.
+USTRUCT(BlueprintType)
+struct FAnkrAbiCacheEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString digest;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString abi_hash;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int64 timestamp;
+
+	static FString ToJson(FAnkrAbiCacheEntry _item)
+	{
+		FString json;
+		FJsonObjectConverter::UStructToJsonObjectString(_item, json, 0, 0, 0, nullptr, false);
+		return json;
+	}
+
+	static FAnkrAbiCacheEntry FromJson(FString json)
+	{
+		FAnkrAbiCacheEntry object{};
+		FJsonObjectConverter::JsonObjectStringToUStruct(json, &object, 0, 0);
+		return object;
+	}
+};
+
+/// AnkrAbiCache remembers the abi_hash the Ankr API returned for an ABI so the ABI is uploaded once instead of once per session.
+///
+/// The cache maps a digest of the ABI content and of the API url to the abi_hash and is kept in Saved/AnkrSDK/AbiHashCache.log, one json line per change.\n
+/// A cached hash is trusted until the Ankr API rejects it, the first response for a hash in a session validates it and a rejection removes it from the cache.\n
+/// With Ankr.LocalAbiHash set the abi_hash of an unknown ABI is computed locally instead of being uploaded, the ABI is only registered when the Ankr API rejects that hash.
+class ANKRSDK_API AnkrAbiCache
+{
+
+public:
+
+	/// Writes the ABI json without whitespace and with the keys of every object sorted, an ABI that is not valid json is returned unchanged.
+	static FString Canonicalize(const FString& _abi);
+
+	/// The abi_hash of an ABI computed locally, the MD5 of the canonical ABI as UTF-8 in lowercase hex.
+	static FString ComputeHash(const FString& _abi);
+
+	/// Whether SendABI computes the abi_hash locally instead of uploading the ABI, it is set with the console variable Ankr.LocalAbiHash.
+	static bool IsLocalHashing();
+	static void SetLocalHashing(bool _enabled);
+
+	/// Keeps the ABI of a hash that was computed locally for the session, so the ABI can be registered if the Ankr API does not know the hash.
+	static void RememberLocalHash(const FString& _abiHash, const FString& _abi);
+
+	/// Looks for the ABI of a hash that was computed locally and has not been replaced yet.
+	static bool FindLocalAbi(const FString& _abiHash, FString& _abi);
+
+	/// Removes the ABI of a hash that was computed locally and hands it over to the caller, an ABI is registered once per session.
+	static bool TakeLocalAbi(const FString& _abiHash, FString& _abi);
+
+	/// Replaces a local hash the Ankr API rejected with the abi_hash it returned when the ABI was registered.
+	static void SetAlias(const FString& _localHash, const FString& _abiHash);
+
+	/// Gets the abi_hash to send for a hash, a replaced local hash gives the hash of the Ankr API.
+	static FString Resolve(const FString& _abiHash);
+
+	/// The digest of an ABI for the API in use, the abi_hash of a different API is never returned.
+	static FString GetDigest(const FString& _abi);
+
+	/// Looks for the abi_hash of an ABI.
+	///
+	/// @returns Whether the ABI is in the cache.
+	static bool Find(const FString& _abi, FString& _abiHash);
+
+	/// Stores the abi_hash the Ankr API returned for an ABI.
+	static void Store(const FString& _abi, const FString& _abiHash);
+
+	/// Checks the response of a request that used a cached abi_hash, a hash the Ankr API does not know is removed from the cache.
+	///
+	/// @returns Whether the response rejected the abi_hash.
+	static bool Validate(const FString& _abiHash, const FString& _content);
+
+	/// Removes an abi_hash from the cache.
+	static void Invalidate(const FString& _abiHash);
+
+	static FString GetCachePath();
+
+	/// Drops the hashes kept in memory and loads the cache from disk as a new session would, e.g. in the AnkrSDK.AbiCache tests.
+	static void Reload();
+
+private:
+
+	static void Load();
+	static void Append(const FAnkrAbiCacheEntry& _entry);
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Engine/UserDefinedStruct.h"
+#include "AnkrCallDispatcher.generated.h"
+
+#define ANKR_WITH_NATIVE_LIBRARY (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_IOS || PLATFORM_ANDROID || PLATFORM_LINUX)
+
+// The platforms whose LibraryManager can hand several requests to the native library in one call, the others submit them with SubmitEach.
+#define ANKR_WITH_NATIVE_BATCH (PLATFORM_WINDOWS || PLATFORM_LINUX)
+
+/// FAnkrCallDispatchStats describes how the completions of native calls are dispatched on the game thread.
+USTRUCT(BlueprintType)
+struct FAnkrCallDispatchStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int queueDepth = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int pendingCalls = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int dispatchedLastFrame = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int64 totalDispatched = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int64 carriedOverFrames = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) float frameBudgetMs = 0.0f;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) float lastFrameMs = 0.0f;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) float averageFrameMs = 0.0f;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) float maxFrameMs = 0.0f;
+};
+
+UCLASS()
+class ANKRSDK_API UAnkrCallDispatchStats : public UUserDefinedStruct
+{
+	GENERATED_BODY()
+};
+
+/// FAnkrCallDispatcher drains the completions of native calls on the game thread and executes their delegates.
+///
+/// The completions are dispatched within a time budget per frame, the ones left over are carried to the next frame so a burst never hitches a frame.\n
+/// The budget is set with the Ankr.CallDispatchBudgetMs console variable or SetFrameBudget(float), at least one completion is dispatched per frame.
+class ANKRSDK_API FAnkrCallDispatcher : public FTickableGameObject
+{
+
+public:
+
+	FAnkrCallDispatcher();
+	virtual ~FAnkrCallDispatcher();
+
+	/// Gets the dispatcher created by the AnkrSDK module, it is null before the module starts up.
+	static FAnkrCallDispatcher* Get();
+
+	void SetFrameBudget(float _milliseconds);
+	float GetFrameBudget() const;
+
+	FAnkrCallDispatchStats GetStats() const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Always; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual bool IsTickableInEditor() const override { return true; }
+
+private:
+
+	FAnkrCallDispatchStats Stats;
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Runtime/Online/HTTP/Public/Http.h"
+#include "AnkrDelegates.h"
+#include "AnkrCallbackThread.generated.h"
+
+/// EAnkrCallbackThread tells on which thread the result of a call is delivered to a native delegate, see FAnkrCallCompleteDelegate.
+///
+/// GameThread is the default.\n
+/// BackgroundThread executes the delegate on a task graph background thread.\n
+/// CompletionThread executes the delegate inline on the thread that completed the call, i.e. the HTTP thread or the thread of the native library. It skips the hop to the game thread entirely.\n
+/// TaskThread executes the delegate on the thread of the SDK named AnkrCallbackThread, the results are delivered one after the other in the order the calls completed.
+///
+/// Dynamic delegates, i.e. the ones bound in Blueprint, are always executed on the game thread, the choice only decides where the response is processed before.
+///
+/// @attention Delegates executed off the game thread must only touch thread-safe state, they must not create or modify UObjects, call Blueprint code or wait on the game thread.
+UENUM(BlueprintType)
+enum class EAnkrCallbackThread : uint8
+{
+	GameThread,
+	BackgroundThread,
+	CompletionThread,
+	TaskThread
+};
+
+/// FAnkrCallResult is the result delegate of a call, either the dynamic delegate of a Blueprint call or the native delegate of a C++ call.
+struct ANKRSDK_API FAnkrCallResult
+{
+	FAnkrCallResult(const FAnkrCallCompleteDynamicDelegate& _dynamic) : Dynamic(_dynamic) {}
+	FAnkrCallResult(const FAnkrCallCompleteDelegate& _native) : Native(_native) {}
+
+	FAnkrCallCompleteDynamicDelegate Dynamic;
+	FAnkrCallCompleteDelegate Native;
+
+	bool IsBound() const { return Dynamic.IsBound() || Native.IsBound(); }
+};
+
+/// AnkrCallbackThread delivers the results of calls on the thread chosen by the caller.
+class ANKRSDK_API AnkrCallbackThread
+{
+
+public:
+
+	/// Gets the thread chosen for the calls made in the current scope, see FAnkrCallbackThreadScope, or the default when no scope is active.
+	static EAnkrCallbackThread Resolve(EAnkrCallbackThread _default);
+
+	/// Runs a function on the chosen thread, it runs inline for CompletionThread and when the game thread is chosen and already current.
+	static void Run(EAnkrCallbackThread _thread, TFunction<void()> _function);
+
+	/// Executes the result of a call, a native delegate on the chosen thread and a dynamic delegate on the game thread.
+	static void Execute(EAnkrCallbackThread _thread, const FAnkrCallResult& _result, FString _response, FString _data, FString _optionalData, int _optionalCode, bool _optionalBool);
+
+	/// Stops the thread behind TaskThread, the functions still queued for it are dropped.
+	static void Shutdown();
+
+	/// Lets the request complete on the HTTP thread when the result is not wanted on the game thread, the completion handler must be thread-safe then.
+	template<typename TRequest>
+	static void Configure(const TRequest& _request, EAnkrCallbackThread _thread)
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		if (_thread != EAnkrCallbackThread::GameThread)
+		{
+			_request->SetDelegateThreadPolicy(EHttpRequestDelegateThreadPolicy::CompleteOnHttpThread);
+		}
+#endif
+	}
+};
+
+/// FAnkrCallbackThreadScope chooses the callback thread for the calls made inside a scope on the current thread, it overrides the choice of the client.
+///
+/// ~~~~~~~~~~~~~~~~~~~~~~~.cpp
+/// {
+///     FAnkrCallbackThreadScope scope(EAnkrCallbackThread::CompletionThread);
+///     ankrClient->CallMethod(contract, abi_hash, method, args, FAnkrCallCompleteDelegate::CreateLambda(...));
+/// }
+/// ~~~~~~~~~~~~~~~~~~~~~~~
+class ANKRSDK_API FAnkrCallbackThreadScope
+{
+
+public:
+
+	explicit FAnkrCallbackThreadScope(EAnkrCallbackThread _thread);
+	~FAnkrCallbackThreadScope();
+
+	FAnkrCallbackThreadScope(FAnkrCallbackThreadScope const&) = delete;
+	void operator = (FAnkrCallbackThreadScope const&) = delete;
+
+private:
+
+	int previous;
+};
@@ -9,8 +9,13 @@
 #include "AnkrDelegates.h"
 #include "AdvertisementManager.h"
 #include "RequestBodyStructure.h"
+#include "AnkrCallDispatcher.h"
+#include "AnkrCallbackThread.h"
+#include "AnkrTransport.h"
 #include "AnkrClient.generated.h"
 
+struct FAnkrAbiValue;
+
 #define DOXYGEN_SHOULD_SKIP_THIS
 
 /// AnkrClient provides various functions that are used to connect wallet and interact with the blockchain.
@@ -38,8 +43,56 @@ public:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) UUpdateNFTExample* updateNFTExample;
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) UWearableNFTExample* wearableNFTExample;
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) UAdvertisementManager* advertisementManager;
+
+	/// The thread on which the native result delegates of this client are executed, the game thread by default, see the FAnkrCallCompleteDelegate overloads of CallMethod, SendTransaction and GetTicketResult.
+	/// Dynamic delegates are always executed on the game thread, the choice only lets their response be processed on the HTTP thread.
+	/// A FAnkrCallbackThreadScope overrides it for the calls made inside the scope.
+	/// @attention Off the game thread the delegates must only touch thread-safe state, see EAnkrCallbackThread. ConnectWallet and GetWalletInfo always process their response on the game thread because they update the client.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ANKR SDK") EAnkrCallbackThread callbackThread = EAnkrCallbackThread::GameThread;
+
+	/// Broadcast for every ticket recovered from the transaction journal once its result is received.
+	UPROPERTY(BlueprintAssignable, VisibleAnywhere, Category = "ANKR SDK") FAnkrTicketRecoveredDelegate onTicketRecovered;
+
+	FDelegateHandle hndl_AppHasEnteredForeground;
 //#endif 
 
+	virtual void BeginDestroy() override;
+
+	EAnkrCallbackThread GetCallbackThread() const;
+
+	/// Gets the hash of an abi like SendABI, from the abi cache, computed locally or uploaded, Callback receives the response and the abi hash.
+	void GetABIHash(FString abi, EAnkrCallbackThread callbackThread, TFunction<void(FString, FString)> Callback);
+
+	/// Uploads an abi to the Ankr API, Callback receives the response and the abi hash on the given thread.
+	void UploadABI(FString abi, EAnkrCallbackThread callbackThread, TFunction<void(FString, FString)> Callback);
+
+	/// Registers the abi of a locally computed hash when a response shows the Ankr API does not know it.
+	///
+	/// It can be called from any thread, the abi is uploaded from the game thread. Retry is called on the game thread with callbackThread chosen for the calls it makes, see FAnkrCallbackThreadScope.
+	///
+	/// @returns Whether the abi is being registered, Retry is then called with the hash returned by the Ankr API instead of the response being delivered.
+	bool RegisterRejectedABI(FString abi_hash, FString content, EAnkrCallbackThread callbackThread, TFunction<void(FString)> Retry);
+
+	/// Checks the arguments of a method against the abi of the contract when it is registered in AnkrContractRegistry.
+	///
+	/// @returns Whether the arguments can be sent, they are sent unchanged.
+	bool ValidateArguments(const FString& contract, const FString& method, const FString& args, FString& error);
+
+	/// Polls a ticket and hands the response, the status, the context of the ticket and the code to Callback on the given thread.
+	/// The context is released after Callback returned once the ticket is final.
+	void RequestTicketResult(FString ticketId, EAnkrCallbackThread callbackThread, TFunction<void(FString, FString, FAnkrRequestContext, int)> Callback);
+
+	/// Sends the transaction of SendTransaction and delivers the result to either kind of delegate.
+	void RequestSendTransaction(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallResult& Result);
+
+	/// Sends the call of CallMethod and delivers the result to either kind of delegate.
+	void RequestCallMethod(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallResult& Result);
+
+	/// Sends the aggregate3 call of a multicall with the hash of the Multicall3 abi and delivers the split results.
+	///
+	/// The calls are the typed value of AnkrMulticall::BuildCalls, they are written into the body as a json array.
+	void SendMulticall(TArray<FAnkrMulticallRequest> calls, const FAnkrAbiValue& aggregate, FString abi_hash, EAnkrCallbackThread callbackThread, const FAnkrMulticallCompleteDynamicDelegate& Result);
+
 	/// Ping function is used to check if the Ankr API responds properly.
 	///
 	/// The function requires a parameter described below and returns nothing.
@@ -94,7 +147,9 @@ public:
 	///
 	/// The function requires a parameter described below and returns nothing.\n
 	/// Inside the function, A POST request is sent to the Ankr API. The request needs a json body containing an abi string and the format is describied in the body section below.\n
-	/// string data will be received in json response for "abi".
+	/// string data will be received in json response for "abi".\n
+	/// The abi hash is kept in the abi cache, see AnkrAbiCache, an abi that was uploaded in a previous session is answered from the cache without a request.\n
+	/// With the console variable Ankr.LocalAbiHash set the hash of a new abi is computed locally and the abi is only uploaded if CallMethod or SendTransaction find the Ankr API does not know it.
 	///
 	/// @param abi An ABI string of a contract.
 	/// @param Result A callback delegate that will be triggered once a response is received with data.
@@ -111,7 +166,8 @@ public:
 	///
 	/// The function requires parameters described below and returns nothing.\n
 	/// Inside the function, A POST request is sent to the Ankr API. The request needs a json body containing a device_id, contract_address, abi_hash, method and args. The format is describied in the body section below.\n
-	/// string data will be received in json response for a "ticket".
+	/// string data will be received in json response for a "ticket".\n
+	/// The request and its ticket are written to the transaction journal, if an identical transaction is still pending its ticket is returned instead of sending it again.
 	///
 	/// @param contract The address of the contract to which you want to interact.
 	/// @param abi_hash The hash of the abi string of the contract.
@@ -125,6 +181,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void SendTransaction(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallCompleteDynamicDelegate& Result);
 
+	/// SendTransaction for C++ callers, the native delegate is executed on the thread chosen by callbackThread or a FAnkrCallbackThreadScope.
+	void SendTransaction(FString contract, FString abi_hash, FString method, FString args, const FAnkrCallCompleteDelegate& Result);
+
 	/// GetTicketResult function is used to get the result of the ticket generated by SendTransaction(FString, FString, FString, FString, const FAnkrCallCompleteDynamicDelegate&).
 	///
 	/// The function requires a parameter described below and returns nothing.\n
@@ -132,7 +191,7 @@ public:
 	/// string data will be received in json response for a "data".
 	///
 	/// @param ticketId The ticket generated by SendTransaction(FString, FString, FString, FString, const FAnkrCallCompleteDynamicDelegate&);
-	/// @param Result A callback delegate that will be triggered once a response is received with data.
+	/// @param Result A callback delegate that will be triggered once a response is received with data, the optional data is the context of the ticket in json.
 	/// 
 	/// ### Body
 	/// ~~~~~~~~~~~~~~~~~~~~~~~.cpp
@@ -141,6 +200,98 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void GetTicketResult(FString ticketId, const FAnkrCallCompleteDynamicDelegate& Result);
 
+	/// GetTicketResult for C++ callers, the native delegate is executed on the thread chosen by callbackThread or a FAnkrCallbackThreadScope.
+	void GetTicketResult(FString ticketId, const FAnkrCallCompleteDelegate& Result);
+
+	/// GetTicketResultWithContext function is the same as GetTicketResult(FString, const FAnkrCallCompleteDynamicDelegate&) but the result is handed back with the context of the operation that produced the ticket.
+	///
+	/// The context stays attached to the ticket until its final result has been handed to the delegate.
+	///
+	/// @param ticketId The ticket generated by SendTransaction(FString, FString, FString, FString, const FAnkrCallCompleteDynamicDelegate&);
+	/// @param Result A callback delegate that will be triggered once a response is received with the status and the context.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void GetTicketResultWithContext(FString ticketId, const FAnkrTicketResultDynamicDelegate& Result);
+
+	/// RecoverPendingTickets function is used to poll the tickets that were still pending in the transaction journal, e.g. after the application was killed or the network dropped.
+	///
+	/// The function doesn't require a parameter and returns the number of tickets that are polled.\n
+	/// Inside the function, a POST request is sent to the Ankr API for every pending ticket and onTicketRecovered is broadcast with its result.\n
+	/// The function is called automatically when the application returns to the foreground, call it once on startup after binding onTicketRecovered.
+	///
+	/// @returns The number of pending tickets that are polled.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	int RecoverPendingTickets();
+
+	void OnApplicationResume();
+
+	/// GetRequestContext function gets the context of the operation that produced a ticket.
+	///
+	/// The function requires parameters described below and returns whether the ticket has a context.\n
+	/// A context is attached to every ticket returned by the transaction functions and is released once the final result of the ticket has been handed to the caller.
+	///
+	/// @param ticket The ticket returned by a transaction function.
+	/// @param context The context of the operation, i.e. its kind, the character and the items involved.
+	/// @returns Whether the ticket has a context.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	bool GetRequestContext(FString ticket, FAnkrRequestContext& context);
+
+	/// SetRequestCallerData function stores caller data in the context of a ticket, it is handed back with the result of that ticket.
+	///
+	/// The function requires parameters described below and returns whether the ticket has a context.
+	///
+	/// @param ticket The ticket returned by a transaction function.
+	/// @param callerData Any string the caller wants back with the result, e.g. the id of a widget.
+	/// @returns Whether the ticket has a context.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	bool SetRequestCallerData(FString ticket, FString callerData);
+
+	/// Warmup function is used to load the native library ahead of its first use, e.g. behind a loading screen.
+	///
+	/// The function requires a parameter described below and returns nothing.\n
+	/// Inside the function, the native library is loaded on a background thread. The library is never loaded from a constructor, without Warmup it is loaded by the first call that needs it.
+	///
+	/// @param Result A callback delegate that will be triggered on the game thread once the library is loaded, optionalBool tells whether it is available on this platform.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void Warmup(const FAnkrCallCompleteDynamicDelegate& Result);
+
+	/// GetCallDispatchStats function gets how the completions of native calls are dispatched on the game thread.
+	///
+	/// The function doesn't require a parameter and returns the stats.\n
+	/// The stats hold the number of completions waiting, the number dispatched in the last frame and the time the dispatch took.
+	///
+	/// @returns The stats of the call dispatcher.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	FAnkrCallDispatchStats GetCallDispatchStats();
+
+	/// SetCallDispatchBudget function sets the time the completions of native calls can take on the game thread per frame.
+	///
+	/// The function requires a parameter described below and returns nothing.\n
+	/// The completions that do not fit in the budget are dispatched in the next frame.
+	///
+	/// @param milliseconds The budget per frame in milliseconds, it is 1 by default.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void SetCallDispatchBudget(float milliseconds);
+
+	/// SetMockBackend function is used to answer every request of the SDK in-process instead of sending it to the Ankr API.
+	///
+	/// The function requires parameters described below and returns nothing.\n
+	/// The mock backend implements every endpoint used by the SDK without touching the network, it is meant for load tests and benchmarks of the SDK itself.
+	///
+	/// @param enabled Whether the requests are answered by the mock backend.
+	/// @param settings The latency and the errors injected by the mock backend.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void SetMockBackend(bool enabled, FAnkrMockBackendSettings settings);
+
+	/// SetNativeBackend function is used to send the requests of the SDK through the native library of the platform instead of the HTTP module.
+	///
+	/// The function requires a parameter described below and returns nothing.\n
+	/// CallMethod, SendTransaction, GetTicketResult and the other requests made in the same frame are submitted to the native library in a single batch, see FAnkrNativeTransport.\n
+	/// The requests are sent over HTTP on platforms without a native library.
+	///
+	/// @param enabled Whether the requests are sent through the native library.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void SetNativeBackend(bool enabled);
+
 	/// CallMethod function is used to get a data from blockchain and doesn't require the user confirmation through wallet such as metamask.
 	///
 	/// The function requires parameters described below and returns nothing.\n
@@ -159,6 +310,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void CallMethod(FString contract, FString abi, FString method, FString args, const FAnkrCallCompleteDynamicDelegate& Result);
 
+	/// CallMethod for C++ callers, the native delegate is executed on the thread chosen by callbackThread or a FAnkrCallbackThreadScope.
+	///
+	/// ~~~~~~~~~~~~~~~~~~~~~~~.cpp
+	/// ankrClient->CallMethod(contract, abi_hash, method, args, FAnkrCallCompleteDelegate::CreateLambda([](FString response, FString data, FString optionalData, int optionalCode, bool optionalBool) { ... }));
+	/// ~~~~~~~~~~~~~~~~~~~~~~~
+	void CallMethod(FString contract, FString abi, FString method, FString args, const FAnkrCallCompleteDelegate& Result);
+
+	/// Multicall function is used to get the data of several readable functions in a single request.
+	///
+	/// The function requires parameters described below and returns nothing.\n
+	/// Inside the function, the calls are encoded with the ABI of their registered contracts and packed into one call of aggregate3 of the Multicall3 contract. The hash of the Multicall3 abi is obtained like SendABI.\n
+	/// The results are split back out in the order of the calls, each with its returned data and its outputs decoded as a json array.
+	///
+	/// @param calls The read calls, each names a contract of AnkrContractRegistry, a method and its args.
+	/// @param Result A callback delegate that will be triggered once a response is received with the results, or with an error when the calls could not be sent or the response could not be read.
+	/// 
+	/// ### Body
+	/// ~~~~~~~~~~~~~~~~~~~~~~~.cpp
+	/// {"device_id":"YOUR_DEVICE_ID", "contract_address":"0xcA11bde05977b3631167028862bE2a173976CA11", "abi_hash":"MULTICALL3_ABI_HASH", "method":"aggregate3", "args":[[["YOUR_CONTRACT_ADDRESS", true, "YOUR_CALLDATA"]]]}
+	/// ~~~~~~~~~~~~~~~~~~~~~~~
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void Multicall(TArray<FAnkrMulticallRequest> calls, const FAnkrMulticallCompleteDynamicDelegate& Result);
+
 	/// SignMessage function is used to sign a message and requires the user confirmation to sign through wallet such as metamask..
 	///
 	/// The function requires parameters described below and returns nothing.\n
@@ -195,11 +369,14 @@ public:
 	/// VerifyMessage function is used to verify the message that was signed.
 	///
 	/// The function requires parameters described below and returns nothing.\n
-	/// Inside the function, A POST request is sent to the Ankr API. The request needs a json body containing a device_id, message and signature. The format is describied in the note section below.\n
-	/// string data will be received in json response for an "address".
+	/// Inside the function, the address is recovered from the personal_sign signature on the device with AnkrSignature::RecoverSigner and no request is sent.\n
+	/// When the signature cannot be recovered locally, A POST request is sent to the Ankr API. The request needs a json body containing a device_id, message and signature. The format is describied in the note section below.\n
+	/// string data will be received in json response for an "address".\n
+	/// The address recovered on the device is passed as the data in its EIP-55 case and the response is {"result":true,"address":"0x..."}, it is not the body of the Ankr API.
+	/// Read the address from the data and compare it with the case ignored, e.g. with UAnkrSignatureLibrary::IsMessageSignedBy.
 	///
 	/// @param device_id The address of the contract to which you want to interact.
-	/// @param message The string message to be signed
+	/// @param message The string message to be signed, hex with 0x is verified as the bytes it encodes like personal_sign signs it.
 	/// @param signature The signature received by GetSignature(FString, const FAnkrCallCompleteDynamicDelegate&);
 	/// @param Result A callback delegate that will be triggered once a response is received with data.
 	/// @attention The "message" should be the one that was used in SignMessage(FString, const FAnkrCallCompleteDynamicDelegate&).
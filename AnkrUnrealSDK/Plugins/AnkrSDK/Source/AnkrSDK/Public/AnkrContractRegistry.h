@@ -0,0 +1,210 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AnkrUInt256.h"
+#include "AnkrContractRegistry.generated.h"
+
+const FString CONTRACT_GAME_ITEM	  = FString(TEXT("GameItem"));
+const FString CONTRACT_GAME_CHARACTER = FString(TEXT("GameCharacter"));
+const FString CONTRACT_UPDATE_NFT	  = FString(TEXT("UpdateNFT"));
+
+/// FAnkrAbiParameter is an input or an output of a contract method.
+USTRUCT(BlueprintType)
+struct FAnkrAbiParameter
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString name;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString type;
+
+	/// The components of a tuple, a tuple array or a tuple of tuples is flattened into the canonical type, e.g. "(uint256,address)[]".
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString canonicalType;
+};
+
+/// FAnkrAbiOutput is a decoded output of a contract method.
+///
+/// An integer is in number, a negative intN as its two's complement, and a boolean in boolean, text holds every scalar as json would, e.g. a decimal, an address or bytes in hex.\n
+/// An array or a tuple has the text of each item in items and the word of each static item in numbers, text then holds the whole value as json.
+USTRUCT(BlueprintType)
+struct FAnkrAbiOutput
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString name;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString type;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString text;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FAnkrUInt256 number;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) bool boolean = false;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) TArray<FString> items;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) TArray<FAnkrUInt256> numbers;
+};
+
+/// FAnkrAbiMethod is a function of a contract ABI.
+USTRUCT(BlueprintType)
+struct FAnkrAbiMethod
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString name;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString stateMutability;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) TArray<FAnkrAbiParameter> inputs;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) TArray<FAnkrAbiParameter> outputs;
+
+	/// The function selector in hex, e.g. "0xa9059cbb", the first 4 bytes of the Keccak-256 of the signature.
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString selector;
+
+	uint32 selectorId = 0;
+
+	/// The signature of the method, e.g. "changeHat(uint256,uint256)".
+	FString GetSignature() const;
+
+	/// Whether the method only reads the blockchain and can be used with CallMethod.
+	bool IsReadOnly() const { return stateMutability == "view" || stateMutability == "pure"; }
+};
+
+/// FAnkrContract is the immutable descriptor of a contract, it is created once and shared by reference.
+///
+/// The method table is parsed from the ABI the first time it is needed.
+class ANKRSDK_API FAnkrContract
+{
+
+public:
+
+	FAnkrContract(FString _name, FString _address, FString _abi);
+
+	const FString& GetName() const	  { return name; }
+	const FString& GetAddress() const { return address; }
+	const FString& GetABI() const	  { return abi; }
+
+	/// Gets every overload of a method, null when the contract has no method with that name.
+	const TArray<FAnkrAbiMethod>* FindMethods(const FString& _method) const;
+
+	const TMap<FString, TArray<FAnkrAbiMethod>>& GetMethods() const;
+
+	/// Gets the method of a function selector, null when the contract has no such method.
+	const FAnkrAbiMethod* FindMethodBySelector(uint32 _selector) const;
+
+	/// Checks the arguments of a call against every overload of the method and writes them normalized as a json array, see AnkrAbi::ValidateArguments.
+	///
+	/// @returns Whether an overload accepts the arguments, the error describes why they were rejected otherwise.
+	bool ValidateArguments(const FString& _method, const FString& _args, FString& _normalizedArgs, FString& _error) const;
+
+	/// Builds the calldata of a call with the first overload of the method that accepts the arguments, see AnkrAbi::EncodeArguments.
+	bool EncodeCall(const FString& _method, const FString& _args, TArray<uint8>& _calldata, FString& _error) const;
+
+private:
+
+	void ParseMethods() const;
+
+	const FString name;
+	const FString address;
+	const FString abi;
+
+	mutable FCriticalSection parseLock;
+	mutable bool isParsed = false;
+	mutable TMap<FString, TArray<FAnkrAbiMethod>> methods;
+	mutable TMap<uint32, FAnkrAbiMethod> methodsBySelector;
+};
+
+typedef TSharedPtr<const FAnkrContract, ESPMode::ThreadSafe> FAnkrContractPtr;
+
+/// AnkrContractRegistry holds the contracts and the item token ids used by the SDK, it can be accessed from any thread.
+///
+/// The registry is filled once per process, from Config/AnkrSDK/Contracts.json of the project when it exists and from the built-in contracts of the examples otherwise.\n
+/// The file has the format {"contracts": [{"name": "GameItem", "address": "0x...", "abi": [...]}], "items": {"BlueHat": "0x..."}}, the abi can also be a json string.
+class ANKRSDK_API AnkrContractRegistry
+{
+
+public:
+
+	static FAnkrContractPtr Find(const FString& _name);
+
+	/// Looks for a contract by its address, the case of the address is ignored.
+	static FAnkrContractPtr FindByAddress(const FString& _address);
+
+	/// Gets a contract that must be registered, an empty contract is returned when it is not.
+	static const FAnkrContract& Get(const FString& _name);
+
+	/// Adds or replaces a contract, the contract is shared with every object that reads it afterwards.
+	static void Register(FString _name, FString _address, FString _abi);
+
+	/// Gets the token id of an item, e.g. "BlueHat".
+	static FString GetItem(const FString& _name);
+	static void RegisterItem(FString _name, FString _tokenId);
+
+	static FString GetConfigPath();
+
+private:
+
+	static void Load();
+};
+
+/// UAnkrContractLibrary exposes the contract registry to blueprints.
+UCLASS()
+class ANKRSDK_API UAnkrContractLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	/// GetContractAddress function gets the address of a registered contract, e.g. "GameItem", "GameCharacter" or "UpdateNFT".
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static FString GetContractAddress(FString name);
+
+	/// GetContractABI function gets the ABI of a registered contract.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static FString GetContractABI(FString name);
+
+	/// ValidateArguments function checks the arguments of a method of a registered contract without a request to the Ankr API.
+	///
+	/// @param name The name of the contract, e.g. "GameCharacter".
+	/// @param method The method that is to be called in the contract.
+	/// @param args The arguments as a json array or separated by commas.
+	/// @param normalizedArgs The arguments as a json array with every value normalized, the arguments are still sent as they were given.
+	/// @param error Why the arguments were rejected.
+	/// @returns Whether the arguments are valid.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static bool ValidateArguments(FString name, FString method, FString args, FString& normalizedArgs, FString& error);
+
+	/// EncodeCall function builds the calldata of a method of a registered contract, the selector followed by the ABI encoded arguments.
+	///
+	/// @param name The name of the contract, e.g. "GameCharacter".
+	/// @param method The method that is to be called in the contract.
+	/// @param args The arguments as a json array or separated by commas.
+	/// @param calldata The calldata in hex with 0x.
+	/// @param error Why the arguments were rejected.
+	/// @returns Whether the arguments are valid.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static bool EncodeCall(FString name, FString method, FString args, FString& calldata, FString& error);
+
+	/// DecodeOutputs function decodes the hex data returned by a method of a registered contract.
+	///
+	/// @param name The name of the contract, e.g. "GameItem".
+	/// @param method The method that was called in the contract.
+	/// @param data The returned data in hex.
+	/// @param outputs The outputs as a json array, integers are decimal strings, addresses and bytes are hex strings.
+	/// @param error Why the data could not be decoded.
+	/// @returns Whether the data was decoded.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static bool DecodeOutputs(FString name, FString method, FString data, FString& outputs, FString& error);
+
+	/// DecodeOutputValues function decodes the hex data returned by a method of a registered contract into typed outputs, see FAnkrAbiOutput.
+	///
+	/// @param name The name of the contract, e.g. "GameItem".
+	/// @param method The method that was called in the contract.
+	/// @param data The returned data in hex.
+	/// @param outputs One output per output of the method, in the order of the ABI.
+	/// @param error Why the data could not be decoded.
+	/// @returns Whether the data was decoded.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static bool DecodeOutputValues(FString name, FString method, FString data, TArray<FAnkrAbiOutput>& outputs, FString& error);
+
+	/// GetItemTokenId function gets the token id of an item, e.g. "BlueHat", "RedShoes" or "WhiteGlasses".
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static FString GetItemTokenId(FString name);
+
+	/// GetItemTokenIdValue function gets the token id of an item as a 256 bit integer, it is 0 for an unknown item.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static FAnkrUInt256 GetItemTokenIdValue(FString name);
+};
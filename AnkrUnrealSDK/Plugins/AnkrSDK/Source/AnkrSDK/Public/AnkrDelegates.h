@@ -1,10 +1,19 @@
 #pragma once
 
 #include "AdvertisementData.h"
+#include "AnkrRequestContext.h"
+#include "EquipmentInfo.h"
+#include "AnkrMulticall.h"
 #include "AnkrDelegates.generated.h"
 
 DECLARE_DYNAMIC_DELEGATE_FiveParams(FAnkrCallCompleteDynamicDelegate, FString, response, FString, data, FString, optionalData, int, optionalCode, bool, optionalBool);
+DECLARE_DELEGATE_FiveParams(FAnkrCallCompleteDelegate, FString, FString, FString, int, bool);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FApplicationResume);
+DECLARE_DYNAMIC_DELEGATE_FourParams(FAnkrTicketResultDynamicDelegate, FString, response, FString, data, FAnkrRequestContext, context, int, code);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FAnkrTicketRecoveredDelegate, FString, ticket, FString, response, FString, status, FAnkrRequestContext, context);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FAnkrMulticallCompleteDynamicDelegate, const TArray<FAnkrMulticallResult>&, results, FString, error);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FAnkrUpdateNFTItemDelegate, FAnkrUInt256, tokenId, FString, ticket, bool, success);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAnkrEquipmentChangedDelegate, FEquipmentInfoStructure, equipment, EEquipmentChangeType, change);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FAdvertisementReceivedDelegate, FAdvertisementDataStructure, advertisementData);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FAdvertisementVideoAdDownloadDelegate, FString, path);
 
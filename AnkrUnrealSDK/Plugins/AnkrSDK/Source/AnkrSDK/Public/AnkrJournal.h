@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include <JsonObjectConverter.h>
+#include "AnkrDelegates.h"
+#include "AnkrRequestContext.h"
+#include "AnkrJournal.generated.h"
+
+const FString JOURNAL_EVENT_SUBMIT	 = FString(TEXT("submit"));
+const FString JOURNAL_EVENT_TICKET	 = FString(TEXT("ticket"));
+const FString JOURNAL_EVENT_RESOLVED = FString(TEXT("resolved"));
+const FString JOURNAL_EVENT_DISCARD	 = FString(TEXT("discard"));
+
+const FString TICKET_STATUS_SUCCESS = FString(TEXT("success"));
+const FString TICKET_STATUS_FAILED	= FString(TEXT("failed"));
+const FString TICKET_STATUS_EXPIRED = FString(TEXT("expired"));
+const FString TICKET_STATUS_PENDING = FString(TEXT("pending"));
+
+/// A request that is neither resolved nor discarded after this many seconds is dropped from the journal, its ticket is no longer polled or handed out.
+const int64 JOURNAL_ENTRY_TTL_SECONDS = 24 * 60 * 60;
+
+/// Answers a request that was not sent because an identical request is in flight, with the content and the ticket of that request. The ticket is empty when the identical request was rejected.
+typedef TFunction<void(FString, FString)> FAnkrJournalResponse;
+
+/// Broadcast on the game thread once per ticket when it reaches a final status, with the ticket, its context and whether it succeeded.
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FAnkrTicketResolvedDelegate, FString, FAnkrRequestContext, bool);
+
+/// FAnkrJournalEntry is a single line of the transaction journal.
+/// A request is journaled once when it is submitted, once when the Ankr API hands out a ticket for it and once when the ticket is resolved.
+USTRUCT(BlueprintType)
+struct FAnkrJournalEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString event;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString requestId;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString sender;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString requestKey;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString body;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString ticket;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString status;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int64 timestamp;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FAnkrRequestContext context;
+
+	static FString ToJson(FAnkrJournalEntry _item)
+	{
+		FString json;
+		FJsonObjectConverter::UStructToJsonObjectString(_item, json, 0, 0, 0, nullptr, false);
+		return json;
+	}
+
+	static FAnkrJournalEntry FromJson(FString json)
+	{
+		FAnkrJournalEntry object{};
+		FJsonObjectConverter::JsonObjectStringToUStruct(json, &object, 0, 0);
+		return object;
+	}
+};
+
+/// AnkrJournal is an append-only on-disk log of the transactions sent to the Ankr API and of the tickets they produced.
+///
+/// Every record is a single json line appended to Saved/AnkrSDK/TransactionJournal.log, so writing is one small append per state change.\n
+/// The journal is replayed the first time it is accessed, which gives back the tickets that were still pending when the application was killed or lost its connection.\n
+/// Those tickets are polled again instead of the transaction being submitted a second time.
+class ANKRSDK_API AnkrJournal
+{
+
+public:
+
+	/// Records that a request is about to be sent unless an identical request is in flight, i.e. sent by this session and still waiting for its ticket. The request key is derived from the body.
+	///
+	/// The lookup and the record are done under the same lock, so two identical requests can't both be in flight, the second one is answered once the Ankr API answers the first.\n
+	/// An identical request that already has a ticket does not stop a new one, and an identical request of a previous session that never got a ticket is replaced by it.
+	///
+	/// @param _response Called on the game thread when the request is not sent.
+	/// @returns Whether the request was recorded and must be sent.
+	static bool RecordSubmit(FString _requestId, FString _sender, FString _body, FAnkrRequestContext _context, FAnkrJournalResponse _response);
+
+	/// Same as RecordSubmit(FString, FString, FString, FAnkrRequestContext, FAnkrJournalResponse) with the response sent to a delegate, the data is the ticket.
+	static bool RecordSubmit(FString _requestId, FString _sender, FString _body, FAnkrRequestContext _context, FAnkrCallCompleteDynamicDelegate _result);
+
+	/// Records the ticket that the Ankr API returned for a request, the context of the request is attached to the ticket.
+	static void RecordTicket(FString _requestId, FString _ticket);
+
+	/// Records that a ticket reached a final status, the request is removed from the pending list.
+	/// The context of the ticket is kept, the poll that handed the final result to the caller releases it afterwards.
+	///
+	/// @returns Whether the ticket was pending.
+	static bool RecordResolved(FString _ticket, FString _status);
+
+	/// Every poll of a ticket hands its result response here. When the response is final the ticket is recorded as resolved and OnTicketResolved is broadcast, the first time only.
+	///
+	/// @param _status TICKET_STATUS_SUCCESS or TICKET_STATUS_FAILED when the outcome is final.
+	/// @returns Whether the response is final.
+	static bool ResolveTicket(FString _ticket, TSharedPtr<FJsonObject> _jsonObject, FString& _status);
+
+	/// The listeners of the tickets reaching a final status, e.g. the equipment of UWearableNFTExample. It must only be accessed on the game thread.
+	static FAnkrTicketResolvedDelegate& OnTicketResolved();
+
+	/// Removes a request that never received a ticket, i.e. the Ankr API rejected it.
+	static void Discard(FString _requestId);
+
+	/// Records the outcome of a submit response, the ticket is attached to the request or the request is discarded when no ticket was given.
+	static void RecordResponse(FString _requestId, FString _ticket);
+
+	/// Returns every request that has not been resolved yet, including the ones recovered from a previous session.
+	static TArray<FAnkrJournalEntry> GetPendingEntries();
+
+	/// Reads the ticket status from a result response, both the top level "status" and the "data" object "status" are supported.
+	static FString GetTicketStatus(TSharedPtr<FJsonObject> _jsonObject);
+
+	/// Whether a result response tells the final outcome of a ticket.
+	///
+	/// As documented by the Ankr API, "result" tells whether the ticket was successful or unsuccessful and the "data" object "status" is "success" once the transaction succeeded.\n
+	/// A "result" of false is final, and so is every status except an empty one or TICKET_STATUS_PENDING. A final status other than "success" is a failure.
+	///
+	/// @param _status TICKET_STATUS_SUCCESS or TICKET_STATUS_FAILED when the outcome is final.
+	static bool IsResolved(TSharedPtr<FJsonObject> _jsonObject, FString& _status);
+
+	static FString GetJournalPath();
+
+	/// Drops the state kept in memory and replays the journal from disk as a new session would, e.g. in the AnkrSDK.Journal tests.
+	static void Reload();
+
+private:
+
+	static void Replay();
+	static void RemoveExpired();
+	static void Respond(const TArray<FAnkrJournalResponse>& _responses, const FString& _content, const FString& _ticket);
+	static void Append(const FAnkrJournalEntry& _entry);
+	static void Compact();
+	static void CloseWriter();
+	static FString GetRequestKey(const FString& _body);
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/// AnkrKeccak computes the Keccak-256 hash used by Ethereum, it is the original Keccak padding and not the SHA3-256 one.
+///
+/// Hash256Batch hashes several inputs at once in the SIMD lanes of the platform, AVX2 (4 lanes), SSE2 or NEON (2 lanes), and falls back to Hash256 otherwise.\n
+/// The throughput of both is logged by the console command Ankr.KeccakBenchmark [count] [size], the digests of both are checked against known answers by the AnkrSDK.Keccak automation tests.
+class ANKRSDK_API AnkrKeccak
+{
+
+public:
+
+	static const int32 DigestSize = 32;
+
+	static void Hash256(const uint8* _data, int64 _length, uint8* _digest);
+
+	static TArray<uint8> Hash256(const TArray<uint8>& _data);
+
+	/// Hashes the UTF-8 bytes of a string, e.g. a method signature.
+	static TArray<uint8> Hash256(const FString& _text);
+
+	/// The 4 byte selector of a method signature, e.g. 0xa9059cbb for "transfer(address,uint256)".
+	static uint32 GetSelector(const FString& _signature);
+
+	/// Hashes _count inputs into _digests, DigestSize bytes per input in the order of the inputs.
+	static void Hash256Batch(const uint8* const* _data, const int64* _lengths, int32 _count, uint8* _digests);
+
+	static TArray<TArray<uint8>> Hash256Batch(const TArray<TArray<uint8>>& _inputs);
+
+	/// The selectors of several method signatures, hashed with Hash256Batch.
+	static TArray<uint32> GetSelectors(const TArray<FString>& _signatures);
+
+	/// The name of the implementation used by Hash256Batch, e.g. "AVX2, 4 lanes".
+	static const TCHAR* GetImplementation();
+};
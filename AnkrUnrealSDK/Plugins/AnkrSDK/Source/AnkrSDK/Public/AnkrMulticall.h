@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Dom/JsonValue.h"
+#include "AnkrMulticall.generated.h"
+
+struct FAnkrAbiMethod;
+struct FAnkrAbiValue;
+
+/// The name of the Multicall3 contract in AnkrContractRegistry, it is deployed at the same address on every chain.
+const FString CONTRACT_MULTICALL = FString(TEXT("Multicall3"));
+const FString MULTICALL_ADDRESS	 = FString(TEXT("0xcA11bde05977b3631167028862bE2a173976CA11"));
+const FString MULTICALL_METHOD	 = FString(TEXT("aggregate3"));
+const FString MULTICALL_CALLS	 = FString(TEXT("(address,bool,bytes)[]"));
+
+/// FAnkrMulticallRequest is one read call packed into a multicall.
+USTRUCT(BlueprintType)
+struct FAnkrMulticallRequest
+{
+	GENERATED_BODY()
+
+	/// The name of a registered contract, e.g. "GameCharacter", or its address.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) FString contract;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) FString method;
+
+	/// The arguments as a json array or separated by commas.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) FString args;
+
+	/// Whether the other calls go on when this call reverts, the whole multicall reverts otherwise.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) bool allowFailure = true;
+};
+
+/// FAnkrMulticallResult is the result of one call of a multicall, in the order of the calls.
+USTRUCT(BlueprintType)
+struct FAnkrMulticallResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) bool success = false;
+
+	/// The data returned by the call in hex.
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString data;
+
+	/// The outputs decoded with the ABI of the method as a json array, see UAnkrContractLibrary::DecodeOutputs.
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString outputs;
+};
+
+/// AnkrMulticall packs read calls of registered contracts into a single aggregate3 call of Multicall3 and splits its results back out.
+class ANKRSDK_API AnkrMulticall
+{
+
+public:
+
+	/// Encodes the calls as the argument of aggregate3, an array of (target, allowFailure, callData) tuples of the type MULTICALL_CALLS.
+	///
+	/// @returns Whether every call is a method of a registered contract with valid arguments.
+	static bool BuildCalls(const TArray<FAnkrMulticallRequest>& _calls, FAnkrAbiValue& _aggregate, FString& _error);
+
+	/// Writes the calls of BuildCalls as the arguments of aggregate3, a json array holding the array of [target, allowFailure, callData] tuples.
+	static bool BuildArguments(const TArray<FAnkrMulticallRequest>& _calls, FString& _args, FString& _error);
+
+	/// Splits the data returned by aggregate3 into the results of the calls.
+	///
+	/// The data is the ABI encoded (bool,bytes)[] returned by a node or a json array of [success, returnData] pairs.
+	static bool ParseResults(const TArray<FAnkrMulticallRequest>& _calls, const FString& _data, TArray<FAnkrMulticallResult>& _results, FString& _error);
+
+	/// Runs aggregate3 against registered contracts without a chain, for FAnkrMockTransport.
+	///
+	/// Respond gives the data of a method in the form the Ankr API returns it, e.g. "1" or "2, 3", it is encoded with the outputs of the method.\n
+	/// A call to an unknown contract or method fails, the multicall fails as a whole when that call does not allow failure.
+	///
+	/// @returns The ABI encoded (bool,bytes)[] in hex.
+	static bool Execute(const TArray<TSharedPtr<FJsonValue>>& _args, TFunctionRef<FString(const FAnkrAbiMethod&)> _respond, FString& _data, FString& _error);
+};
+
+UCLASS()
+class ANKRSDK_API UAnkrMulticall : public UUserDefinedStruct
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Engine/UserDefinedStruct.h"
+#include <JsonObjectConverter.h>
+#include "AnkrUInt256.h"
+#include "AnkrRequestContext.generated.h"
+
+UENUM(BlueprintType)
+enum class EAnkrOperation : uint8
+{
+	None,
+	SendTransaction,
+	MintItems,
+	MintCharacter,
+	GameItemSetApproval,
+	ChangeHat,
+	UpdateNFT
+};
+
+/// FAnkrRequestContext describes the operation that produced a ticket.
+/// It is attached to the ticket when the Ankr API returns it and handed back with the result of that ticket, so concurrent operations never have to be told apart by the last request.
+USTRUCT(BlueprintType)
+struct FAnkrRequestContext
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) EAnkrOperation operation = EAnkrOperation::None;
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FString requestId;
+
+	/// The character of an equipment change, it is 0 for the operations that are not about a character.
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FAnkrUInt256 characterId;
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) TArray<FString> itemIds;
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FString callerData;
+
+	static FString ToJson(FAnkrRequestContext _item)
+	{
+		FString json;
+		FJsonObjectConverter::UStructToJsonObjectString(_item, json, 0, 0, 0, nullptr, false);
+		return json;
+	}
+
+	static FAnkrRequestContext FromJson(FString json)
+	{
+		FAnkrRequestContext object{};
+		FJsonObjectConverter::JsonObjectStringToUStruct(json, &object, 0, 0);
+		return object;
+	}
+};
+
+/// AnkrRequestContext keeps the context of every ticket that is still in use, it can be accessed from any thread.
+class ANKRSDK_API AnkrRequestContext
+{
+
+public:
+
+	static FAnkrRequestContext Make(EAnkrOperation _operation, const FAnkrUInt256& _characterId = FAnkrUInt256(), TArray<FString> _itemIds = TArray<FString>());
+
+	/// Attaches a context to a ticket, an existing context for the same ticket is replaced.
+	static void Attach(FString _ticket, FAnkrRequestContext _context);
+
+	/// Looks for the context of a ticket.
+	///
+	/// @returns Whether the ticket has a context.
+	static bool Find(FString _ticket, FAnkrRequestContext& _context);
+
+	/// Sets the caller data of a ticket that already has a context.
+	static bool SetCallerData(FString _ticket, FString _callerData);
+
+	static void Release(FString _ticket);
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "AnkrCallDispatcher.h"
 
 class FAnkrSDKModule : public IModuleInterface
 {
@@ -12,4 +13,9 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+
+	/** Drains the completions of native calls on the game thread. */
+	TUniquePtr<FAnkrCallDispatcher> CallDispatcher;
 };
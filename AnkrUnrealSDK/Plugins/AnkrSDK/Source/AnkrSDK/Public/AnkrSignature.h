@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AnkrSignature.generated.h"
+
+/// AnkrSignature verifies messages signed with personal_sign on the device, the signer is recovered from the signature with secp256k1 like ecrecover.
+///
+/// Only public data is handled, the curve arithmetic is not constant time and must not be used with private keys.
+class ANKRSDK_API AnkrSignature
+{
+
+public:
+
+	static const int32 SignatureSize = 65;
+	static const int32 PublicKeySize = 64;
+
+	/// The EIP-191 hash signed by personal_sign, keccak256("\x19Ethereum Signed Message:\n" + length + message) of the UTF-8 bytes of the message.
+	/// A message of hex with 0x and an even number of digits is hashed as the bytes it encodes, as personal_sign signs it.
+	static TArray<uint8> HashPersonalMessage(const FString& _message);
+
+	/// Recovers the public key, 64 bytes of x and y without the 0x04 prefix, from a 32 byte hash and a 65 byte signature r, s, v.
+	///
+	/// @returns Whether v is 0, 1, 27 or 28, r and s are below the order of the curve and the key is not the point at infinity.
+	static bool RecoverPublicKey(const uint8* _hash, const uint8* _signature, uint8* _publicKey);
+
+	/// The EIP-55 checksummed address of a public key, the last 20 bytes of its Keccak-256 hash.
+	static FString GetAddress(const uint8* _publicKey);
+
+	/// Writes an address with the EIP-55 checksum, e.g. "0x7E5F4552091A69125d5DfCb7b8C2659029395Bdf".
+	static FString ToChecksumAddress(const FString& _address);
+
+	/// Recovers the checksummed address that signed a message with personal_sign.
+	///
+	/// @param _signature The signature in hex as received by UAnkrClient::GetSignature.
+	static bool RecoverSigner(const FString& _message, const FString& _signature, FString& _address, FString& _error);
+};
+
+/// UAnkrSignatureLibrary verifies signed messages in Blueprint without a request to the Ankr API.
+UCLASS()
+class ANKRSDK_API UAnkrSignatureLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	/// RecoverMessageSigner function recovers the address that signed the message with personal_sign.
+	///
+	/// @param message The message that was signed.
+	/// @param signature The signature received by UAnkrClient::GetSignature.
+	/// @param address The checksummed address of the signer.
+	/// @param error The reason the signature could not be recovered.
+	/// @returns Whether the signature is valid.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	static bool RecoverMessageSigner(FString message, FString signature, FString& address, FString& error);
+
+	/// IsMessageSignedBy function checks whether the message was signed by an address, the case of the address is ignored.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static bool IsMessageSignedBy(FString message, FString signature, FString address);
+};
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Runtime/Online/HTTP/Public/Http.h"
+#include "AnkrTransport.generated.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 26)
+typedef TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FAnkrHttpRequestRef;
+#else
+typedef TSharedRef<IHttpRequest> FAnkrHttpRequestRef;
+#endif
+
+/// FAnkrMockBackendSettings configures the in-process backend that answers the requests of the SDK instead of the Ankr API.
+USTRUCT(BlueprintType)
+struct FAnkrMockBackendSettings
+{
+	GENERATED_BODY()
+
+	/// The time in milliseconds before a response is delivered.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) float latencyMs = 0.0f;
+
+	/// A random time in milliseconds between zero and this value that is added to the latency of every response.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) float latencyJitterMs = 0.0f;
+
+	/// The chance between 0 and 1 for a request to fail with the error code.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) float errorRate = 0.0f;
+
+	/// The response code of a failed request.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) int errorCode = 503;
+
+	/// The endpoints that always fail, e.g. "send/transaction".
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) TArray<FString> failingEndpoints;
+
+	/// Whether "call/method" and "send/transaction" reject an abi_hash that was not registered with "abi", like the Ankr API.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) bool rejectUnknownAbiHashes = true;
+
+	/// The wallet address returned by "wallet/info" and "verify/message".
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) FString account = "0x7E5F4552091A69125d5DfCb7b8C2659029395Bdf";
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere) int chainId = 5;
+};
+
+/// IAnkrTransport sends the requests built by the SDK, the completion delegate of the request is executed with the response.
+class ANKRSDK_API IAnkrTransport
+{
+
+public:
+
+	virtual ~IAnkrTransport() {}
+
+	virtual void ProcessRequest(FAnkrHttpRequestRef _request) = 0;
+};
+
+/// FAnkrHttpTransport sends the requests over the network, it is the default transport.
+class ANKRSDK_API FAnkrHttpTransport : public IAnkrTransport
+{
+
+public:
+
+	virtual void ProcessRequest(FAnkrHttpRequestRef _request) override;
+};
+
+/// FAnkrMockTransport answers the requests in-process without touching the network.
+///
+/// Every endpoint of the Ankr API and of the advertisement API used by the SDK is implemented: "ping", "connect", "wallet/info", "abi", "send/transaction", "result", "call/method", "sign/message", "verify/message", "start" and "ad".\n
+/// "call/method" runs "aggregate3" of Multicall3 against the method responses of the registered contracts, see AnkrMulticall::Execute.\n
+/// Tickets returned by "send/transaction" and "sign/message" are known to "result" and succeed immediately.\n
+/// "abi" hashes the ABI like AnkrAbiCache::ComputeHash, so locally computed hashes can be checked against it.\n
+/// Responses are delivered on the game thread by the core ticker after the configured latency, like the responses of the HTTP module.
+class ANKRSDK_API FAnkrMockTransport : public IAnkrTransport
+{
+
+public:
+
+	explicit FAnkrMockTransport(const FAnkrMockBackendSettings& _settings = FAnkrMockBackendSettings());
+
+	virtual void ProcessRequest(FAnkrHttpRequestRef _request) override;
+
+	void SetSettings(const FAnkrMockBackendSettings& _settings);
+	FAnkrMockBackendSettings GetSettings();
+
+	/// Sets the "data" returned by "call/method" for a contract method, "0" is returned for methods without a response.
+	void SetMethodResponse(FString _method, FString _data);
+
+	int GetNumRequests() const { return numRequests; }
+	int GetNumErrors() const { return numErrors; }
+
+	/// Builds the response of an endpoint, the response code is 200 unless the endpoint is unknown.
+	FString Respond(const FString& _endpoint, const FString& _content, int& _code);
+
+private:
+
+	FString MakeTicket(FString _signature);
+
+	FCriticalSection lock;
+	FAnkrMockBackendSettings settings;
+	TMap<FString, FString> methodResponses;
+	TMap<FString, FString> tickets;
+	TSet<FString> abiHashes;
+
+	TAtomic<int> numRequests{ 0 };
+	TAtomic<int> numErrors{ 0 };
+};
+
+/// FAnkrNativeTransport sends the requests of the Ankr API through the native library of the platform instead of the HTTP module.
+///
+/// "connect", "wallet/info", "abi", "send/transaction", "result", "call/method", "sign/message" and "verify/message" are sent to the export of the same name, the other requests are sent with the HTTP module.\n
+/// The requests made during a frame are submitted on the next tick of the core ticker, LibraryManager::SubmitBatch hands them to the native library in one call where ANKR_WITH_NATIVE_BATCH is set and SubmitEach sends them one by one elsewhere.\n
+/// The native library answers with the body the Ankr API would return, the completion delegate of the request is executed on the game thread by FAnkrCallDispatcher.\n
+/// The requests are sent with the HTTP module when the platform has no native library or it could not be loaded.
+class ANKRSDK_API FAnkrNativeTransport : public IAnkrTransport, public TSharedFromThis<FAnkrNativeTransport, ESPMode::ThreadSafe>
+{
+
+public:
+
+	virtual void ProcessRequest(FAnkrHttpRequestRef _request) override;
+
+	/// Submits the requests gathered since the last flush, it must be called on the game thread.
+	void Flush();
+
+	/// The export of the native library that answers an endpoint, it is empty when the endpoint is only served over HTTP.
+	static FString GetNativeMethod(const FString& _endpoint);
+
+private:
+
+	struct FPendingRequest
+	{
+		int callIndex;
+		FString method;
+		TArray<uint8> content;
+	};
+
+	FCriticalSection lock;
+	TArray<FPendingRequest> pending;
+	bool isFlushScheduled = false;
+};
+
+/// AnkrTransport holds the transport used by every request of the SDK.
+///
+/// The HTTP transport is used unless the mock backend is enabled with UseMockBackend or the command line, e.g. -AnkrMockBackend -AnkrMockLatencyMs=20 -AnkrMockErrorRate=0.01.\n
+/// The native library of the platform is used once it is enabled with UseNativeBackend or -AnkrNativeBackend.
+class ANKRSDK_API AnkrTransport
+{
+
+public:
+
+	static TSharedRef<IAnkrTransport, ESPMode::ThreadSafe> Get();
+	static void Set(TSharedPtr<IAnkrTransport, ESPMode::ThreadSafe> _transport);
+
+	/// Enables or disables the mock backend, the HTTP transport is used again once it is disabled.
+	static void UseMockBackend(bool _enabled, const FAnkrMockBackendSettings& _settings);
+
+	/// Enables or disables the native backend, see FAnkrNativeTransport. The HTTP transport is used again once it is disabled.
+	static void UseNativeBackend(bool _enabled);
+
+	/// Gets the mock backend, it is null unless the mock backend is enabled.
+	static TSharedPtr<FAnkrMockTransport, ESPMode::ThreadSafe> GetMockBackend();
+
+	static void ProcessRequest(FAnkrHttpRequestRef _request);
+};
+
+UCLASS()
+class ANKRSDK_API UAnkrTransport : public UUserDefinedStruct
+{
+	GENERATED_BODY()
+};
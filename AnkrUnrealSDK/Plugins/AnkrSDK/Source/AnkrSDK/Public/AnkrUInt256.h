@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AnkrUInt256.generated.h"
+
+/// FAnkrUInt256 is an unsigned 256 bit integer, e.g. a token id, an amount or a balance that does not fit in an int.
+///
+/// It is kept in four 64 bit limbs, the least significant first. Arithmetic wraps around at 2^256 like the EVM.\n
+/// In Blueprint it is made and read with UAnkrUInt256Library, e.g. from "0x00010000000000000000000000000000000000000000000000000000000001" or "1000000000000000000".
+USTRUCT(BlueprintType)
+struct ANKRSDK_API FAnkrUInt256
+{
+	GENERATED_BODY()
+
+	/// The limbs are reflected so the value is copied, saved and replicated with the struct that holds it.
+	UPROPERTY() uint64 limbs[4] = { 0, 0, 0, 0 };
+
+	FAnkrUInt256() {}
+	explicit FAnkrUInt256(uint64 _value) { limbs[0] = _value; }
+
+	/// Parses hex with 0x or decimal, leading zeros are allowed.
+	///
+	/// @returns Whether the text is a number below 2^256.
+	static bool Parse(const FString& _text, FAnkrUInt256& _value);
+	static bool ParseHex(const TCHAR* _digits, int32 _length, FAnkrUInt256& _value);
+	static bool ParseDecimal(const TCHAR* _digits, int32 _length, FAnkrUInt256& _value);
+
+	/// Reads 32 bytes in big endian order, e.g. an ABI word.
+	static FAnkrUInt256 FromBigEndian(const uint8* _bytes);
+	void ToBigEndian(uint8* _bytes) const;
+
+	/// Writes lowercase hex with 0x and at least the given number of digits, e.g. ToHex(64) for a full word.
+	FString ToHex(int32 _minDigits = 1) const;
+	FString ToDecimal() const;
+
+	bool IsZero() const { return (limbs[0] | limbs[1] | limbs[2] | limbs[3]) == 0; }
+	bool FitsUint64() const { return (limbs[1] | limbs[2] | limbs[3]) == 0; }
+
+	int32 Compare(const FAnkrUInt256& _other) const
+	{
+		for (int32 i = 3; i >= 0; i--)
+		{
+			if (limbs[i] != _other.limbs[i])
+			{
+				return limbs[i] < _other.limbs[i] ? -1 : 1;
+			}
+		}
+		return 0;
+	}
+
+	bool operator==(const FAnkrUInt256& _other) const { return Compare(_other) == 0; }
+	bool operator!=(const FAnkrUInt256& _other) const { return Compare(_other) != 0; }
+	bool operator<(const FAnkrUInt256& _other) const  { return Compare(_other) < 0; }
+	bool operator<=(const FAnkrUInt256& _other) const { return Compare(_other) <= 0; }
+	bool operator>(const FAnkrUInt256& _other) const  { return Compare(_other) > 0; }
+	bool operator>=(const FAnkrUInt256& _other) const { return Compare(_other) >= 0; }
+
+	FAnkrUInt256 operator+(const FAnkrUInt256& _other) const;
+	FAnkrUInt256 operator-(const FAnkrUInt256& _other) const;
+
+	/// Multiplies by a small factor in place and adds a small value, the part above 2^256 is returned.
+	uint32 MultiplyAdd(uint32 _factor, uint32 _addend);
+
+	/// Divides by a small divisor in place and returns the remainder.
+	uint32 Divide(uint32 _divisor);
+
+	/// The value is exported and imported as decimal text, so a struct saved as json, e.g. the context of a journaled request, keeps all 256 bits of its ids.
+	bool ExportTextItem(FString& ValueStr, const FAnkrUInt256& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
+	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
+	friend uint32 GetTypeHash(const FAnkrUInt256& _value)
+	{
+		return HashCombine(HashCombine(GetTypeHash(_value.limbs[0]), GetTypeHash(_value.limbs[1])), HashCombine(GetTypeHash(_value.limbs[2]), GetTypeHash(_value.limbs[3])));
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FAnkrUInt256> : public TStructOpsTypeTraitsBase2<FAnkrUInt256>
+{
+	enum
+	{
+		WithIdenticalViaEquality = true,
+		WithExportTextItem		 = true,
+		WithImportTextItem		 = true,
+	};
+};
+
+/// UAnkrUInt256Library makes, reads and compares FAnkrUInt256 values in Blueprint.
+UCLASS()
+class ANKRSDK_API UAnkrUInt256Library : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	/// MakeUInt256 function parses a token id or an amount given as hex with 0x or as decimal.
+	///
+	/// @param text The number, e.g. "0x00010000000000000000000000000000000000000000000000000000000001" or "1000000000000000000".
+	/// @param success Whether the text is a number below 2^256, the value is 0 otherwise.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static FAnkrUInt256 MakeUInt256(FString text, bool& success);
+
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "To UInt256 (Integer64)", CompactNodeTitle = "->", BlueprintAutocast))
+	static FAnkrUInt256 Conv_Int64ToUInt256(int64 value);
+
+	/// Gets the value as an int64, values above the largest int64 are clamped to it.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "To Integer64 (UInt256)", CompactNodeTitle = "->", BlueprintAutocast))
+	static int64 Conv_UInt256ToInt64(const FAnkrUInt256& value);
+
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "To String (UInt256)", CompactNodeTitle = "->", BlueprintAutocast))
+	static FString Conv_UInt256ToString(const FAnkrUInt256& value);
+
+	/// ToHexString function writes the value in lowercase hex with 0x and at least minDigits digits.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	static FString ToHexString(const FAnkrUInt256& value, int minDigits = 1);
+
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "Equal (UInt256)", CompactNodeTitle = "=="))
+	static bool EqualEqual_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b);
+
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "Not Equal (UInt256)", CompactNodeTitle = "!="))
+	static bool NotEqual_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b);
+
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "Less (UInt256)", CompactNodeTitle = "<"))
+	static bool Less_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b);
+
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "Greater (UInt256)", CompactNodeTitle = ">"))
+	static bool Greater_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b);
+
+	/// Adds two values, the sum wraps around at 2^256.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "Add (UInt256)", CompactNodeTitle = "+"))
+	static FAnkrUInt256 Add_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b);
+
+	/// Subtracts two values, the difference wraps around below 0.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK", meta = (DisplayName = "Subtract (UInt256)", CompactNodeTitle = "-"))
+	static FAnkrUInt256 Subtract_UInt256UInt256(const FAnkrUInt256& a, const FAnkrUInt256& b);
+};
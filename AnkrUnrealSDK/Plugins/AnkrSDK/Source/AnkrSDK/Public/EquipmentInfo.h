@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Engine/UserDefinedStruct.h"
+#include <JsonObjectConverter.h>
+#include "AnkrUInt256.h"
+#include "EquipmentInfo.generated.h"
+
+UENUM(BlueprintType)
+enum class EEquipmentChangeType : uint8
+{
+	Predicted,
+	Confirmed,
+	RolledBack
+};
+
+/// FEquipmentInfoStructure holds the wearables of a character, an empty slot means the wearable is unknown.
+USTRUCT(BlueprintType)
+struct FEquipmentInfoStructure
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FAnkrUInt256 characterId;
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FString hat;
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FString shoes;
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FString glasses;
+
+	static FString ToJson(FEquipmentInfoStructure _item)
+	{
+		FString json;
+		FJsonObjectConverter::UStructToJsonObjectString(_item, json);
+		return json;
+	}
+
+	static FEquipmentInfoStructure FromJson(FString json)
+	{
+		FEquipmentInfoStructure object{};
+		FJsonObjectConverter::JsonObjectStringToUStruct(json, &object, 0, 0);
+		return object;
+	}
+};
+
+UCLASS()
+class ANKRSDK_API UEquipmentInfo : public UUserDefinedStruct
+{
+	GENERATED_BODY()
+};
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Engine/UserDefinedStruct.h"
 #include <JsonObjectConverter.h>
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "AnkrUInt256.h"
 #include "ItemInfo.generated.h"
 
 USTRUCT(BlueprintType)
@@ -17,10 +19,56 @@ struct FItemInfoStructure
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) int expireTime;
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FString signature;
 
-	static FString ToJson(FItemInfoStructure _item)
+	/// The token id when it does not fit in an int, it is sent as tokenId in place of the int when it is not zero.
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere) FAnkrUInt256 tokenIdValue;
+
+	/// Gets the token id that is sent in decimal, e.g. for the context of a request.
+	FString GetTokenId() const
+	{
+		return tokenIdValue.IsZero() ? FString::FromInt(tokenId) : tokenIdValue.ToDecimal();
+	}
+
+	/// Gets the token id as a 256 bit integer, tokenIdValue when it is not zero and the int otherwise.
+	FAnkrUInt256 GetTokenIdValue() const
+	{
+		return tokenIdValue.IsZero() ? FAnkrUInt256((uint64)FMath::Max(tokenId, 0)) : tokenIdValue;
+	}
+
+	/// Writes the item with a single tokenId number, the digits of tokenIdValue are written as they are so no precision is lost.
+	static TSharedRef<FJsonObject> ToJsonObject(const FItemInfoStructure& _item)
+	{
+		TSharedRef<FJsonObject> object = MakeShared<FJsonObject>();
+		FJsonObjectConverter::UStructToJsonObject(FItemInfoStructure::StaticStruct(), &_item, object, 0, 0);
+		object->RemoveField(TEXT("tokenIdValue"));
+		if (!_item.tokenIdValue.IsZero())
+		{
+			object->SetField(TEXT("tokenId"), MakeShared<FJsonValueNumberString>(_item.tokenIdValue.ToDecimal()));
+		}
+		return object;
+	}
+
+	/// Export callback for FJsonObjectConverter, the items held by another struct, e.g. the args of FRequestBodyStruct, are written by ToJsonObject.
+	static TSharedPtr<FJsonValue> ExportJson(FProperty* _property, const void* _value)
+	{
+		const FStructProperty* structProperty = CastField<FStructProperty>(_property);
+		if (structProperty == nullptr || structProperty->Struct != FItemInfoStructure::StaticStruct())
+		{
+			return nullptr;
+		}
+		return MakeShared<FJsonValueObject>(ToJsonObject(*static_cast<const FItemInfoStructure*>(_value)));
+	}
+
+	static FString ToJson(FItemInfoStructure _item, bool _prettyPrint = true)
 	{
 		FString json;
-		FJsonObjectConverter::UStructToJsonObjectString(_item, json);
+		if (_prettyPrint)
+		{
+			FJsonSerializer::Serialize(ToJsonObject(_item), TJsonWriterFactory<>::Create(&json));
+		}
+		else
+		{
+			FJsonSerializer::Serialize(ToJsonObject(_item), TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&json));
+		}
 		return json;
 	}
 
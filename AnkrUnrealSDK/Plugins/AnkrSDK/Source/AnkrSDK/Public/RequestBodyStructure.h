@@ -7,6 +7,7 @@
 #include "ItemInfo.h"
 #include <string>
 #include "AnkrDelegates.h"
+#include "AnkrCallbackThread.h"
 #include "RequestBodyStructure.generated.h"
 
 USTRUCT(BlueprintType)
@@ -23,7 +24,8 @@ struct FRequestBodyStruct
 	static FString ToJson(FRequestBodyStruct _item)
 	{
 		FString json;
-		FJsonObjectConverter::UStructToJsonObjectString(_item, json);
+		const FJsonObjectConverter::CustomExportCallback exportItem = FJsonObjectConverter::CustomExportCallback::CreateStatic(&FItemInfoStructure::ExportJson);
+		FJsonObjectConverter::UStructToJsonObjectString(_item, json, 0, 0, 0, &exportItem);
 		return json;
 	}
 
@@ -43,8 +45,45 @@ struct FAnkrCallStruct
 	int callIndex;
 	FString sender;
 	bool success;
-	FString data;
+	std::string utf8Data;
 	FAnkrCallCompleteDynamicDelegate CallComplete;
+	EAnkrCallbackThread callbackThread = EAnkrCallbackThread::GameThread;
+
+	/// Called instead of CallComplete for calls made from C++, e.g. by FAnkrNativeTransport, with the success and the data.
+	TFunction<void(bool, const FString&)> NativeComplete;
+
+	/// Executes the completion of the call with its data.
+	void Execute()
+	{
+		if (NativeComplete)
+		{
+			NativeComplete(success, GetData());
+			return;
+		}
+
+		if (CallComplete.IsBound())
+		{
+			const FString& callData = GetData();
+			CallComplete.Execute(callData, callData, sender, -1, success);
+		}
+	}
+
+	/// Gets the data of the call, the UTF-8 data received from the native library is converted once and only when it is needed.
+	const FString& GetData()
+	{
+		if (!isDataConverted)
+		{
+			FUTF8ToTCHAR conversion(utf8Data.data(), (int32)utf8Data.size());
+			data			= FString(conversion.Length(), conversion.Get());
+			isDataConverted = true;
+		}
+		return data;
+	}
+
+private:
+
+	FString data;
+	bool isDataConverted = false;
 };
 
 UCLASS()
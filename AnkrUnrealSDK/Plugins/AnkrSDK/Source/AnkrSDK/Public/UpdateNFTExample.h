@@ -8,6 +8,8 @@
 #include "ItemInfo.h"
 #include "UpdateNFTExample.generated.h"
 
+struct FUpdateNFTBatch;
+
 /// UUpdateNFTExample provides various functions to get and update NFT's metadata on the blockchain.
 UCLASS(Blueprintable, BlueprintType)
 class ANKRSDK_API UUpdateNFTExample : public UObject
@@ -23,8 +25,21 @@ public:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString activeAccount;
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int chainId;
 
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString ContractAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString ABI;
+	/// The contract address and ABI are read from AnkrContractRegistry by their getters, the properties themselves hold no copy of them.
+	UPROPERTY(BlueprintGetter = GetContractAddress) FString ContractAddress;
+	UPROPERTY(BlueprintGetter = GetABI) FString ABI;
+
+	UFUNCTION(BlueprintGetter) FString GetContractAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetABI() const;
+
+	/// The name of a contract method that takes an array of ItemInfo, UpdateNFTs sends one item per request when it is empty.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ANKR SDK") FString BatchUpdateMethodName;
+	/// The maximum number of items sent in a single request by UpdateNFTs, it bounds the gas used by one transaction.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ANKR SDK") int MaxItemsPerRequest;
+	/// The maximum size in UTF-8 bytes of a single request body sent by UpdateNFTs.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ANKR SDK") int MaxRequestBytes;
+	/// The maximum number of requests UpdateNFTs keeps in flight.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ANKR SDK") int MaxConcurrentRequests;
 
 	void Init(FString _deviceId, FString _session);
 	void SetAccount(FString _account, int _chainId);
@@ -63,6 +78,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void UpdateNFT(FString abi_hash, FItemInfoStructure _item, FAnkrCallCompleteDynamicDelegate Result);
 
+	/// UpdateNFTs function is used to update the metadata of many NFTs and requires the user confirmation through wallet such as metamask.
+	///
+	/// The function requires parameters described below and returns nothing.
+	/// Inside the function, the items are split into chunks bounded by MaxItemsPerRequest and MaxRequestBytes, each chunk is sent as one POST request to the Ankr API and receives one ticket.
+	/// A chunk holds a single item unless BatchUpdateMethodName names a contract method that takes an array of ItemInfo.
+	///
+	/// @param abi_hash The hash of the abi string of the contract.
+	/// @param _items The metadata items to be updated.
+	/// @param ItemResult A callback delegate that will be triggered for every item with the ticket of its chunk.
+	/// @param Result A callback delegate that will be triggered once every chunk is answered, the optionalCode is the number of items that received a ticket. It is triggered right away when there are no items.
+	/// @attention On Android the wallet is opened once the first chunk received its ticket.
+	/// 
+	/// ### Body
+	/// ~~~~~~~~~~~~~~~~~~~~~~~.cpp
+	/// {"device_id":"YOUR_DEVICE_ID","contract_address":"0x159D0A933137f3EC155f43834BDFCd534A8bfd61","abi_hash":"YOUR_ABI_HASH","method":"YOUR_BATCH_UPDATE_METHOD","args":[[{"tokenId":YOUR_TOKEN_ID,"itemType":YOUR_ITEM_TYPE,"strength":YOUR_STRENGTH,"level":YOUR_LEVEL,"expireTime":YOUR_EXPIRE_TIME,"signature":""}, ...]]}
+	/// ~~~~~~~~~~~~~~~~~~~~~~~
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void UpdateNFTs(FString abi_hash, TArray<FItemInfoStructure> _items, FAnkrUpdateNFTItemDelegate ItemResult, FAnkrCallCompleteDynamicDelegate Result);
+
 	/// GetTicketResult function is used to get the result of the ticket generated by UpdateNFT(FString, FItemInfoStructure, FAnkrCallCompleteDynamicDelegate);
 	///
 	/// The function requires a parameter described below and returns nothing.
@@ -70,7 +104,7 @@ public:
 	/// string data will be received in json response for a "data".
 	///
 	/// @param ticket The ticket generated by UpdateNFT(FString, FItemInfoStructure, FAnkrCallCompleteDynamicDelegate);
-	/// @param Result A callback delegate that will be triggered once a response is received with data.
+	/// @param Result A callback delegate that will be triggered once a response is received with data, the optional data is the context of the ticket in json.
 	/// 
 	/// ### Body
 	/// ~~~~~~~~~~~~~~~~~~~~~~~.cpp
@@ -78,4 +112,8 @@ public:
 	/// ~~~~~~~~~~~~~~~~~~~~~~~
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void GetTicketResult(FString ticketId, FAnkrCallCompleteDynamicDelegate Result);
+
+private:
+
+	void SendUpdateChunks(TSharedPtr<FUpdateNFTBatch> batch);
 };
\ No newline at end of file
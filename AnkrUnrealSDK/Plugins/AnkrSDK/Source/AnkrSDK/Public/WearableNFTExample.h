@@ -5,6 +5,7 @@
 #include "Runtime/Online/HTTP/Public/Http.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "AnkrDelegates.h"
+#include "AnkrUInt256.h"
 #include "WearableNFTExample.generated.h"
 
 /// UWearableNFTExample provide various functions to mint character, mint items, get balance and changeHat etc.
@@ -22,22 +23,45 @@ public:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString activeAccount;
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) int chainId;
 
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString GameItemContractAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString GameItemABI;
-			 
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString GameCharacterContractAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString GameCharacterABI;
-			  
+	/// The contract addresses, ABIs and item token ids are read from AnkrContractRegistry by their getters, the properties themselves hold no copy of them.
+	UPROPERTY(BlueprintGetter = GetGameItemContractAddress) FString GameItemContractAddress;
+	UPROPERTY(BlueprintGetter = GetGameItemABI) FString GameItemABI;
+
+	UPROPERTY(BlueprintGetter = GetGameCharacterContractAddress) FString GameCharacterContractAddress;
+	UPROPERTY(BlueprintGetter = GetGameCharacterABI) FString GameCharacterABI;
+
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString TransactionGasLimit;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString BlueHatAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString RedHatAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString WhiteHatAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString BlueShoesAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString RedShoesAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString WhiteShoesAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString BlueGlassesAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString RedGlassesAddress;
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere) FString WhiteGlassesAddress;
+	UPROPERTY(BlueprintGetter = GetBlueHatAddress) FString BlueHatAddress;
+	UPROPERTY(BlueprintGetter = GetRedHatAddress) FString RedHatAddress;
+	UPROPERTY(BlueprintGetter = GetWhiteHatAddress) FString WhiteHatAddress;
+	UPROPERTY(BlueprintGetter = GetBlueShoesAddress) FString BlueShoesAddress;
+	UPROPERTY(BlueprintGetter = GetRedShoesAddress) FString RedShoesAddress;
+	UPROPERTY(BlueprintGetter = GetWhiteShoesAddress) FString WhiteShoesAddress;
+	UPROPERTY(BlueprintGetter = GetBlueGlassesAddress) FString BlueGlassesAddress;
+	UPROPERTY(BlueprintGetter = GetRedGlassesAddress) FString RedGlassesAddress;
+	UPROPERTY(BlueprintGetter = GetWhiteGlassesAddress) FString WhiteGlassesAddress;
+
+	UFUNCTION(BlueprintGetter) FString GetGameItemContractAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetGameItemABI() const;
+	UFUNCTION(BlueprintGetter) FString GetGameCharacterContractAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetGameCharacterABI() const;
+	UFUNCTION(BlueprintGetter) FString GetBlueHatAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetRedHatAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetWhiteHatAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetBlueShoesAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetRedShoesAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetWhiteShoesAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetBlueGlassesAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetRedGlassesAddress() const;
+	UFUNCTION(BlueprintGetter) FString GetWhiteGlassesAddress() const;
+
+	/// When enabled, ChangeHat publishes the expected equipment of the character right away through onEquipmentChanged and confirms or rolls it back once the ticket is resolved.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ANKR SDK") bool OptimisticEquip;
+
+	/// Broadcast whenever the equipment of a character is predicted, confirmed or rolled back.
+	UPROPERTY(BlueprintAssignable, VisibleAnywhere, Category = "ANKR SDK") FAnkrEquipmentChangedDelegate onEquipmentChanged;
+
+	virtual void BeginDestroy() override;
 
 	void Init(FString _deviceId, FString _session);
 	void SetAccount(FString _account, int _chainId);
@@ -130,6 +154,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void GetCharacterTokenId(FString abi_hash, int tokenBalance, FString owner, FString index, FAnkrCallCompleteDynamicDelegate Result);
 
+	/// GetCharacterTokenIdValue function is GetCharacterTokenId for a balance and an index that do not fit in an int, e.g. the balance of GetItemBalanceValue.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void GetCharacterTokenIdValue(FString abi_hash, const FAnkrUInt256& tokenBalance, FString owner, const FAnkrUInt256& index, FAnkrCallCompleteDynamicDelegate Result);
+
 	/// ChangeHat function is used to change the hat of the character and requires the user confirmation through wallet such as metamask.
 	///
 	/// The function requires parameters described below and returns nothing.
@@ -147,7 +175,7 @@ public:
 	/// {"device_id":"YOUR_DEVICE_ID", "contract_address":"0x7081F409F750EACD27867c988b4B3771d935Fe16", "abi_hash":"YOUR_ABI_HASH", "method":"changeHat", "args":["TOKEN_ID", "HAT_ADDRESS"]}
 	/// ~~~~~~~~~~~~~~~~~~~~~~~
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
-	void ChangeHat(FString abi_hash, int characterId, bool hasHat, FString hatAddress, FAnkrCallCompleteDynamicDelegate Result);
+	void ChangeHat(FString abi_hash, const FAnkrUInt256& characterId, bool hasHat, FString hatAddress, FAnkrCallCompleteDynamicDelegate Result);
 
 	/// GetHat function is used to get the current hat of the character and requires the user confirmation through wallet such as metamask.
 	///
@@ -164,10 +192,28 @@ public:
 	/// {"device_id":"YOUR_DEVICE_ID", "contract_address":"0x7081F409F750EACD27867c988b4B3771d935Fe16", "abi_hash":"YOUR_ABI_HASH", "method":"getHat", "args":["TOKEN_ID"]}
 	/// ~~~~~~~~~~~~~~~~~~~~~~~
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
-	void GetHat(FString abi_hash, int characterId, FAnkrCallCompleteDynamicDelegate Result);
+	void GetHat(FString abi_hash, const FAnkrUInt256& characterId, FAnkrCallCompleteDynamicDelegate Result);
+
+	/// GetHatValue function is the same as GetHat(FString, FAnkrUInt256, FAnkrCallCompleteDynamicDelegate), it is kept for the graphs that already call it.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK", meta = (DeprecatedFunction, DeprecationMessage = "GetHat takes the character id as a UInt256 now, use GetHat."))
+	void GetHatValue(FString abi_hash, const FAnkrUInt256& characterId, FAnkrCallCompleteDynamicDelegate Result);
+
+	/// GetEquipment function gets the equipment of the character as the game should display it.
+	///
+	/// The function requires a parameter described below and returns the equipment.\n
+	/// The equipment confirmed on the blockchain is returned with the pending predictions applied on top of it when OptimisticEquip is enabled.
+	///
+	/// @param characterId The character id obtained by GetCharacterTokenId(FString, int, FString, FString, FAnkrCallCompleteDynamicDelegate);
+	/// @returns The equipment of the character.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	FEquipmentInfoStructure GetEquipment(const FAnkrUInt256& characterId);
+
+	/// IsEquipmentPending function gets whether the character has an equipment change that is still waiting for its ticket.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	bool IsEquipmentPending(const FAnkrUInt256& characterId);
 	
 	/// GetTicketResult function is used to get the result of the ticket generated by MintItems(FString, FString, FAnkrCallCompleteDynamicDelegate), MintCharacter(FString, FString, FAnkrCallCompleteDynamicDelegate),
-	/// GameItemSetApproval(FString, FString, bool, FAnkrCallCompleteDynamicDelegate) or ChangeHat(FString, int, bool, FString, FAnkrCallCompleteDynamicDelegate)
+	/// GameItemSetApproval(FString, FString, bool, FAnkrCallCompleteDynamicDelegate) or ChangeHat(FString, FAnkrUInt256, bool, FString, FAnkrCallCompleteDynamicDelegate)
 	///
 	/// The function requires a parameter described below and returns nothing.
 	/// Inside the function, A POST request is sent to the Ankr API. The request needs a json body containing a data and txHash. The format is describied in the note section below.
@@ -183,6 +229,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void GetTicketResult(FString ticketId, FAnkrCallCompleteDynamicDelegate Result);
 
+	/// GetTicketResultWithContext function is the same as GetTicketResult(FString, FAnkrCallCompleteDynamicDelegate) but the result is handed back with the context of the operation that produced the ticket.
+	///
+	/// The function requires parameters described below and returns nothing.
+	/// The context tells which operation, character and items the ticket belongs to, so several operations can be pending at the same time.
+	///
+	/// @param ticketId The ticket generated by one of the transaction functions.
+	/// @param Result A callback delegate that will be triggered once a response is received with data and the context.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void GetTicketResultWithContext(FString ticketId, FAnkrTicketResultDynamicDelegate Result);
+
 	/// GetItemsBalance function is used to get the balance of items in batch.
 	///
 	/// The function requires a parameter described below and returns nothing.
@@ -200,8 +256,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void GetItemsBalance(FString abi_hash, FString address, FAnkrCallCompleteDynamicDelegate Result);
 
+	/// GetItemValueFromBalances function gets the balance of one item from the data received by GetItemsBalance.
+	///
+	/// The data is decoded once and the balances are kept, every later call still compares the data with the decoded one.
+	/// To read every slot of an inventory use GetItemBalances or GetItemBalanceValue, they read the kept balances without the data.\n
+	/// The data can be the comma separated balances returned by the Ankr API or the ABI encoded uint256[] returned by a node.
+	///
+	/// @param data The data received by GetItemsBalance.
+	/// @param index The index of the item in the order of GetItemsBalance, it is clamped to the balances.
+	/// @returns The balance or -1 when the data holds no balances.
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
-	int GetItemValueFromBalances(FString data, int index);
+	int GetItemValueFromBalances(const FString& data, int index);
+
+	/// GetItemBalances function gets every balance decoded from the last data received by GetItemsBalance or given to GetItemValueFromBalances.
+	/// It is the function to call per frame or per inventory slot, the balances are only decoded when a response arrives.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	TArray<int> GetItemBalances() const;
+
+	/// GetItemBalanceValue function gets the exact balance of one item, the balances of GetItemValueFromBalances and GetItemBalances are clamped to the largest int.
+	UFUNCTION(BlueprintPure, Category = "ANKR SDK")
+	FAnkrUInt256 GetItemBalanceValue(int index) const;
 
 	/// GetTokenURI function is used to get token uri of an NFT.
 	///
@@ -214,4 +288,35 @@ public:
 	/// @param Result A callback delegate that will be triggered once a response is received with data.
 	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
 	void GetTokenURI(FString abi_hash, int tokenId, FAnkrCallCompleteDynamicDelegate Result);
+
+	/// GetTokenURIValue function is GetTokenURI for a token id that does not fit in an int.
+	UFUNCTION(BlueprintCallable, Category = "ANKR SDK")
+	void GetTokenURIValue(FString abi_hash, const FAnkrUInt256& tokenId, FAnkrCallCompleteDynamicDelegate Result);
+
+	/// Polls a ticket and hands the response, the data, the context, the code and the final status to Callback.
+	/// The status is TICKET_STATUS_SUCCESS or TICKET_STATUS_FAILED once the ticket is final and empty while it is pending.
+	void RequestTicketResult(FString ticketId, TFunction<void(FString, FString, FAnkrRequestContext, int, FString)> Callback);
+
+	/// Confirms or rolls back the equipment change described by the context once its ticket reached a final status.
+	/// It is called for every ticket resolved through AnkrJournal::ResolveTicket.
+	void ResolveEquipment(const FAnkrRequestContext& context, bool success);
+
+private:
+
+	TMap<FAnkrUInt256, FEquipmentInfoStructure> ConfirmedEquipment;
+	TMap<FAnkrUInt256, FEquipmentInfoStructure> PredictedEquipment;
+
+	FString BalancesData;
+	TArray<int> Balances;
+	TArray<FAnkrUInt256> BalanceValues;
+
+	void DecodeBalances(const FString& data);
+
+	void RequestCharacterTokenId(FString abi_hash, const FString& owner, const FString& index, FAnkrCallCompleteDynamicDelegate Result);
+	void RequestTokenURI(FString abi_hash, const FString& tokenId, FAnkrCallCompleteDynamicDelegate Result);
+
+	void PredictEquipment(const FAnkrRequestContext& context);
+	void OnTicketResolved(FString ticket, FAnkrRequestContext context, bool success);
+	static FString* GetEquipmentSlot(FEquipmentInfoStructure& equipment, EAnkrOperation operation);
+	static bool IsEquipmentOperation(EAnkrOperation operation);
 };
\ No newline at end of file
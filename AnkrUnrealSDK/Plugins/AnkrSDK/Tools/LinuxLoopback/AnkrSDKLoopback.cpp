@@ -0,0 +1,189 @@
+// AnkrSDKLoopback is a stand-in for libAnkrSDKUnrealLinux.so with the same exported C ABI as AnkrSDKUnrealWindows.dll.
+// Every request is answered with its own content from a worker thread, so the native path of LibraryManager can be
+// exercised and benchmarked on Linux servers without a wallet or the Ankr API.
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef void(*LogCallbackDelegate)(const char* _message);
+typedef void(*Callback)(bool success, const char* data);
+typedef void(*IndexedCallback)(int callIndex, bool success, const char* data);
+
+struct AnkrBatchRequest
+{
+	int callIndex;
+	const char* method;
+	const char* content;
+};
+
+struct AnkrBatchCompletion
+{
+	int callIndex;
+	bool success;
+	const char* data;
+};
+
+typedef void(*BatchCallback)(const AnkrBatchCompletion* completions, int count);
+
+namespace
+{
+	struct Completion
+	{
+		Callback callback = nullptr;
+		IndexedCallback indexedCallback = nullptr;
+		BatchCallback batchCallback = nullptr;
+		int callIndex = 0;
+		std::string data;
+		std::vector<int> batchIndices;
+		std::vector<std::string> batchData;
+	};
+
+	class Loopback
+	{
+
+	public:
+
+		static Loopback& GetInstance()
+		{
+			static Loopback INSTANCE;
+			return INSTANCE;
+		}
+
+		void Push(Completion _completion)
+		{
+			{
+				std::lock_guard<std::mutex> lock(queueLock);
+				queue.push_back(std::move(_completion));
+			}
+			queueSignal.notify_one();
+		}
+
+		~Loopback()
+		{
+			{
+				std::lock_guard<std::mutex> lock(queueLock);
+				isRunning = false;
+			}
+			queueSignal.notify_one();
+			worker.join();
+		}
+
+	private:
+
+		Loopback() : worker([this]() { Run(); }) {}
+
+		void Run()
+		{
+			for (;;)
+			{
+				Completion completion;
+				{
+					std::unique_lock<std::mutex> lock(queueLock);
+					queueSignal.wait(lock, [this]() { return !queue.empty() || !isRunning; });
+					if (queue.empty())
+					{
+						return;
+					}
+
+					completion = std::move(queue.front());
+					queue.pop_front();
+				}
+
+				if (completion.batchCallback != nullptr)
+				{
+					std::vector<AnkrBatchCompletion> completions;
+					completions.reserve(completion.batchIndices.size());
+					for (size_t i = 0; i < completion.batchIndices.size(); i++)
+					{
+						completions.push_back({ completion.batchIndices[i], true, completion.batchData[i].c_str() });
+					}
+					completion.batchCallback(completions.data(), (int)completions.size());
+				}
+				else if (completion.indexedCallback != nullptr)
+				{
+					completion.indexedCallback(completion.callIndex, true, completion.data.c_str());
+				}
+				else if (completion.callback != nullptr)
+				{
+					completion.callback(true, completion.data.c_str());
+				}
+			}
+		}
+
+		std::mutex queueLock;
+		std::condition_variable queueSignal;
+		std::deque<Completion> queue;
+		bool isRunning = true;
+		std::thread worker;
+	};
+
+	std::string DeviceId;
+
+	void Reply(Callback _callback, const char* _content)
+	{
+		Completion completion{};
+		completion.callback = _callback;
+		completion.data		= _content != nullptr ? _content : "";
+		Loopback::GetInstance().Push(std::move(completion));
+	}
+
+	void ReplyIndexed(int _callIndex, IndexedCallback _callback, const char* _content)
+	{
+		Completion completion{};
+		completion.indexedCallback = _callback;
+		completion.callIndex	   = _callIndex;
+		completion.data			   = _content != nullptr ? _content : "";
+		Loopback::GetInstance().Push(std::move(completion));
+	}
+}
+
+#define ANKR_LOOPBACK_API extern "C" __attribute__((visibility("default")))
+
+ANKR_LOOPBACK_API void Initialize(bool /*_isDevelopment*/, const char* _device_id, LogCallbackDelegate _log)
+{
+	DeviceId = _device_id != nullptr ? _device_id : "";
+	if (_log != nullptr)
+	{
+		_log("AnkrSDKLoopback - Initialize - every request is answered with its own content.");
+	}
+}
+
+ANKR_LOOPBACK_API const char* GetDeviceId()	{ return DeviceId.c_str(); }
+ANKR_LOOPBACK_API const char* GetQRCodeText() { return ""; }
+ANKR_LOOPBACK_API const char* GetSession()	{ return ""; }
+ANKR_LOOPBACK_API const char* GetAccount()	{ return "0x0000000000000000000000000000000000000000"; }
+ANKR_LOOPBACK_API int GetChainId()			{ return 0; }
+
+ANKR_LOOPBACK_API void Ping(Callback _callback) { Reply(_callback, "pong"); }
+ANKR_LOOPBACK_API void PingIndexed(int _callIndex, IndexedCallback _callback) { ReplyIndexed(_callIndex, _callback, "pong"); }
+
+#define ANKR_LOOPBACK_METHOD(Name) \
+	ANKR_LOOPBACK_API void Name(const char* _content, Callback _callback) { Reply(_callback, _content); } \
+	ANKR_LOOPBACK_API void Name##Indexed(int _callIndex, const char* _content, IndexedCallback _callback) { ReplyIndexed(_callIndex, _callback, _content); }
+
+ANKR_LOOPBACK_METHOD(ConnectWallet)
+ANKR_LOOPBACK_METHOD(GetWallet)
+ANKR_LOOPBACK_METHOD(SendABI)
+ANKR_LOOPBACK_METHOD(SendTransaction)
+ANKR_LOOPBACK_METHOD(CallMethod)
+ANKR_LOOPBACK_METHOD(SignMessage)
+ANKR_LOOPBACK_METHOD(GetResult)
+ANKR_LOOPBACK_METHOD(VerifyMessage)
+
+ANKR_LOOPBACK_API void SubmitBatch(const AnkrBatchRequest* _requests, int _count, BatchCallback _callback)
+{
+	Completion completion{};
+	completion.batchCallback = _callback;
+	completion.batchIndices.reserve(_count);
+	completion.batchData.reserve(_count);
+	for (int i = 0; i < _count; i++)
+	{
+		completion.batchIndices.push_back(_requests[i].callIndex);
+		completion.batchData.push_back(_requests[i].content != nullptr ? _requests[i].content : "");
+	}
+	Loopback::GetInstance().Push(std::move(completion));
+}
@@ -0,0 +1,212 @@
+// AnkrSDKLoopbackTest loads libAnkrSDKUnrealLinux.so like the Linux LibraryManager does and checks that every export answers
+// its own request: the legacy exports, the indexed exports and the batch export.
+// With --benchmark it also measures the time to complete the same requests with one crossing each and with batches.
+
+#include <dlfcn.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+typedef void(*LogCallbackDelegate)(const char* _message);
+typedef void(*Callback)(bool success, const char* data);
+typedef void(*IndexedCallback)(int callIndex, bool success, const char* data);
+
+struct AnkrBatchRequest
+{
+	int callIndex;
+	const char* method;
+	const char* content;
+};
+
+struct AnkrBatchCompletion
+{
+	int callIndex;
+	bool success;
+	const char* data;
+};
+
+typedef void(*BatchCallback)(const AnkrBatchCompletion* completions, int count);
+
+using InitializeImport	   = void(*)(bool, const char*, LogCallbackDelegate);
+using ContentImport		   = void(*)(const char*, Callback);
+using ContentIndexedImport = void(*)(int, const char*, IndexedCallback);
+using SubmitBatchImport	   = void(*)(const AnkrBatchRequest*, int, BatchCallback);
+
+namespace
+{
+	std::mutex CompletionLock;
+	std::condition_variable CompletionSignal;
+	std::vector<std::string> Completions;
+	int NumCompleted  = 0;
+	int NumMismatched = 0;
+
+	void Reset(int _count)
+	{
+		std::lock_guard<std::mutex> lock(CompletionLock);
+		Completions.assign(_count, std::string());
+		NumCompleted  = 0;
+		NumMismatched = 0;
+	}
+
+	void Complete(int _callIndex, bool _success, const char* _data)
+	{
+		std::lock_guard<std::mutex> lock(CompletionLock);
+		if (!_success || _callIndex < 0 || _callIndex >= (int)Completions.size() || Completions[_callIndex] != std::to_string(_callIndex))
+		{
+			NumMismatched++;
+		}
+		Completions[_callIndex] = _data != nullptr ? _data : "";
+		NumCompleted++;
+		CompletionSignal.notify_one();
+	}
+
+	void OnIndexedCallback(int _callIndex, bool _success, const char* _data)
+	{
+		Complete(_callIndex, _success, _data);
+	}
+
+	void OnBatchCallback(const AnkrBatchCompletion* _completions, int _count)
+	{
+		for (int i = 0; i < _count; i++)
+		{
+			Complete(_completions[i].callIndex, _completions[i].success, _completions[i].data);
+		}
+	}
+
+	std::string LegacyData;
+	void OnCallback(bool _success, const char* _data)
+	{
+		std::lock_guard<std::mutex> lock(CompletionLock);
+		LegacyData = _success && _data != nullptr ? _data : "";
+		NumCompleted++;
+		CompletionSignal.notify_one();
+	}
+
+	// The content of a request is its call index, so a completion can be checked against the call it belongs to.
+	void Prepare(int _count, std::vector<std::string>& _contents)
+	{
+		Reset(_count);
+		_contents.resize(_count);
+		for (int i = 0; i < _count; i++)
+		{
+			_contents[i]	= std::to_string(i);
+			Completions[i]	= _contents[i];
+		}
+	}
+
+	bool Wait(int _count)
+	{
+		std::unique_lock<std::mutex> lock(CompletionLock);
+		return CompletionSignal.wait_for(lock, std::chrono::seconds(30), [_count]() { return NumCompleted >= _count; });
+	}
+
+	double RunIndexed(ContentIndexedImport _export, int _count)
+	{
+		std::vector<std::string> contents;
+		Prepare(_count, contents);
+
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < _count; i++)
+		{
+			_export(i, contents[i].c_str(), OnIndexedCallback);
+		}
+		Wait(_count);
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	double RunBatches(SubmitBatchImport _export, int _count, int _batchSize)
+	{
+		std::vector<std::string> contents;
+		Prepare(_count, contents);
+
+		std::vector<AnkrBatchRequest> batch;
+		batch.reserve(_batchSize);
+
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < _count; i += _batchSize)
+		{
+			batch.clear();
+			for (int j = i; j < i + _batchSize && j < _count; j++)
+			{
+				batch.push_back({ j, "CallMethod", contents[j].c_str() });
+			}
+			_export(batch.data(), (int)batch.size(), OnBatchCallback);
+		}
+		Wait(_count);
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	int NumFailures = 0;
+	void Check(bool _condition, const char* _description)
+	{
+		std::printf("%s %s\n", _condition ? "PASS" : "FAIL", _description);
+		NumFailures += _condition ? 0 : 1;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* libraryPath = "libAnkrSDKUnrealLinux.so";
+	bool isBenchmark = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--benchmark") == 0) isBenchmark = true;
+		else										  libraryPath = argv[i];
+	}
+
+	void* handle = dlopen(libraryPath, RTLD_NOW | RTLD_LOCAL);
+	if (handle == nullptr)
+	{
+		std::printf("FAIL %s could not be loaded: %s\n", libraryPath, dlerror());
+		return 1;
+	}
+
+	InitializeImport initialize				 = (InitializeImport)dlsym(handle, "Initialize");
+	ContentImport callMethod				 = (ContentImport)dlsym(handle, "CallMethod");
+	ContentIndexedImport callMethodIndexed	 = (ContentIndexedImport)dlsym(handle, "CallMethodIndexed");
+	SubmitBatchImport submitBatch			 = (SubmitBatchImport)dlsym(handle, "SubmitBatch");
+
+	Check(initialize != nullptr && callMethod != nullptr && callMethodIndexed != nullptr && submitBatch != nullptr, "the exports used by LibraryManager are found");
+	if (NumFailures > 0)
+	{
+		return 1;
+	}
+
+	initialize(false, "loopback-test", nullptr);
+
+	Reset(0);
+	callMethod("{\"method\":\"legacy\"}", OnCallback);
+	Check(Wait(1) && LegacyData == "{\"method\":\"legacy\"}", "the legacy export answers with the content");
+
+	const int count = 10000;
+	RunIndexed(callMethodIndexed, count);
+	Check(NumCompleted == count && NumMismatched == 0, "every indexed call is answered with its own call index");
+
+	RunBatches(submitBatch, count, 64);
+	Check(NumCompleted == count && NumMismatched == 0, "every call of the batches is answered with its own call index");
+
+	RunBatches(submitBatch, 1, 64);
+	Check(NumCompleted == 1 && NumMismatched == 0, "a batch of one call is answered");
+
+	if (isBenchmark)
+	{
+		const int requests = 100000;
+		const int rounds   = 5;
+		double indexed = 0.0, batched = 0.0;
+		for (int round = 0; round < rounds; round++)
+		{
+			indexed += RunIndexed(callMethodIndexed, requests);
+			batched += RunBatches(submitBatch, requests, 64);
+		}
+		std::printf("BENCHMARK %d requests, one crossing each: %.2f ms, batches of 64: %.2f ms (average of %d rounds)\n", requests, indexed / rounds, batched / rounds, rounds);
+	}
+
+	dlclose(handle);
+	return NumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+#!/bin/sh
+# Builds the loopback library and copies it where the Linux LibraryManager loads it from.
+# "build.sh test" also builds and runs the test of the exports, "build.sh benchmark" runs it with the crossing benchmark.
+set -e
+
+HERE="$(cd "$(dirname "$0")" && pwd)"
+OUTPUT="$HERE/../../Source/AnkrSDK/Private/Linux/Libraries"
+CXX="${CXX:-clang++}"
+
+mkdir -p "$OUTPUT"
+"$CXX" -std=c++14 -O2 -fPIC -shared -fvisibility=hidden -pthread "$HERE/AnkrSDKLoopback.cpp" -o "$OUTPUT/libAnkrSDKUnrealLinux.so"
+echo "Built $OUTPUT/libAnkrSDKUnrealLinux.so"
+
+case "$1" in
+	test|benchmark)
+		TEST="$(mktemp -d)/AnkrSDKLoopbackTest"
+		"$CXX" -std=c++14 -O2 -pthread "$HERE/AnkrSDKLoopbackTest.cpp" -o "$TEST" -ldl
+		if [ "$1" = "benchmark" ]; then
+			"$TEST" "$OUTPUT/libAnkrSDKUnrealLinux.so" --benchmark
+		else
+			"$TEST" "$OUTPUT/libAnkrSDKUnrealLinux.so"
+		fi
+		;;
+esac